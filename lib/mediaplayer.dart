@@ -7,6 +7,7 @@ enum DenoiseLevel {
   none,
   soft,
   full,
+  light, // spectral noise suppressor at 16 kHz, a fraction of the CPU of soft/full
 }
 
 class MediaPlayer extends PlatformInterface {
@@ -48,6 +49,17 @@ class MediaPlayer extends PlatformInterface {
     return _created;
   }
 
+  /// A numbered packet: [sequence] counts packets (16-bit, wrapping) and [timestamp] is the
+  /// position of the first sample in samples of the stream (32-bit, wrapping), as in RTP.
+  /// Packets are reordered, deduplicated and played by timestamp; use either this or
+  /// [addChunk] for a stream.
+  Future<bool> addPacket(Uint8List data, int sequence, int timestamp) async {
+    if (_created) {
+      await _instance.addPacket(_playerId, data, sequence & 0xFFFF, timestamp & 0xFFFFFFFF);
+    }
+    return _created;
+  }
+
   Future<void> setJitterRange(int min, int max) async {
     _create(() => _instance.setJitterRange(_playerId, min, max));
   }
@@ -68,8 +80,21 @@ class MediaPlayer extends PlatformInterface {
     return _create(() => _instance.isStereo(_playerId));
   }
 
-  Future<void> setDenoise(DenoiseLevel level) async {
-    _create(() => _instance.setDenoise(_playerId, level));
+  /// [model] is an optional path to a model file written by `export_model`; the built-in
+  /// network is used when it is null.
+  Future<void> setDenoise(DenoiseLevel level, {String? model}) async {
+    _create(() => _instance.setDenoise(_playerId, level, model));
+  }
+
+  /// Per-stage denoise timings ({stage: {count, p50, p99, max, mean}}, in CPU ticks per frame).
+  /// Null when denoise is off or the plugin was built without profiling (release builds).
+  Future<Map<String, dynamic>?> denoiseStats({bool reset = false}) async {
+    return _create(() => _instance.denoiseStats(_playerId, reset));
+  }
+
+  /// Packet counters of [addPacket]: received, reordered, late, duplicate and lostFrames.
+  Future<Map<String, dynamic>> jitterStats() async {
+    return _create(() => _instance.jitterStats(_playerId));
   }
 
   Future<void> dispose() async {
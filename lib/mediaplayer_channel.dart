@@ -36,6 +36,15 @@ class MediaPlayerChannel {
     });
   }
 
+  Future<void> addPacket(String playerId, Uint8List data, int sequence, int timestamp) async {
+    await _methodChannel.invokeMethod('addPacket', {
+      'playerId': playerId,
+      'bytes': data,
+      'sequence': sequence,
+      'timestamp': timestamp,
+    });
+  }
+
   Future<void> setJitterRange(String playerId, int min, int max) async {
     await _methodChannel.invokeMethod('jitter', {
       'playerId': playerId,
@@ -69,11 +78,27 @@ class MediaPlayerChannel {
     ) ?? false);
   }
 
-  Future<void> setDenoise(String playerId, DenoiseLevel level) async {
+  Future<void> setDenoise(String playerId, DenoiseLevel level, String? model) async {
     await _methodChannel.invokeMethod(
       'setDenoise',
-      {'playerId': playerId, 'level': level.index},
+      {'playerId': playerId, 'level': level.index, if (model != null) 'model': model},
+    );
+  }
+
+  Future<Map<String, dynamic>?> denoiseStats(String playerId, bool reset) async {
+    final stats = await _methodChannel.invokeMethod<Map<dynamic, dynamic>>(
+      'denoiseStats',
+      {'playerId': playerId, 'reset': reset},
+    );
+    return stats?.cast<String, dynamic>();
+  }
+
+  Future<Map<String, dynamic>> jitterStats(String playerId) async {
+    final stats = await _methodChannel.invokeMethod<Map<dynamic, dynamic>>(
+      'jitterStats',
+      {'playerId': playerId},
     );
+    return stats?.cast<String, dynamic>() ?? {};
   }
 
   Future<void> dispose(String playerId) async {
@@ -1,5 +1,6 @@
 import 'dart:async';
 import 'dart:typed_data';
+import 'package:socket_audiostream/mediaplayer.dart';
 import 'package:socket_audiostream/mediarecorder_channel.dart';
 import 'package:plugin_platform_interface/plugin_platform_interface.dart';
 
@@ -51,10 +52,21 @@ class MediaRecorder extends PlatformInterface {
     return _create(() => _instance.isReady(_recorderId));
   }
 
+  /// Denoise the captured audio before it reaches [stream] (mono builds). Runs on a worker
+  /// thread with 10 ms of added latency; may be changed while recording.
+  Future<void> setDenoise(DenoiseLevel level) async {
+    await _create(() => _instance.setDenoise(_recorderId, level));
+  }
+
   Stream<Uint8List> get stream {
     return _instance.stream(_recorderId);
   }
 
+  /// With denoise on: for each chunk of [stream], its speech probability (0..1) per 10 ms frame.
+  Stream<Float32List> get vad {
+    return _instance.vadStream(_recorderId);
+  }
+
   Future<void> dispose() async {
     if (_created) {
       _created = false;
@@ -1,4 +1,5 @@
 import 'package:flutter/services.dart';
+import 'package:socket_audiostream/mediaplayer.dart';
 
 class MediaRecorderChannel {
   final _methodChannel = const MethodChannel('com.softigent.audiostream.MediaRecorder');
@@ -56,6 +57,13 @@ class MediaRecorderChannel {
     ) ?? false);
   }
 
+  Future<void> setDenoise(String recorderId, DenoiseLevel level) async {
+    await _methodChannel.invokeMethod(
+      'setDenoise',
+      {'recorderId': recorderId, 'level': level.index},
+    );
+  }
+
   Future<void> dispose(String recorderId) async {
     await _methodChannel.invokeMethod(
       'dispose',
@@ -70,6 +78,13 @@ class MediaRecorderChannel {
     return recordEventChannel.receiveBroadcastStream().map<Uint8List>((data) => data);
   }
 
+  Stream<Float32List> vadStream(String recorderId) {
+    final vadEventChannel = EventChannel(
+      'com.softigent.audiostream/recordVad/$recorderId',
+    );
+    return vadEventChannel.receiveBroadcastStream().map<Float32List>((data) => data);
+  }
+
   Future<List<dynamic>> listDevices(String recorderId) async {
     return await _methodChannel.invokeMethod<dynamic>(
           'listDevices',
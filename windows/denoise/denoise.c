@@ -1,85 +1,171 @@
 #include <stdlib.h> // malloc, free
-#include <math.h>   // round, sqrtf, log10f
+#include <math.h>   // sqrtf, log10f
 
 #include "denoise.h"
+#include "pcm.h"
 #include "pitch.h"
+#include "x86cpu.h"
 
-// ERB-spaced band edges (in units of 50 Hz)
-int *eband20ms;
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h> // SRWLOCK
+static SRWLOCK shared_lock = SRWLOCK_INIT;
+#define SHARED_LOCK() AcquireSRWLockExclusive(&shared_lock)
+#define SHARED_UNLOCK() ReleaseSRWLockExclusive(&shared_lock)
+#else
+#include <pthread.h>
+static pthread_mutex_t shared_lock = PTHREAD_MUTEX_INITIALIZER;
+#define SHARED_LOCK() pthread_mutex_lock(&shared_lock)
+#define SHARED_UNLOCK() pthread_mutex_unlock(&shared_lock)
+#endif
 
-// Generate frequency band edges spaced according to the ERB scale (Equivalent Rectangular Bandwidth).
-// The result is 34 usable bands (for 32 bands + 2 endpoints), covering ~0 Hz to 20 kHz.
-// Units are in multiples of 50 Hz (i.e., 1 = 50 Hz, 20 = 1 kHz, 400 = 20 kHz).
-int *generate_eband20ms()
+// Everything the states share: one entry per model in use, built by the first state that
+// asks for it, freed with the last one and never written in between, so running states need
+// no locking. The FFT and band tables are static data (rnnoise_gen_tables.c) and need no setup.
+typedef struct SharedModel
 {
-  const size_t nb_edges = NB_BANDS + 2; // Start with 35 band edges (will later compress to 34)
-  int *asc = (int *)malloc(nb_edges * sizeof(int));
-  if (!asc)
-    return NULL;
+  struct SharedModel *next;
+  int refs;
+  char *path; // NULL for the built-in weights
+  RNNModelMap map;
+  RNNoise model;
+} SharedModel;
 
-  // Step 1: Generate descending ERB-spaced band edges starting from 20 kHz (400 * 50 Hz)
-  int v = 400; // 400 * 50 Hz = 20,000 Hz
-  for (size_t i = 0; i < nb_edges; i++)
-  {
-    double f_hz = v * 50.0;
-    double erb = 24.7 * (4.37 * f_hz / 1000.0 + 1.0); // Glasberg & Moore ERB formula
-    int step = (int)round(erb / 50.0);                // Convert ERB width back to 50 Hz units
-    if (step < 2)
-      step = 2; // Enforce minimum step size (100 Hz)
-    v -= step;
-    size_t index = nb_edges - 1 - i;
-    // Step 2: Merge 14 (700 Hz) and 16 (800 Hz) into 15 (750 Hz)
-    if (index >= 8)
-    {
-      asc[index] = v + step; // Shift all elements left to remove 800 Hz (index 8)
-    }
-    else
+static SharedModel *shared_models;
+
+static SharedModel *shared_load(const char *path, int *error)
+{
+  SharedModel *m = (SharedModel *)calloc(1, sizeof(SharedModel));
+  if (!m)
+  {
+    *error = RNN_MODEL_ERR_IO;
+    return NULL;
+  }
+  if (path == NULL)
+  {
+    if (init_rnnoise(&m->model, rnnoise_arrays) != 0)
     {
-      asc[index] = v; // Fill output array in reverse (ascending frequency)
+      *error = RNN_MODEL_ERR_LAYOUT;
+      free(m);
+      return NULL;
     }
+    // Aligned copy in kernel order; on failure the layers keep using the static arrays
+    rnnoise_repack(&m->model);
+    return m;
   }
-
-  return asc;
+  // A model file is already in kernel order and is used in place, shared through the page cache
+  size_t len = strlen(path) + 1;
+  m->path = (char *)malloc(len);
+  if (!m->path)
+  {
+    *error = RNN_MODEL_ERR_IO;
+    free(m);
+    return NULL;
+  }
+  if ((*error = rnn_model_map(&m->map, path)) != 0)
+  {
+    free(m->path);
+    free(m);
+    return NULL;
+  }
+  memcpy(m->path, path, len);
+  if ((*error = rnn_model_init(&m->model, m->map.data, m->map.size)) != 0)
+  {
+    rnn_model_unmap(&m->map);
+    free(m->path);
+    free(m);
+    return NULL;
+  }
+  return m;
 }
 
-DenoiseState *rnnoise_create(int full_denoise)
+static const RNNoise *shared_acquire(const char *path, int *error)
 {
-  FULL_DENOISE = full_denoise;
-  init_rnnnoise_tables();
-  eband20ms = generate_eband20ms();
-  DenoiseState *st = (DenoiseState *)malloc(sizeof(DenoiseState));
-  if (!st) return NULL;
-  memset(st, 0, sizeof(DenoiseState));  // Zero-initialize state
-  int ret = init_rnnoise(&st->model, rnnoise_arrays);
-  if (ret != 0)
+  SharedModel *m;
+  rnn_init_arch(); // pick the kernels used by every state
+  SHARED_LOCK();
+  for (m = shared_models; m != NULL; m = m->next)
   {
-    free(st);
-    return NULL;
+    if (path == NULL ? m->path == NULL : m->path != NULL && strcmp(m->path, path) == 0)
+      break;
   }
-  return st;
+  if (m == NULL)
+  {
+    m = shared_load(path, error);
+    if (m == NULL)
+    {
+      SHARED_UNLOCK();
+      return NULL;
+    }
+    m->next = shared_models;
+    shared_models = m;
+  }
+  m->refs++;
+  SHARED_UNLOCK();
+  return &m->model;
 }
 
-static void inverse_transform(float *out, const kiss_fft_cpx *in)
+static void shared_release(const RNNoise *model)
 {
-  int i;
-  kiss_fft_cpx x[WINDOW_SIZE];
-  kiss_fft_cpx y[WINDOW_SIZE];
-  for (i = 0; i < FREQ_SIZE; i++)
+  SHARED_LOCK();
+  for (SharedModel **link = &shared_models; *link != NULL; link = &(*link)->next)
   {
-    x[i] = in[i];
+    SharedModel *m = *link;
+    if (&m->model != model)
+      continue;
+    if (--m->refs == 0)
+    {
+      *link = m->next;
+      rnnoise_free_packed(&m->model);
+      rnn_model_unmap(&m->map);
+      free(m->path);
+      free(m);
+    }
+    break;
   }
-  for (; i < WINDOW_SIZE; i++)
+  SHARED_UNLOCK();
+}
+
+static DenoiseState *create_state(const char *model_path, int full_denoise, int *error)
+{
+  int err = 0;
+  DenoiseState *st = (DenoiseState *)malloc(sizeof(DenoiseState));
+  if (!st)
   {
-    x[i].r = x[WINDOW_SIZE - i].r;
-    x[i].i = -x[WINDOW_SIZE - i].i;
+    err = RNN_MODEL_ERR_IO;
   }
-  rnn_fft_c(&rnn_kfft, x, y);
-  /* output in reverse order for IFFT. */
-  out[0] = WINDOW_SIZE * y[0].r;
-  for (i = 1; i < WINDOW_SIZE; i++)
+  else
   {
-    out[i] = WINDOW_SIZE * y[WINDOW_SIZE - i].r;
+    memset(st, 0, sizeof(DenoiseState));  // Zero-initialize state
+    st->model = shared_acquire(model_path, &err);
+    if (st->model == NULL)
+    {
+      free(st);
+      st = NULL;
+    }
+    else
+    {
+      st->full_denoise = full_denoise;
+    }
   }
+  if (error)
+    *error = err;
+  return st;
+}
+
+DenoiseState *rnnoise_create(int full_denoise)
+{
+  return create_state(NULL, full_denoise, NULL);
+}
+
+DenoiseState *rnnoise_create_from_file(const char *model_path, int full_denoise, int *error)
+{
+  return create_state(model_path, full_denoise, error);
+}
+
+static void inverse_transform(float *out, const kiss_fft_cpx *in)
+{
+  rnn_ifftr(&rnn_kfft_half, in, out);
 }
 
 static void apply_window(float *x)
@@ -92,14 +178,23 @@ static void apply_window(float *x)
   }
 }
 
-static void frame_synthesis(DenoiseState *st, float *out, const kiss_fft_cpx *y)
+// Overlap-add into out, or rounded straight into out16 when that is set
+static void frame_synthesis(DenoiseState *st, float *out, opus_int16 *out16, const kiss_fft_cpx *y)
 {
   float x[WINDOW_SIZE];
   int i;
   inverse_transform(x, y);
   apply_window(x);
-  for (i = 0; i < FRAME_SIZE; i++)
-    out[i] = x[i] + st->synthesis_mem[i];
+  if (out16)
+  {
+    for (i = 0; i < FRAME_SIZE; i++)
+      out16[i] = rnn_float2s16(x[i] + st->synthesis_mem[i]);
+  }
+  else
+  {
+    for (i = 0; i < FRAME_SIZE; i++)
+      out[i] = x[i] + st->synthesis_mem[i];
+  }
   RNN_COPY(st->synthesis_mem, &x[FRAME_SIZE], FRAME_SIZE);
 }
 
@@ -231,19 +326,7 @@ static void compute_band_corr(float *bandE, const kiss_fft_cpx *X, const kiss_ff
 
 static void forward_transform(kiss_fft_cpx *out, const float *in)
 {
-  int i;
-  kiss_fft_cpx x[WINDOW_SIZE];
-  kiss_fft_cpx y[WINDOW_SIZE];
-  for (i = 0; i < WINDOW_SIZE; i++)
-  {
-    x[i].r = in[i];
-    x[i].i = 0;
-  }
-  rnn_fft_c(&rnn_kfft, x, y);
-  for (i = 0; i < FREQ_SIZE; i++)
-  {
-    out[i] = y[i];
-  }
+  rnn_fftr(&rnn_kfft_half, in, out);
 }
 
 void rnn_frame_analysis(DenoiseState *st, kiss_fft_cpx *X, float *Ex, const float *in)
@@ -259,8 +342,29 @@ void rnn_frame_analysis(DenoiseState *st, kiss_fft_cpx *X, float *Ex, const floa
   compute_band_energy(Ex, X);
 }
 
-void rnn_compute_frame_features(DenoiseState *st, kiss_fft_cpx *X, kiss_fft_cpx *P,
-                                float *Ex, float *Ep, float *Exp, float *features, const float *in)
+// Append a frame to the pitch history and return the PITCH_BUF_SIZE window ending with it. The
+// window slides forward through the slack in pitch_mem and is copied back to the front once
+// every PITCH_HIST_SLACK + 1 frames, instead of shifting the whole history on every frame. It
+// stays contiguous because the downsampler and the pitch spectrum read it as a plain array.
+static float *pitch_history_push(DenoiseState *st, const float *in)
+{
+  if (st->pitch_pos + FRAME_SIZE + PITCH_BUF_SIZE > PITCH_BUF_SIZE + PITCH_HIST_SLACK * FRAME_SIZE)
+  {
+    RNN_MOVE(st->pitch_mem, &st->pitch_mem[st->pitch_pos + FRAME_SIZE], PITCH_BUF_SIZE - FRAME_SIZE);
+    st->pitch_pos = 0;
+  }
+  else
+  {
+    st->pitch_pos += FRAME_SIZE;
+  }
+  float *hist = &st->pitch_mem[st->pitch_pos];
+  RNN_COPY(&hist[PITCH_BUF_SIZE - FRAME_SIZE], in, FRAME_SIZE);
+  return hist;
+}
+
+// Returns 1 for a silent frame, which only gets its spectrum and band energies
+int rnn_compute_frame_features(DenoiseState *st, kiss_fft_cpx *X, kiss_fft_cpx *P,
+                               float *Ex, float *Ep, float *Exp, float *features, const float *in)
 {
   int i;
   float E = 0;
@@ -272,20 +376,34 @@ void rnn_compute_frame_features(DenoiseState *st, kiss_fft_cpx *X, kiss_fft_cpx
   float *(pre[1]);
   float follow, logMax;
   rnn_frame_analysis(st, X, Ex, in);
-  RNN_MOVE(st->pitch_buf, &st->pitch_buf[FRAME_SIZE], PITCH_BUF_SIZE - FRAME_SIZE);
-  RNN_COPY(&st->pitch_buf[PITCH_BUF_SIZE - FRAME_SIZE], in, FRAME_SIZE);
-  pre[0] = &st->pitch_buf[0];
+  PROFILE_LAP(&st->profile, RNN_STAGE_ANALYSIS);
+  float *hist = pitch_history_push(st, in);
+  for (i = 0; i < NB_BANDS; i++)
+    E += Ex[i];
+  if (E < 0.04)
+  {
+    /* If there's no audio, avoid messing up the state. */
+    RNN_CLEAR(P, FREQ_SIZE);
+    RNN_CLEAR(Ep, NB_BANDS);
+    RNN_CLEAR(Exp, NB_BANDS);
+    RNN_CLEAR(features, NB_FEATURES);
+    return 1;
+  }
+  pre[0] = hist;
   rnn_pitch_downsample(pre, pitch_buf, PITCH_BUF_SIZE, 1);
+  PROFILE_LAP(&st->profile, RNN_STAGE_PITCH_DOWNSAMPLE);
   rnn_pitch_search(pitch_buf + (PITCH_MAX_PERIOD >> 1), pitch_buf, PITCH_FRAME_SIZE,
                    PITCH_MAX_PERIOD - 3 * PITCH_MIN_PERIOD, &pitch_index);
   pitch_index = PITCH_MAX_PERIOD - pitch_index;
+  PROFILE_LAP(&st->profile, RNN_STAGE_PITCH_SEARCH);
 
   gain = rnn_remove_doubling(pitch_buf, PITCH_MAX_PERIOD, PITCH_MIN_PERIOD,
                              PITCH_FRAME_SIZE, &pitch_index, st->last_period, st->last_gain);
   st->last_period = pitch_index;
   st->last_gain = gain;
+  PROFILE_LAP(&st->profile, RNN_STAGE_REMOVE_DOUBLING);
   for (i = 0; i < WINDOW_SIZE; i++)
-    p[i] = st->pitch_buf[PITCH_BUF_SIZE - WINDOW_SIZE - pitch_index + i];
+    p[i] = hist[PITCH_BUF_SIZE - WINDOW_SIZE - pitch_index + i];
   apply_window(p);
   forward_transform(P, p);
   compute_band_energy(Ep, P);
@@ -302,17 +420,11 @@ void rnn_compute_frame_features(DenoiseState *st, kiss_fft_cpx *X, kiss_fft_cpx
     Ly[i] = MAX(logMax - 7, MAX(follow - 1.5f, Ly[i]));
     logMax = MAX(logMax, Ly[i]);
     follow = MAX(follow - 1.5f, Ly[i]);
-    E += Ex[i];
-  }
-  if (E < 0.04)
-  {
-    /* If there's no audio, avoid messing up the state. */
-    RNN_CLEAR(features, NB_FEATURES);
-    return;
   }
   dct(features, Ly);
   features[0] -= 12;
   features[1] -= 4;
+  return 0;
 }
 
 void rnn_biquad(float *y, float mem[2], const float *x, const float *b, const float *a, int N)
@@ -329,58 +441,218 @@ void rnn_biquad(float *y, float mem[2], const float *x, const float *b, const fl
   }
 }
 
-float rnnoise_process_frame(DenoiseState *st, float *out, const float *in)
+// rnn_biquad() reading 16-bit samples, so the int16 API needs no separate conversion pass
+static void biquad_s16(float *y, float mem[2], const opus_int16 *x, const float *b, const float *a, int N)
 {
   int i;
-  kiss_fft_cpx X[FREQ_SIZE];
-  kiss_fft_cpx P[FREQ_SIZE];
+  for (i = 0; i < N; i++)
+  {
+    float xi, yi;
+    xi = (float)x[i];
+    yi = xi + mem[0];
+    mem[0] = mem[1] + (b[0] * xi - a[0] * yi);
+    mem[1] = (b[1] * xi - a[1] * yi);
+    y[i] = yi;
+  }
+}
+
+// Everything up to the network: high-pass, spectra, band energies and features. The input
+// is in, or in16 when that is set.
+static void frame_analysis(DenoiseState *st, const float *in, const opus_int16 *in16)
+{
+  DenoiseFrame *f = &st->frame;
   float x[FRAME_SIZE];
-  float Ex[NB_BANDS], Ep[NB_BANDS];
-  float Exp[NB_BANDS];
-  float features[NB_FEATURES];
-  float g[NB_BANDS];
-  float gf[FREQ_SIZE] = {1};
-  float vad_prob = 0; //  (Voice Activity Detection)
   static const float a_hp[2] = {-1.99599f, 0.99600f};
   static const float b_hp[2] = {-2, 1};
-  rnn_biquad(x, st->mem_hp_x, in, b_hp, a_hp, FRAME_SIZE);
-  rnn_compute_frame_features(st, X, P, Ex, Ep, Exp, features, x);
+  PROFILE_BEGIN(&st->profile);
+  if (in16)
+    biquad_s16(x, st->mem_hp_x, in16, b_hp, a_hp, FRAME_SIZE);
+  else
+    rnn_biquad(x, st->mem_hp_x, in, b_hp, a_hp, FRAME_SIZE);
+  f->silence = rnn_compute_frame_features(st, f->X, f->P, f->Ex, f->Ep, f->Exp, f->features, x);
+  PROFILE_LAP(&st->profile, RNN_STAGE_FEATURES);
+  f->vad_prob = 0;
+}
 
-  compute_rnn(&st->model, &st->rnn, g, &vad_prob, features);
-  rnn_pitch_filter(st->delayed_X, st->delayed_P, st->delayed_Ex, st->delayed_Ep, st->delayed_Exp, g);
-  for (i = 0; i < NB_BANDS; i++)
+// Network step for one state; silent frames only age the network state
+static void frame_rnn(DenoiseState *st)
+{
+  DenoiseFrame *f = &st->frame;
+  if (f->silence)
+    compute_rnn_silence(st->model, &st->rnn);
+  else
+    compute_rnn(st->model, &st->rnn, f->g, &f->vad_prob, f->features, st->full_denoise);
+  PROFILE_LAP(&st->profile, RNN_STAGE_RNN);
+}
+
+// Everything after the network: gains applied to the previous frame, then overlap-add into
+// out, or out16 when that is set
+static float frame_apply_gains(DenoiseState *st, float *out, opus_int16 *out16)
+{
+  int i;
+  DenoiseFrame *f = &st->frame;
+  float *g = f->g;
+  float gf[FREQ_SIZE] = {1};
+  PROFILE_RESUME(&st->profile);
+  if (f->silence)
   {
-    float alpha = .6f;
-    /* Cap the decay at 0.6 per frame, corresponding to an RT60 of 135 ms.
-       That avoids unnaturally quick attenuation. */
-    g[i] = MAX(g[i], alpha * st->lastg[i]);
-    /* Compensate for energy change across frame when computing the threshold gain.
-       Avoids leaking noise when energy increases (e.g. transient noise). */
-    st->lastg[i] = MIN(1.f, g[i] * (st->delayed_Ex[i] + 1e-3f) / (Ex[i] + 1e-3f));
+    // No network gains: the previous frame fades out at the 0.6 per frame decay cap
+    for (i = 0; i < NB_BANDS; i++)
+    {
+      g[i] = .6f * st->lastg[i];
+      st->lastg[i] = g[i];
+    }
   }
-  interp_band_gain(gf, g);
-  for (i = 0; i < FREQ_SIZE; i++)
+  else
   {
-    st->delayed_X[i].r *= gf[i];
-    st->delayed_X[i].i *= gf[i];
+    rnn_pitch_filter(st->delayed_X, st->delayed_P, st->delayed_Ex, st->delayed_Ep, st->delayed_Exp, g);
+    PROFILE_LAP(&st->profile, RNN_STAGE_PITCH_FILTER);
+    for (i = 0; i < NB_BANDS; i++)
+    {
+      float alpha = .6f;
+      /* Cap the decay at 0.6 per frame, corresponding to an RT60 of 135 ms.
+         That avoids unnaturally quick attenuation. */
+      g[i] = MAX(g[i], alpha * st->lastg[i]);
+      /* Compensate for energy change across frame when computing the threshold gain.
+         Avoids leaking noise when energy increases (e.g. transient noise). */
+      st->lastg[i] = MIN(1.f, g[i] * (st->delayed_Ex[i] + 1e-3f) / (f->Ex[i] + 1e-3f));
+    }
+  }
+  if (f->silence && st->delayed_silence)
+  {
+    // Both frames under the window are silent: the overlap-add tail is all that is left
+    if (out16)
+    {
+      for (i = 0; i < FRAME_SIZE; i++)
+        out16[i] = rnn_float2s16(st->synthesis_mem[i]);
+    }
+    else
+    {
+      RNN_COPY(out, st->synthesis_mem, FRAME_SIZE);
+    }
+    RNN_CLEAR(st->synthesis_mem, FRAME_SIZE);
+  }
+  else
+  {
+    interp_band_gain(gf, g);
+    for (i = 0; i < FREQ_SIZE; i++)
+    {
+      st->delayed_X[i].r *= gf[i];
+      st->delayed_X[i].i *= gf[i];
+    }
+    frame_synthesis(st, out, out16, st->delayed_X);
   }
-  frame_synthesis(st, out, st->delayed_X);
 
-  RNN_COPY(st->delayed_X, X, FREQ_SIZE);
-  RNN_COPY(st->delayed_P, P, FREQ_SIZE);
-  RNN_COPY(st->delayed_Ex, Ex, NB_BANDS);
-  RNN_COPY(st->delayed_Ep, Ep, NB_BANDS);
-  RNN_COPY(st->delayed_Exp, Exp, NB_BANDS);
-  return vad_prob;
+  RNN_COPY(st->delayed_X, f->X, FREQ_SIZE);
+  RNN_COPY(st->delayed_P, f->P, FREQ_SIZE);
+  RNN_COPY(st->delayed_Ex, f->Ex, NB_BANDS);
+  RNN_COPY(st->delayed_Ep, f->Ep, NB_BANDS);
+  RNN_COPY(st->delayed_Exp, f->Exp, NB_BANDS);
+  st->delayed_silence = f->silence;
+  PROFILE_LAP(&st->profile, RNN_STAGE_SYNTHESIS);
+  PROFILE_END(&st->profile);
+  return f->vad_prob;
 }
 
-void rnnoise_destroy(DenoiseState *st)
+float rnnoise_process_frame(DenoiseState *st, float *out, const float *in)
 {
-  free_rnnnoise_tables();
-  if (eband20ms)
+  frame_analysis(st, in, NULL);
+  frame_rnn(st);
+  return frame_apply_gains(st, out, NULL);
+}
+
+float rnnoise_process_frame_s16(DenoiseState *st, opus_int16 *out, const opus_int16 *in)
+{
+  frame_analysis(st, NULL, in);
+  frame_rnn(st);
+  return frame_apply_gains(st, NULL, out);
+}
+
+void rnnoise_process_frames(DenoiseState *const *st, float *const *out, const float *const *in, float *vad, int count)
+{
+  for (int start = 0; start < count; start += RNN_MAX_BATCH)
   {
-    free(eband20ms);
-    eband20ms = NULL;
+    const int n = MIN(RNN_MAX_BATCH, count - start);
+    DenoiseState *const *chunk = &st[start];
+    int done[RNN_MAX_BATCH] = {0};
+    for (int i = 0; i < n; i++)
+    {
+      frame_analysis(chunk[i], in[start + i], NULL);
+      if (chunk[i]->frame.silence)
+      {
+        frame_rnn(chunk[i]);
+        done[i] = 1;
+      }
+    }
+
+    // Streams with the same model and setting go through the network together
+    for (int i = 0; i < n; i++)
+    {
+      RNNState *rnn[RNN_MAX_BATCH];
+      float *gains[RNN_MAX_BATCH], *vad_prob[RNN_MAX_BATCH];
+      const float *features[RNN_MAX_BATCH];
+      int member[RNN_MAX_BATCH]; /* chunk index of each stream in the batch */
+      int K = 0;
+      if (done[i])
+        continue;
+      for (int j = i; j < n; j++)
+      {
+        if (done[j] || chunk[j]->model != chunk[i]->model || chunk[j]->full_denoise != chunk[i]->full_denoise)
+          continue;
+        rnn[K] = &chunk[j]->rnn;
+        gains[K] = chunk[j]->frame.g;
+        vad_prob[K] = &chunk[j]->frame.vad_prob;
+        features[K] = chunk[j]->frame.features;
+        member[K] = j;
+        done[j] = 1;
+        K++;
+      }
+#if defined(RNN_PROFILE)
+      unsigned long long t0 = rnn_ticks();
+#endif
+      compute_rnn_batch(chunk[i]->model, rnn, gains, vad_prob, features, K, chunk[i]->full_denoise);
+#if defined(RNN_PROFILE)
+      unsigned long long share = (rnn_ticks() - t0) / K;
+      for (int k = 0; k < K; k++)
+        PROFILE_ADD(&chunk[member[k]]->profile, RNN_STAGE_RNN, share);
+#else
+      (void)member;
+#endif
+    }
+
+    for (int i = 0; i < n; i++)
+    {
+      float v = frame_apply_gains(chunk[i], out[start + i], NULL);
+      if (vad)
+        vad[start + i] = v;
+    }
   }
+}
+
+int rnnoise_profile_stats(const DenoiseState *st, int stage, RNNProfileStats *stats)
+{
+#if defined(RNN_PROFILE)
+  return rnn_profile_stats(&st->profile, stage, stats);
+#else
+  (void)st;
+  return rnn_profile_stats(NULL, stage, stats);
+#endif
+}
+
+void rnnoise_profile_reset(DenoiseState *st)
+{
+#if defined(RNN_PROFILE)
+  memset(&st->profile, 0, sizeof(st->profile));
+#else
+  (void)st;
+#endif
+}
+
+void rnnoise_destroy(DenoiseState *st)
+{
+  if (!st)
+    return;
+  const RNNoise *model = st->model;
   free(st);
-}
\ No newline at end of file
+  shared_release(model);
+}
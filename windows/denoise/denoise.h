@@ -7,42 +7,109 @@ extern "C" {
 
 #include "kiss_fft.h"
 #include "nnet.h"
+#include "model.h"
+#include "profile.h"
 
-extern kiss_fft_state rnn_kfft;
+extern const int eband20ms[NB_BANDS + 2];
 extern const WeightArray *rnnoise_arrays;
 extern const float *rnn_dct_table;
 extern const float *rnn_half_window;
 
+// Per-frame analysis results, kept in the state so a batch of states can go through
+// the network together between analysis and synthesis
+typedef struct
+{
+  kiss_fft_cpx X[FREQ_SIZE];
+  kiss_fft_cpx P[FREQ_SIZE];
+  float Ex[NB_BANDS], Ep[NB_BANDS], Exp[NB_BANDS];
+  float features[NB_FEATURES];
+  float g[NB_BANDS];
+  float vad_prob;
+  int silence; // band energy below the silence threshold: no pitch search, no network
+} DenoiseFrame;
+
+// Frames of headroom behind the pitch history window, see pitch_history_push()
+#define PITCH_HIST_SLACK 4
+
 typedef struct
 {
   kiss_fft_cpx delayed_X[FREQ_SIZE];
   kiss_fft_cpx delayed_P[FREQ_SIZE];
 
-  RNNoise model;
+  const RNNoise *model; // Shared and read-only, owned by the refcounted context
   RNNState rnn;
-  
+  int full_denoise;
+
   int last_period;
   float last_gain;
   float mem_hp_x[2];
   float lastg[NB_BANDS];
   float analysis_mem[FRAME_SIZE];
   float synthesis_mem[FRAME_SIZE];
-  float pitch_buf[PITCH_BUF_SIZE];
+  float pitch_mem[PITCH_BUF_SIZE + PITCH_HIST_SLACK * FRAME_SIZE]; // history window is pitch_mem + pitch_pos
+  int pitch_pos;
   float delayed_Ex[NB_BANDS], delayed_Ep[NB_BANDS], delayed_Exp[NB_BANDS];
+  int delayed_silence;
+  DenoiseFrame frame;
+#if defined(RNN_PROFILE)
+  RNNProfile profile;
+#endif
 } DenoiseState;
 
 /**
- * Denoise a frame of samples
+ * Denoise a frame of samples. Frames whose band energy is below the silence threshold skip
+ * the pitch search and the network: the previous frame fades out at the gain decay cap and
+ * the network state decays (compute_rnn_silence), and two silent frames in a row skip the
+ * inverse FFT too.
  */
 float rnnoise_process_frame(DenoiseState *st, float *out, const float *in);
 
 /**
- * Allocate and initialize a DenoiseState
+ * rnnoise_process_frame() on 16-bit samples: the conversion happens in the high-pass filter
+ * and the overlap-add, and the output is rounded to nearest and saturated, so it equals the
+ * float call followed by rnn_interleave_s16(). in and out may alias.
+ */
+float rnnoise_process_frame_s16(DenoiseState *st, opus_int16 *out, const opus_int16 *in);
+
+/**
+ * Denoise one frame for each of count independent states: out[i] and in[i] belong to st[i],
+ * vad (may be NULL) receives one probability per state. States sharing a model and setting
+ * run the network together as matrix-matrix products, so the weights are read once per
+ * RNN_MAX_BATCH streams. Each state gets exactly what rnnoise_process_frame() would give.
+ */
+void rnnoise_process_frames(DenoiseState *const *st, float *const *out, const float *const *in, float *vad, int count);
+
+/**
+ * Allocate and initialize a DenoiseState. The built-in network weights are set up by the
+ * first call and shared by every state, so states can be created and destroyed from any
+ * thread; each state must only be used by one thread at a time. full_denoise is kept per
+ * state.
  */
 DenoiseState *rnnoise_create(int full_denoise);
 
 /**
- * Free a DenoiseState produced by rnnoise_create.
+ * rnnoise_create() with the network from a model file (model.h) instead of the built-in
+ * weights. The file is mapped read-only and used in place; states created from the same path
+ * share one mapping, and other processes mapping it share its pages. Returns NULL on failure
+ * with an RNN_MODEL_ERR_ code in *error (error may be NULL).
+ */
+DenoiseState *rnnoise_create_from_file(const char *model_path, int full_denoise, int *error);
+
+/**
+ * Per-frame tick percentiles for one RNNStage of this state (TSC cycles on x86). Returns -1
+ * when the counters are compiled out (release builds) or the stage is out of range. Not
+ * synchronized: call it from the thread that processes the state, or under the same lock.
+ */
+int rnnoise_profile_stats(const DenoiseState *st, int stage, RNNProfileStats *stats);
+
+/**
+ * Clear the state's stage histograms.
+ */
+void rnnoise_profile_reset(DenoiseState *st);
+
+/**
+ * Free a DenoiseState produced by rnnoise_create or rnnoise_create_from_file. A model goes
+ * with the last state using it.
  */
 void rnnoise_destroy(DenoiseState *st);
 
@@ -1,4 +1,5 @@
 #include "kiss_fft.h"
+#include "x86cpu.h"
 
 #define MULBYSCALAR(c, s) \
    do                     \
@@ -28,6 +29,38 @@
       (res).i = ADD((res).i, (a).i); \
    } while (0)
 
+static void kf_bfly2(kiss_fft_cpx *Fout, int m, int N)
+{
+   kiss_fft_cpx *Fout2;
+   const float_t tw = 0.7071067812f;
+   /* We know that m == 4 here because the radix-2 is just after a radix-4 */
+   (void)m;
+   for (int i = 0; i < N; i++)
+   {
+      kiss_fft_cpx t;
+      Fout2 = Fout + 4;
+      t = Fout2[0];
+      OP(Fout2[0], Fout[0], t, SUB);
+      ADDTO(Fout[0], t);
+
+      t.r = MULT(ADD(Fout2[1].r, Fout2[1].i), tw);
+      t.i = MULT(SUB(Fout2[1].i, Fout2[1].r), tw);
+      OP(Fout2[1], Fout[1], t, SUB);
+      ADDTO(Fout[1], t);
+
+      t.r = Fout2[2].i;
+      t.i = NEG(Fout2[2].r);
+      OP(Fout2[2], Fout[2], t, SUB);
+      ADDTO(Fout[2], t);
+
+      t.r = MULT(SUB(Fout2[3].i, Fout2[3].r), tw);
+      t.i = MULT(NEG(ADD(Fout2[3].r, Fout2[3].i)), tw);
+      OP(Fout2[3], Fout[3], t, SUB);
+      ADDTO(Fout[3], t);
+      Fout += 8;
+   }
+}
+
 static void kf_bfly3(kiss_fft_cpx *Fout, const int fstride, const kiss_fft_state *st, int m, int N, int mm)
 {
    const int m2 = 2 * m;
@@ -198,19 +231,86 @@ static void kf_bfly5(kiss_fft_cpx *Fout, const int fstride, const kiss_fft_state
    }
 }
 
+// Floats used by one stage in the split twiddle table (the m == 1 radix-4 needs none)
+static int split_stage_size(int p, int m)
+{
+   if (p == 3 || p == 5 || (p == 4 && m > 1))
+      return (p - 1) * 4 * m;
+   return 0;
+}
+
+int rnn_fft_split_twiddles_size(const kiss_fft_state *st)
+{
+   int size = 0, L = 0, m;
+   do
+   {
+      m = st->factors[2 * L + 1];
+      size += split_stage_size(st->factors[2 * L], m);
+      L++;
+   } while (m != 1);
+   return size;
+}
+
+void rnn_fft_split_twiddles(const kiss_fft_state *st, float *split)
+{
+   int p, m, L = 0;
+   int fstride = 1 << (st->shift > 0 ? st->shift : 0);
+   do
+   {
+      p = st->factors[2 * L];
+      m = st->factors[2 * L + 1];
+      if (split_stage_size(p, m) != 0)
+      {
+         for (int k = 1; k < p; k++)
+         {
+            for (int u = 0; u < m; u++)
+            {
+               kiss_fft_cpx t = st->twiddles[k * u * fstride];
+               split[2 * u] = split[2 * u + 1] = t.r;
+               split[2 * m + 2 * u] = split[2 * m + 2 * u + 1] = t.i;
+            }
+            split += 4 * m;
+         }
+      }
+      fstride *= p;
+      L++;
+   } while (m != 1);
+}
+
+#if defined(RNN_X86)
+// Kernel level for a stage: 4 complex values per AVX register, 2 per SSE register.
+// The twiddle-free radix-4 takes one sub-transform per SSE step.
+static int bfly_arch(const kiss_fft_state *st, int p, int m)
+{
+   int arch = rnn_arch;
+   if (st->split_twiddles == NULL || p == 2)
+      return RNN_ARCH_C;
+   if (m == 1)
+      return p == 4 ? MIN(arch, RNN_ARCH_SSE4_1) : RNN_ARCH_C;
+   if (arch == RNN_ARCH_AVX2 && (m & 3) != 0)
+      arch = RNN_ARCH_SSE4_1;
+   if (arch == RNN_ARCH_SSE4_1 && (m & 1) != 0)
+      arch = RNN_ARCH_C;
+   return arch;
+}
+#endif
+
 void rnn_fft_impl(const kiss_fft_state *st, kiss_fft_cpx *fout)
 {
    int m2, m, p, i, L;
    int fstride[MAXFACTORS];
+   int split_offset[MAXFACTORS];
    int shift = st->shift > 0 ? st->shift : 0;
 
    fstride[0] = 1;
+   split_offset[0] = 0;
    L = 0;
    do
    {
       p = st->factors[2 * L];
       m = st->factors[2 * L + 1];
       fstride[L + 1] = fstride[L] * p;
+      split_offset[L + 1] = split_offset[L] + split_stage_size(p, m);
       L++;
    } while (m != 1);
    m = st->factors[2 * L - 1];
@@ -220,8 +320,42 @@ void rnn_fft_impl(const kiss_fft_state *st, kiss_fft_cpx *fout)
          m2 = st->factors[2 * i - 1];
       else
          m2 = 1;
+#if defined(RNN_X86)
+      const int arch = bfly_arch(st, st->factors[2 * i], m);
+      const float *tw = st->split_twiddles + split_offset[i];
+      const int fs = fstride[i] << shift;
+      if (arch != RNN_ARCH_C)
+      {
+         switch (st->factors[2 * i])
+         {
+         case 3:
+            if (arch == RNN_ARCH_AVX2)
+               kf_bfly3_avx2(fout, tw, st->twiddles[fs * m], m, fstride[i], m2);
+            else
+               kf_bfly3_sse4_1(fout, tw, st->twiddles[fs * m], m, fstride[i], m2);
+            break;
+         case 4:
+            if (arch == RNN_ARCH_AVX2)
+               kf_bfly4_avx2(fout, tw, m, fstride[i], m2);
+            else
+               kf_bfly4_sse4_1(fout, tw, m, fstride[i], m2);
+            break;
+         case 5:
+            if (arch == RNN_ARCH_AVX2)
+               kf_bfly5_avx2(fout, tw, st->twiddles[fs * m], st->twiddles[fs * 2 * m], m, fstride[i], m2);
+            else
+               kf_bfly5_sse4_1(fout, tw, st->twiddles[fs * m], st->twiddles[fs * 2 * m], m, fstride[i], m2);
+            break;
+         }
+         m = m2;
+         continue;
+      }
+#endif
       switch (st->factors[2 * i])
       {
+      case 2:
+         kf_bfly2(fout, m, fstride[i]);
+         break;
       case 3:
          kf_bfly3(fout, fstride[i] << shift, st, m, fstride[i], m2);
          break;
@@ -247,4 +381,87 @@ void rnn_fft_c(const kiss_fft_state *st, const kiss_fft_cpx *fin, kiss_fft_cpx *
       fout[st->bitrev[i]].i = MULT(scale, x.i);
    }
    rnn_fft_impl(st, fout);
-}
\ No newline at end of file
+}
+
+/* Real FFT: the even samples go in the real parts and the odd samples in the imaginary
+   parts of an nfft/2 complex FFT, then one pass splits the two spectra apart again.
+   st->twiddles are those of the nfft-point transform (st->shift == 1), so twiddles[k]
+   is also the e^(-2*pi*i*k/nfft) factor of the split. */
+void rnn_fftr(const kiss_fft_state *st, const float *fin, kiss_fft_cpx *fout)
+{
+   const int N2 = st->nfft;
+   const float_t scale = st->scale;
+   for (int i = 0; i < N2; i++)
+   {
+      fout[st->bitrev[i]].r = MULT(scale, fin[2 * i]);
+      fout[st->bitrev[i]].i = MULT(scale, fin[2 * i + 1]);
+   }
+   rnn_fft_impl(st, fout);
+
+   kiss_fft_cpx dc = fout[0];
+   fout[0].r = ADD(dc.r, dc.i);
+   fout[0].i = 0;
+   fout[N2].r = SUB(dc.r, dc.i);
+   fout[N2].i = 0;
+   for (int k = 1; k <= N2 / 2; k++)
+   {
+      /* Bins k and N2 - k are built from the same pair of FFT outputs */
+      kiss_fft_cpx a = fout[k];
+      kiss_fft_cpx b = fout[N2 - k];
+      kiss_fft_cpx f1k, f2k, tw;
+      f1k.r = ADD(a.r, b.r);
+      f1k.i = SUB(a.i, b.i);
+      f2k.r = SUB(a.r, b.r);
+      f2k.i = ADD(a.i, b.i);
+      MUL(tw, f2k, st->twiddles[k]);
+      fout[k].r = HALF(ADD(f1k.r, tw.i));
+      fout[k].i = HALF(SUB(f1k.i, tw.r));
+      if (k != N2 - k)
+      {
+         /* Mirror pair: conj(Z[k]) and conj(Z[N2 - k]) swap roles, and W^(N2 - k) = -conj(W^k) */
+         f2k.r = SUB(b.r, a.r);
+         f2k.i = ADD(b.i, a.i);
+         kiss_fft_cpx w = st->twiddles[N2 - k];
+         MUL(tw, f2k, w);
+         fout[N2 - k].r = HALF(ADD(f1k.r, tw.i));
+         fout[N2 - k].i = HALF(SUB(NEG(f1k.i), tw.r));
+      }
+   }
+}
+
+/* Inverse of rnn_fftr() without the 1/nfft scaling: fin holds the nfft/2 + 1 bins of
+   a real signal and fout receives its nfft samples. fout doubles as the complex work
+   buffer, so it must not overlap fin. */
+void rnn_ifftr(const kiss_fft_state *st, const kiss_fft_cpx *fin, float *fout)
+{
+   const int N2 = st->nfft;
+   kiss_fft_cpx *buf = (kiss_fft_cpx *)fout;
+
+   /* DC and Nyquist are real; the even/odd spectra meet at bin 0 */
+   buf[st->bitrev[0]].r = ADD(fin[0].r, fin[N2].r);
+   buf[st->bitrev[0]].i = SUB(fin[0].r, fin[N2].r);
+   for (int k = 1; k < N2; k++)
+   {
+      kiss_fft_cpx a = fin[k];
+      kiss_fft_cpx b = fin[N2 - k];
+      kiss_fft_cpx f2k, tw, w;
+      /* (X[k] - conj(X[N2 - k])) * conj(W^k) */
+      f2k.r = SUB(a.r, b.r);
+      f2k.i = ADD(a.i, b.i);
+      w.r = st->twiddles[k].r;
+      w.i = NEG(st->twiddles[k].i);
+      MUL(tw, f2k, w);
+      /* (X[k] + conj(X[N2 - k])) + i * tw */
+      buf[st->bitrev[k]].r = SUB(ADD(a.r, b.r), tw.i);
+      buf[st->bitrev[k]].i = ADD(SUB(a.i, b.i), tw.r);
+   }
+   rnn_fft_impl(st, buf);
+
+   /* A forward FFT of the spectrum gives the samples in reverse order */
+   for (int n = 1; n < N2 - n; n++)
+   {
+      kiss_fft_cpx t = buf[n];
+      buf[n] = buf[N2 - n];
+      buf[N2 - n] = t;
+   }
+}
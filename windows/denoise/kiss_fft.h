@@ -14,14 +14,43 @@ typedef struct {
    float_t scale;
    int shift;
    opus_int16 factors[2 * MAXFACTORS];
-   opus_int32 *bitrev;
-   kiss_fft_cpx *twiddles;
+   const opus_int32 *bitrev;
+   const kiss_fft_cpx *twiddles;
+   const float *split_twiddles; /* Per-stage SIMD copy of twiddles, see rnn_fft_split_twiddles() */
 } kiss_fft_state;
 
 void rnn_fft_c(const kiss_fft_state *cfg, const kiss_fft_cpx *fin, kiss_fft_cpx *fout);
 
-// rnnoise_tables.c
-void init_rnnnoise_tables();
-void free_rnnnoise_tables();
+/**
+ * Number of floats in the SIMD twiddle table of cfg, and the table itself. For each radix-3/4/5
+ * stage (in factor order) and each k = 1 .. p - 1, the m twiddles of that stage are stored as
+ * all real parts then all imaginary parts, each value twice, so vector loads are contiguous.
+ * cfg->twiddles must already be filled in.
+ */
+int rnn_fft_split_twiddles_size(const kiss_fft_state *cfg);
+void rnn_fft_split_twiddles(const kiss_fft_state *cfg, float *split);
+
+/**
+ * Real-input FFT of cfg->nfft * 2 samples, using cfg as the packed half-size complex FFT.
+ * fout receives cfg->nfft + 1 bins, scaled by cfg->scale.
+ */
+void rnn_fftr(const kiss_fft_state *cfg, const float *fin, kiss_fft_cpx *fout);
+
+/**
+ * Unscaled inverse of rnn_fftr(): cfg->nfft + 1 bins in, cfg->nfft * 2 real samples out.
+ */
+void rnn_ifftr(const kiss_fft_state *cfg, const kiss_fft_cpx *fin, float *fout);
+
+// kiss_fft_sse4_1.c, kiss_fft_avx2.c: butterflies over the split twiddles, bit-exact with the scalar ones
+void kf_bfly3_sse4_1(kiss_fft_cpx *Fout, const float *tw, kiss_fft_cpx epi3, int m, int N, int mm);
+void kf_bfly4_sse4_1(kiss_fft_cpx *Fout, const float *tw, int m, int N, int mm);
+void kf_bfly5_sse4_1(kiss_fft_cpx *Fout, const float *tw, kiss_fft_cpx ya, kiss_fft_cpx yb, int m, int N, int mm);
+void kf_bfly3_avx2(kiss_fft_cpx *Fout, const float *tw, kiss_fft_cpx epi3, int m, int N, int mm);
+void kf_bfly4_avx2(kiss_fft_cpx *Fout, const float *tw, int m, int N, int mm);
+void kf_bfly5_avx2(kiss_fft_cpx *Fout, const float *tw, kiss_fft_cpx ya, kiss_fft_cpx yb, int m, int N, int mm);
+
+// rnnoise_gen_tables.c, generated by tools/gen_tables.c
+extern const kiss_fft_state rnn_kfft;
+extern const kiss_fft_state rnn_kfft_half;
 
 #endif /* KISS_FFT_H */
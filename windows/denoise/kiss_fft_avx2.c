@@ -0,0 +1,112 @@
+#include "kiss_fft.h"
+#include "x86cpu.h"
+
+#if defined(RNN_X86)
+#include <immintrin.h> // AVX
+
+/* Four complex values per register; same layout and operation order as kiss_fft_sse4_1.c.
+   Built for AVX without FMA so that no multiply-add gets fused and the output stays
+   bit-identical to the scalar butterflies. Needs m to be a multiple of 4. */
+#define CSWAP(a) _mm256_permute_ps(a, _MM_SHUFFLE(2, 3, 0, 1))
+
+RNN_TARGET_AVX
+static inline __m256 cmul(__m256 a, const float *twr, const float *twi)
+{
+   return _mm256_addsub_ps(_mm256_mul_ps(a, _mm256_loadu_ps(twr)), _mm256_mul_ps(CSWAP(a), _mm256_loadu_ps(twi)));
+}
+
+// (r, i) -> (i, -r), i.e. multiply by -i
+RNN_TARGET_AVX
+static inline __m256 mul_neg_i(__m256 a)
+{
+   return _mm256_xor_ps(CSWAP(a), _mm256_setr_ps(0.f, -0.f, 0.f, -0.f, 0.f, -0.f, 0.f, -0.f));
+}
+
+RNN_TARGET_AVX
+void kf_bfly3_avx2(kiss_fft_cpx *Fout, const float *tw, kiss_fft_cpx epi3, int m, int N, int mm)
+{
+   const __m256 half = _mm256_set1_ps(.5f);
+   const __m256 epi = _mm256_set1_ps(epi3.i);
+   const float *tw1r = tw, *tw1i = tw + 2 * m, *tw2r = tw + 4 * m, *tw2i = tw + 6 * m;
+   for (int i = 0; i < N; i++)
+   {
+      float *F = (float *)(Fout + i * mm);
+      for (int u = 0; u < 2 * m; u += 8)
+      {
+         __m256 f0 = _mm256_loadu_ps(&F[u]);
+         __m256 s1 = cmul(_mm256_loadu_ps(&F[2 * m + u]), &tw1r[u], &tw1i[u]);
+         __m256 s2 = cmul(_mm256_loadu_ps(&F[4 * m + u]), &tw2r[u], &tw2i[u]);
+         __m256 s3 = _mm256_add_ps(s1, s2);
+         __m256 s0 = _mm256_mul_ps(_mm256_sub_ps(s1, s2), epi);
+         __m256 fm = _mm256_sub_ps(f0, _mm256_mul_ps(half, s3));
+         _mm256_storeu_ps(&F[u], _mm256_add_ps(f0, s3));
+         _mm256_storeu_ps(&F[4 * m + u], _mm256_add_ps(fm, mul_neg_i(s0)));
+         _mm256_storeu_ps(&F[2 * m + u], _mm256_addsub_ps(fm, CSWAP(s0)));
+      }
+   }
+}
+
+RNN_TARGET_AVX
+void kf_bfly4_avx2(kiss_fft_cpx *Fout, const float *tw, int m, int N, int mm)
+{
+   const float *tw1r = tw, *tw1i = tw + 2 * m, *tw2r = tw + 4 * m, *tw2i = tw + 6 * m;
+   const float *tw3r = tw + 8 * m, *tw3i = tw + 10 * m;
+   for (int i = 0; i < N; i++)
+   {
+      float *F = (float *)(Fout + i * mm);
+      for (int u = 0; u < 2 * m; u += 8)
+      {
+         __m256 f0 = _mm256_loadu_ps(&F[u]);
+         __m256 s0 = cmul(_mm256_loadu_ps(&F[2 * m + u]), &tw1r[u], &tw1i[u]);
+         __m256 s1 = cmul(_mm256_loadu_ps(&F[4 * m + u]), &tw2r[u], &tw2i[u]);
+         __m256 s2 = cmul(_mm256_loadu_ps(&F[6 * m + u]), &tw3r[u], &tw3i[u]);
+         __m256 s5 = _mm256_sub_ps(f0, s1);
+         f0 = _mm256_add_ps(f0, s1);
+         __m256 s3 = _mm256_add_ps(s0, s2);
+         __m256 s4 = _mm256_sub_ps(s0, s2);
+         _mm256_storeu_ps(&F[4 * m + u], _mm256_sub_ps(f0, s3));
+         _mm256_storeu_ps(&F[u], _mm256_add_ps(f0, s3));
+         _mm256_storeu_ps(&F[2 * m + u], _mm256_add_ps(s5, mul_neg_i(s4)));
+         _mm256_storeu_ps(&F[6 * m + u], _mm256_addsub_ps(s5, CSWAP(s4)));
+      }
+   }
+}
+
+RNN_TARGET_AVX
+void kf_bfly5_avx2(kiss_fft_cpx *Fout, const float *tw, kiss_fft_cpx ya, kiss_fft_cpx yb, int m, int N, int mm)
+{
+   const __m256 yar = _mm256_set1_ps(ya.r), yai = _mm256_set1_ps(ya.i);
+   const __m256 ybr = _mm256_set1_ps(yb.r), ybi = _mm256_set1_ps(yb.i);
+   const float *tw1r = tw, *tw1i = tw + 2 * m, *tw2r = tw + 4 * m, *tw2i = tw + 6 * m;
+   const float *tw3r = tw + 8 * m, *tw3i = tw + 10 * m, *tw4r = tw + 12 * m, *tw4i = tw + 14 * m;
+   for (int i = 0; i < N; i++)
+   {
+      float *F = (float *)(Fout + i * mm);
+      for (int u = 0; u < 2 * m; u += 8)
+      {
+         __m256 s0 = _mm256_loadu_ps(&F[u]);
+         __m256 s1 = cmul(_mm256_loadu_ps(&F[2 * m + u]), &tw1r[u], &tw1i[u]);
+         __m256 s2 = cmul(_mm256_loadu_ps(&F[4 * m + u]), &tw2r[u], &tw2i[u]);
+         __m256 s3 = cmul(_mm256_loadu_ps(&F[6 * m + u]), &tw3r[u], &tw3i[u]);
+         __m256 s4 = cmul(_mm256_loadu_ps(&F[8 * m + u]), &tw4r[u], &tw4i[u]);
+
+         __m256 s7 = _mm256_add_ps(s1, s4);
+         __m256 s10 = _mm256_sub_ps(s1, s4);
+         __m256 s8 = _mm256_add_ps(s2, s3);
+         __m256 s9 = _mm256_sub_ps(s2, s3);
+
+         _mm256_storeu_ps(&F[u], _mm256_add_ps(s0, _mm256_add_ps(s7, s8)));
+
+         __m256 s5 = _mm256_add_ps(s0, _mm256_add_ps(_mm256_mul_ps(s7, yar), _mm256_mul_ps(s8, ybr)));
+         __m256 s6 = mul_neg_i(_mm256_add_ps(_mm256_mul_ps(s10, yai), _mm256_mul_ps(s9, ybi)));
+         _mm256_storeu_ps(&F[2 * m + u], _mm256_sub_ps(s5, s6));
+         _mm256_storeu_ps(&F[8 * m + u], _mm256_add_ps(s5, s6));
+
+         __m256 s11 = _mm256_add_ps(s0, _mm256_add_ps(_mm256_mul_ps(s7, ybr), _mm256_mul_ps(s8, yar)));
+         __m256 s12 = mul_neg_i(_mm256_sub_ps(_mm256_mul_ps(s9, yai), _mm256_mul_ps(s10, ybi)));
+         _mm256_storeu_ps(&F[4 * m + u], _mm256_add_ps(s11, s12));
+         _mm256_storeu_ps(&F[6 * m + u], _mm256_sub_ps(s11, s12));
+      }
+   }
+}
+#endif
@@ -0,0 +1,131 @@
+#include "kiss_fft.h"
+#include "x86cpu.h"
+
+#if defined(RNN_X86)
+#include <smmintrin.h> // SSE4.1, SSE3
+
+/* Two complex values per register, interleaved as r0 i0 r1 i1. The split twiddles hold
+   each real and imaginary part twice, so one load gives the matching wr0 wr0 wr1 wr1.
+   Every lane does the same mul/add sequence as kiss_fft.c, so results are bit-identical. */
+#define CSWAP(a) _mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 3, 0, 1))
+
+RNN_TARGET_SSE4_1
+static inline __m128 cmul(__m128 a, const float *twr, const float *twi)
+{
+   return _mm_addsub_ps(_mm_mul_ps(a, _mm_loadu_ps(twr)), _mm_mul_ps(CSWAP(a), _mm_loadu_ps(twi)));
+}
+
+// (r, i) -> (i, -r), i.e. multiply by -i
+RNN_TARGET_SSE4_1
+static inline __m128 mul_neg_i(__m128 a)
+{
+   return _mm_xor_ps(CSWAP(a), _mm_setr_ps(0.f, -0.f, 0.f, -0.f));
+}
+
+RNN_TARGET_SSE4_1
+void kf_bfly3_sse4_1(kiss_fft_cpx *Fout, const float *tw, kiss_fft_cpx epi3, int m, int N, int mm)
+{
+   const __m128 half = _mm_set1_ps(.5f);
+   const __m128 epi = _mm_set1_ps(epi3.i);
+   const float *tw1r = tw, *tw1i = tw + 2 * m, *tw2r = tw + 4 * m, *tw2i = tw + 6 * m;
+   for (int i = 0; i < N; i++)
+   {
+      float *F = (float *)(Fout + i * mm);
+      for (int u = 0; u < 2 * m; u += 4)
+      {
+         __m128 f0 = _mm_loadu_ps(&F[u]);
+         __m128 s1 = cmul(_mm_loadu_ps(&F[2 * m + u]), &tw1r[u], &tw1i[u]);
+         __m128 s2 = cmul(_mm_loadu_ps(&F[4 * m + u]), &tw2r[u], &tw2i[u]);
+         __m128 s3 = _mm_add_ps(s1, s2);
+         __m128 s0 = _mm_mul_ps(_mm_sub_ps(s1, s2), epi);
+         __m128 fm = _mm_sub_ps(f0, _mm_mul_ps(half, s3));
+         _mm_storeu_ps(&F[u], _mm_add_ps(f0, s3));
+         _mm_storeu_ps(&F[4 * m + u], _mm_add_ps(fm, mul_neg_i(s0)));
+         _mm_storeu_ps(&F[2 * m + u], _mm_addsub_ps(fm, CSWAP(s0)));
+      }
+   }
+}
+
+RNN_TARGET_SSE4_1
+void kf_bfly4_sse4_1(kiss_fft_cpx *Fout, const float *tw, int m, int N, int mm)
+{
+   if (m == 1)
+   {
+      /* Degenerate case where all the twiddles are 1: F0 F1 in one register, F2 F3 in the other */
+      for (int i = 0; i < N; i++)
+      {
+         float *F = (float *)(Fout + 4 * i);
+         __m128 a = _mm_loadu_ps(&F[0]);
+         __m128 b = _mm_loadu_ps(&F[4]);
+         __m128 s = _mm_add_ps(a, b); // F0 + F2, F1 + F3
+         __m128 d = _mm_sub_ps(a, b); // F0 - F2, F1 - F3
+         __m128 x = _mm_movelh_ps(s, d);
+         __m128 y = _mm_shuffle_ps(s, d, _MM_SHUFFLE(2, 3, 3, 2));
+         __m128 p = _mm_add_ps(x, y);
+         __m128 q = _mm_sub_ps(x, y);
+         _mm_storeu_ps(&F[0], _mm_blend_ps(p, q, 0x8));
+         _mm_storeu_ps(&F[4], _mm_blend_ps(q, p, 0x8));
+      }
+      return;
+   }
+   const float *tw1r = tw, *tw1i = tw + 2 * m, *tw2r = tw + 4 * m, *tw2i = tw + 6 * m;
+   const float *tw3r = tw + 8 * m, *tw3i = tw + 10 * m;
+   for (int i = 0; i < N; i++)
+   {
+      float *F = (float *)(Fout + i * mm);
+      for (int u = 0; u < 2 * m; u += 4)
+      {
+         __m128 f0 = _mm_loadu_ps(&F[u]);
+         __m128 s0 = cmul(_mm_loadu_ps(&F[2 * m + u]), &tw1r[u], &tw1i[u]);
+         __m128 s1 = cmul(_mm_loadu_ps(&F[4 * m + u]), &tw2r[u], &tw2i[u]);
+         __m128 s2 = cmul(_mm_loadu_ps(&F[6 * m + u]), &tw3r[u], &tw3i[u]);
+         __m128 s5 = _mm_sub_ps(f0, s1);
+         f0 = _mm_add_ps(f0, s1);
+         __m128 s3 = _mm_add_ps(s0, s2);
+         __m128 s4 = _mm_sub_ps(s0, s2);
+         _mm_storeu_ps(&F[4 * m + u], _mm_sub_ps(f0, s3));
+         _mm_storeu_ps(&F[u], _mm_add_ps(f0, s3));
+         _mm_storeu_ps(&F[2 * m + u], _mm_add_ps(s5, mul_neg_i(s4)));
+         _mm_storeu_ps(&F[6 * m + u], _mm_addsub_ps(s5, CSWAP(s4)));
+      }
+   }
+}
+
+RNN_TARGET_SSE4_1
+void kf_bfly5_sse4_1(kiss_fft_cpx *Fout, const float *tw, kiss_fft_cpx ya, kiss_fft_cpx yb, int m, int N, int mm)
+{
+   const __m128 yar = _mm_set1_ps(ya.r), yai = _mm_set1_ps(ya.i);
+   const __m128 ybr = _mm_set1_ps(yb.r), ybi = _mm_set1_ps(yb.i);
+   const float *tw1r = tw, *tw1i = tw + 2 * m, *tw2r = tw + 4 * m, *tw2i = tw + 6 * m;
+   const float *tw3r = tw + 8 * m, *tw3i = tw + 10 * m, *tw4r = tw + 12 * m, *tw4i = tw + 14 * m;
+   for (int i = 0; i < N; i++)
+   {
+      float *F = (float *)(Fout + i * mm);
+      for (int u = 0; u < 2 * m; u += 4)
+      {
+         __m128 s0 = _mm_loadu_ps(&F[u]);
+         __m128 s1 = cmul(_mm_loadu_ps(&F[2 * m + u]), &tw1r[u], &tw1i[u]);
+         __m128 s2 = cmul(_mm_loadu_ps(&F[4 * m + u]), &tw2r[u], &tw2i[u]);
+         __m128 s3 = cmul(_mm_loadu_ps(&F[6 * m + u]), &tw3r[u], &tw3i[u]);
+         __m128 s4 = cmul(_mm_loadu_ps(&F[8 * m + u]), &tw4r[u], &tw4i[u]);
+
+         __m128 s7 = _mm_add_ps(s1, s4);
+         __m128 s10 = _mm_sub_ps(s1, s4);
+         __m128 s8 = _mm_add_ps(s2, s3);
+         __m128 s9 = _mm_sub_ps(s2, s3);
+
+         _mm_storeu_ps(&F[u], _mm_add_ps(s0, _mm_add_ps(s7, s8)));
+
+         __m128 s5 = _mm_add_ps(s0, _mm_add_ps(_mm_mul_ps(s7, yar), _mm_mul_ps(s8, ybr)));
+         __m128 s6 = mul_neg_i(_mm_add_ps(_mm_mul_ps(s10, yai), _mm_mul_ps(s9, ybi)));
+         _mm_storeu_ps(&F[2 * m + u], _mm_sub_ps(s5, s6));
+         _mm_storeu_ps(&F[8 * m + u], _mm_add_ps(s5, s6));
+
+         __m128 s11 = _mm_add_ps(s0, _mm_add_ps(_mm_mul_ps(s7, ybr), _mm_mul_ps(s8, yar)));
+         __m128 s12 = mul_neg_i(_mm_sub_ps(_mm_mul_ps(s9, yai), _mm_mul_ps(s10, ybi)));
+         _mm_storeu_ps(&F[4 * m + u], _mm_add_ps(s11, s12));
+         _mm_storeu_ps(&F[6 * m + u], _mm_sub_ps(s11, s12));
+      }
+   }
+}
+#endif
@@ -0,0 +1,369 @@
+#include <stdlib.h> // malloc, calloc, free
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h> // CreateFileMappingW, MapViewOfFile
+#else
+#include <fcntl.h>    // open
+#include <unistd.h>   // close
+#include <sys/mman.h> // mmap
+#include <sys/stat.h> // fstat
+#endif
+
+#include "model.h"
+
+typedef char header_size_check[sizeof(RNNModelHeader) == 64 ? 1 : -1];
+typedef char layer_size_check[sizeof(RNNModelLayer) == 88 ? 1 : -1];
+
+#define ALIGN_UP(n) (((n) + RNN_MODEL_ALIGN - 1) & ~(size_t)(RNN_MODEL_ALIGN - 1))
+#define DATA_START ALIGN_UP(sizeof(RNNModelHeader) + RNN_MODEL_LAYERS * sizeof(RNNModelLayer))
+
+// Slot names, in the order of rnnoise_layer()
+static const char *const layer_names[RNN_MODEL_LAYERS] = {
+    "conv1", "conv2",
+    "gru1_input", "gru1_recurrent",
+    "gru2_input", "gru2_recurrent",
+    "gru3_input", "gru3_recurrent",
+    "dense_out", "vad_dense"};
+
+// CRC-32, zlib polynomial, four bits at a time
+static uint32_t crc32_update(uint32_t crc, const unsigned char *p, size_t n)
+{
+  static const uint32_t table[16] = {
+      0x00000000, 0x1db71064, 0x3b6e20c8, 0x26d930ac, 0x76dc4190, 0x6b6b51f4, 0x4db26158, 0x5005713c,
+      0xedb88320, 0xf00f9344, 0xd6d6a3e8, 0xcb61b38c, 0x9b64c2b0, 0x86d3d2d4, 0xa00ae278, 0xbdbdf21c};
+  crc = ~crc;
+  while (n--)
+  {
+    crc ^= *p++;
+    crc = (crc >> 4) ^ table[crc & 15];
+    crc = (crc >> 4) ^ table[crc & 15];
+  }
+  return ~crc;
+}
+
+#if defined(_WIN32)
+int rnn_model_map(RNNModelMap *map, const char *path)
+{
+  memset(map, 0, sizeof(*map));
+  int n = MultiByteToWideChar(CP_UTF8, 0, path, -1, NULL, 0);
+  wchar_t *wpath = n > 0 ? (wchar_t *)malloc(n * sizeof(wchar_t)) : NULL;
+  if (!wpath)
+    return RNN_MODEL_ERR_IO;
+  MultiByteToWideChar(CP_UTF8, 0, path, -1, wpath, n);
+  HANDLE file = CreateFileW(wpath, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+  free(wpath);
+  if (file == INVALID_HANDLE_VALUE)
+    return RNN_MODEL_ERR_IO;
+  LARGE_INTEGER size;
+  HANDLE mapping = NULL;
+  const void *data = NULL;
+  if (GetFileSizeEx(file, &size) && size.QuadPart > 0)
+    mapping = CreateFileMappingW(file, NULL, PAGE_READONLY, 0, 0, NULL);
+  if (mapping)
+    data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+  if (!data)
+  {
+    if (mapping)
+      CloseHandle(mapping);
+    CloseHandle(file);
+    return RNN_MODEL_ERR_IO;
+  }
+  map->data = (const unsigned char *)data;
+  map->size = (size_t)size.QuadPart;
+  map->file = file;
+  map->mapping = mapping;
+  return 0;
+}
+
+void rnn_model_unmap(RNNModelMap *map)
+{
+  if (map->data)
+  {
+    UnmapViewOfFile(map->data);
+    CloseHandle((HANDLE)map->mapping);
+    CloseHandle((HANDLE)map->file);
+  }
+  memset(map, 0, sizeof(*map));
+}
+#else
+int rnn_model_map(RNNModelMap *map, const char *path)
+{
+  memset(map, 0, sizeof(*map));
+  int fd = open(path, O_RDONLY);
+  if (fd < 0)
+    return RNN_MODEL_ERR_IO;
+  struct stat sb;
+  void *data = MAP_FAILED;
+  if (fstat(fd, &sb) == 0 && sb.st_size > 0)
+    data = mmap(NULL, (size_t)sb.st_size, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd); // the mapping keeps the file open
+  if (data == MAP_FAILED)
+    return RNN_MODEL_ERR_IO;
+  map->data = (const unsigned char *)data;
+  map->size = (size_t)sb.st_size;
+  return 0;
+}
+
+void rnn_model_unmap(RNNModelMap *map)
+{
+  if (map->data)
+    munmap((void *)map->data, map->size);
+  memset(map, 0, sizeof(*map));
+}
+#endif
+
+// Pointer to a section of expected size (0 = must be absent), NULL if absent or invalid
+static const void *section(const unsigned char *data, size_t size, const RNNModelSection *s, size_t expect, int *error)
+{
+  if (s->size == 0)
+    return NULL;
+  if (s->size != expect || s->offset % RNN_MODEL_ALIGN != 0 || s->offset < DATA_START ||
+      (size_t)s->offset + s->size > size)
+  {
+    *error = 1;
+    return NULL;
+  }
+  return data + s->offset;
+}
+
+// Walks the sparse index like find_idx_check() in nnet.c; returns the block count or -1
+static int check_idx(const int *idx, int words, int nb_inputs, int nb_outputs, const int *group_blocks)
+{
+  int blocks = 0;
+  for (int g = 0; g < nb_outputs / 8; g++)
+  {
+    if (words < 1 || group_blocks[g] != blocks)
+      return -1;
+    const int count = *idx++;
+    words--;
+    if (count < 0 || count > words)
+      return -1;
+    for (int j = 0; j < count; j++)
+    {
+      const int pos = *idx++;
+      if (pos < 0 || pos + 3 >= nb_inputs || (pos & 0x3))
+        return -1;
+    }
+    words -= count;
+    blocks += count;
+  }
+  return words == 0 && group_blocks[nb_outputs / 8] == blocks ? blocks : -1;
+}
+
+static int layer_init(LinearLayer *layer, const RNNModelLayer *e, const char *name, const unsigned char *data, size_t size)
+{
+  const int M = e->nb_inputs;
+  const int N = e->nb_outputs;
+  const RNNModelSection *s = e->sections;
+  int err = 0;
+
+  if (strncmp(e->name, name, sizeof(e->name)) != 0 || M <= 0 || N <= 0 || M > MAX_INPUTS || N > 3 * MAX_NEURONS)
+    return 1;
+  memset(layer, 0, sizeof(*layer));
+  layer->nb_inputs = M;
+  layer->nb_outputs = N;
+  layer->bias = (const float *)section(data, size, &s[RNN_SECTION_BIAS], (size_t)N * sizeof(float), &err);
+  layer->diag = (const float *)section(data, size, &s[RNN_SECTION_DIAG], (size_t)N * sizeof(float), &err);
+  layer->scale = (const float *)section(data, size, &s[RNN_SECTION_SCALE], (size_t)N * sizeof(float), &err);
+
+  if (s[RNN_SECTION_IDX].size != 0)
+  {
+    if (N % 8 != 0 || e->panel_rows != 0)
+      return 1;
+    const int groups = N / 8;
+    layer->group_blocks = (const int *)section(data, size, &s[RNN_SECTION_GROUP_BLOCKS], (size_t)(groups + 1) * sizeof(int), &err);
+    layer->weights_idx = (const int *)section(data, size, &s[RNN_SECTION_IDX], s[RNN_SECTION_IDX].size, &err);
+    if (err || !layer->group_blocks || s[RNN_SECTION_IDX].size % sizeof(int) != 0)
+      return 1;
+    const int blocks = check_idx(layer->weights_idx, (int)(s[RNN_SECTION_IDX].size / sizeof(int)), M, N, layer->group_blocks);
+    if (blocks < 0)
+      return 1;
+    layer->weights = (const opus_int8 *)section(data, size, &s[RNN_SECTION_WEIGHTS], (size_t)blocks * 32, &err);
+    layer->float_weights = (const float *)section(data, size, &s[RNN_SECTION_FLOAT_WEIGHTS], (size_t)blocks * 32 * sizeof(float), &err);
+  }
+  else
+  {
+    const int P = e->panel_rows;
+    if (s[RNN_SECTION_GROUP_BLOCKS].size != 0 || (P != 0 && P != 8 && P != 16) || (P != 0 && N % P != 0))
+      return 1;
+    layer->panel_rows = P;
+    layer->weights = (const opus_int8 *)section(data, size, &s[RNN_SECTION_WEIGHTS], (size_t)M * N, &err);
+    layer->float_weights = (const float *)section(data, size, &s[RNN_SECTION_FLOAT_WEIGHTS], (size_t)M * N * sizeof(float), &err);
+    if (layer->weights && (N % 8 != 0 || M % 4 != 0))
+      return 1;
+  }
+  if (err || (!layer->weights && !layer->float_weights) || (layer->weights && !layer->scale) ||
+      (layer->panel_rows != 0 && !layer->float_weights))
+    return 1;
+  return 0;
+}
+
+// Layer shapes must chain together and fit the RNNState buffers
+static int check_shapes(const RNNoise *m)
+{
+  const int C1 = RNN_CONV1_SIZE(m), C2 = RNN_CONV2_SIZE(m), G = RNN_GRU_SIZE(m);
+  const LinearLayer *gru_in[3] = {&m->gru1_input, &m->gru2_input, &m->gru3_input};
+  const LinearLayer *gru_rec[3] = {&m->gru1_recurrent, &m->gru2_recurrent, &m->gru3_recurrent};
+  if (C1 > RNN_MAX_CONV_SIZE || C2 > RNN_MAX_CONV_SIZE || G > RNN_MAX_GRU_SIZE)
+    return 1;
+  if (m->conv1.nb_inputs != CONV1_STATE_SIZE + CONV1_IN_SIZE || m->conv2.nb_inputs != 3 * C1)
+    return 1;
+  for (int i = 0; i < 3; i++)
+  {
+    if (gru_in[i]->nb_inputs != (i == 0 ? C2 : G) || gru_in[i]->nb_outputs != 3 * G ||
+        gru_rec[i]->nb_inputs != G || gru_rec[i]->nb_outputs != 3 * G)
+      return 1;
+  }
+  if (m->dense_out.nb_inputs != C2 + 3 * G || m->dense_out.nb_outputs != NB_BANDS ||
+      m->vad_dense.nb_inputs != C2 + 3 * G || m->vad_dense.nb_outputs != 1)
+    return 1;
+  return 0;
+}
+
+int rnn_model_init(RNNoise *model, const void *data, size_t size)
+{
+  const unsigned char *p = (const unsigned char *)data;
+  const RNNModelHeader *h = (const RNNModelHeader *)data;
+
+  if (size < DATA_START || memcmp(h->magic, RNN_MODEL_MAGIC, sizeof(h->magic)) != 0)
+    return RNN_MODEL_ERR_FORMAT;
+  if (h->version != RNN_MODEL_VERSION)
+    return RNN_MODEL_ERR_VERSION;
+  if (h->header_size != sizeof(RNNModelHeader) || h->layer_count != RNN_MODEL_LAYERS || h->file_size != size)
+    return RNN_MODEL_ERR_FORMAT;
+  if (crc32_update(0, p + h->header_size, size - h->header_size) != h->checksum)
+    return RNN_MODEL_ERR_CHECKSUM;
+  if (((uintptr_t)data & 3) != 0)
+    return RNN_MODEL_ERR_LAYOUT;
+
+  const RNNModelLayer *entries = (const RNNModelLayer *)(p + h->header_size);
+  memset(model, 0, sizeof(*model));
+  for (int i = 0; i < RNN_MODEL_LAYERS; i++)
+  {
+    if (layer_init(rnnoise_layer(model, i), &entries[i], layer_names[i], p, size) != 0)
+      return RNN_MODEL_ERR_LAYOUT;
+  }
+  return check_shapes(model) ? RNN_MODEL_ERR_LAYOUT : 0;
+}
+
+// Bytes of each section of a layer, in file order
+static void section_sizes(const LinearLayer *layer, size_t *sizes)
+{
+  const size_t M = (size_t)layer->nb_inputs;
+  const size_t N = (size_t)layer->nb_outputs;
+  memset(sizes, 0, RNN_SECTION_COUNT * sizeof(sizes[0]));
+  size_t weights = M * N;
+  if (layer->weights_idx != NULL)
+  {
+    size_t blocks = 0, words = 0;
+    for (size_t g = 0; g < N / 8; g++)
+    {
+      const size_t count = (size_t)layer->weights_idx[words];
+      words += count + 1;
+      blocks += count;
+    }
+    weights = blocks * 32;
+    sizes[RNN_SECTION_IDX] = words * sizeof(int);
+    sizes[RNN_SECTION_GROUP_BLOCKS] = (N / 8 + 1) * sizeof(int);
+  }
+  sizes[RNN_SECTION_BIAS] = layer->bias ? N * sizeof(float) : 0;
+  sizes[RNN_SECTION_WEIGHTS] = layer->weights ? weights : 0;
+  sizes[RNN_SECTION_FLOAT_WEIGHTS] = layer->float_weights ? weights * sizeof(float) : 0;
+  sizes[RNN_SECTION_DIAG] = layer->diag ? N * sizeof(float) : 0;
+  sizes[RNN_SECTION_SCALE] = layer->scale ? N * sizeof(float) : 0;
+}
+
+// Copy one section; group_blocks is rebuilt from the index when the layer was not repacked
+static void section_copy(unsigned char *dst, const LinearLayer *layer, int id, size_t size)
+{
+  const void *src = NULL;
+  switch (id)
+  {
+  case RNN_SECTION_BIAS: src = layer->bias; break;
+  case RNN_SECTION_WEIGHTS: src = layer->weights; break;
+  case RNN_SECTION_FLOAT_WEIGHTS: src = layer->float_weights; break;
+  case RNN_SECTION_IDX: src = layer->weights_idx; break;
+  case RNN_SECTION_DIAG: src = layer->diag; break;
+  case RNN_SECTION_SCALE: src = layer->scale; break;
+  case RNN_SECTION_GROUP_BLOCKS:
+    if (layer->group_blocks == NULL)
+    {
+      int *gb = (int *)dst;
+      const int *idx = layer->weights_idx;
+      gb[0] = 0;
+      for (int g = 0; g < layer->nb_outputs / 8; g++)
+      {
+        gb[g + 1] = gb[g] + *idx;
+        idx += *idx + 1;
+      }
+      return;
+    }
+    src = layer->group_blocks;
+    break;
+  }
+  memcpy(dst, src, size);
+}
+
+int rnn_model_write(FILE *f, const RNNoise *model)
+{
+  size_t sizes[RNN_MODEL_LAYERS][RNN_SECTION_COUNT];
+  size_t total = DATA_START;
+  for (int i = 0; i < RNN_MODEL_LAYERS; i++)
+  {
+    section_sizes(rnnoise_layer((RNNoise *)model, i), sizes[i]);
+    for (int s = 0; s < RNN_SECTION_COUNT; s++)
+      total += ALIGN_UP(sizes[i][s]);
+  }
+  if (total > 0xffffffffu)
+    return RNN_MODEL_ERR_IO;
+
+  unsigned char *file = (unsigned char *)calloc(1, total);
+  if (!file)
+    return RNN_MODEL_ERR_IO;
+  RNNModelHeader *h = (RNNModelHeader *)file;
+  RNNModelLayer *entries = (RNNModelLayer *)(file + sizeof(RNNModelHeader));
+  size_t offset = DATA_START;
+  for (int i = 0; i < RNN_MODEL_LAYERS; i++)
+  {
+    const LinearLayer *layer = rnnoise_layer((RNNoise *)model, i);
+    RNNModelLayer *e = &entries[i];
+    strncpy(e->name, layer_names[i], sizeof(e->name));
+    e->nb_inputs = layer->nb_inputs;
+    e->nb_outputs = layer->nb_outputs;
+    e->panel_rows = layer->panel_rows;
+    for (int s = 0; s < RNN_SECTION_COUNT; s++)
+    {
+      if (sizes[i][s] == 0)
+        continue;
+      e->sections[s].offset = (uint32_t)offset;
+      e->sections[s].size = (uint32_t)sizes[i][s];
+      section_copy(file + offset, layer, s, sizes[i][s]);
+      offset += ALIGN_UP(sizes[i][s]);
+    }
+  }
+  memcpy(h->magic, RNN_MODEL_MAGIC, sizeof(h->magic));
+  h->version = RNN_MODEL_VERSION;
+  h->header_size = sizeof(RNNModelHeader);
+  h->layer_count = RNN_MODEL_LAYERS;
+  h->file_size = total;
+  h->checksum = crc32_update(0, file + sizeof(RNNModelHeader), total - sizeof(RNNModelHeader));
+
+  int ret = fwrite(file, 1, total, f) == total ? 0 : RNN_MODEL_ERR_IO;
+  free(file);
+  return ret;
+}
+
+const char *rnn_model_strerror(int error)
+{
+  switch (error)
+  {
+  case 0: return "ok";
+  case RNN_MODEL_ERR_IO: return "cannot open, map or write the model file";
+  case RNN_MODEL_ERR_FORMAT: return "not a model file, or truncated";
+  case RNN_MODEL_ERR_VERSION: return "unsupported model file version";
+  case RNN_MODEL_ERR_CHECKSUM: return "model file checksum mismatch";
+  case RNN_MODEL_ERR_LAYOUT: return "model layers do not fit this build";
+  default: return "unknown error";
+  }
+}
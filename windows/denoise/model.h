@@ -0,0 +1,111 @@
+#ifndef MODEL_H
+#define MODEL_H
+
+#include <stdio.h>  // FILE
+#include <stddef.h> // size_t
+
+#include "rnn.h"
+
+/*
+ * Binary model file, all fields little-endian:
+ *
+ *   RNNModelHeader                      64 bytes
+ *   RNNModelLayer[RNN_MODEL_LAYERS]     slot i holds layer i of RNNoise, in struct order
+ *   sections                            each starting on an RNN_MODEL_ALIGN boundary
+ *
+ * The weights are stored in the order the kernels read them (the layout rnnoise_repack()
+ * builds), so a mapped file is used in place: nothing is parsed or copied, and every process
+ * that maps the same file shares its pages. Finding a layer is an index into the slot table.
+ * The checksum is the CRC-32 (zlib polynomial) of everything after the header. Layer sizes
+ * come from the file, up to RNN_MAX_CONV_SIZE / RNN_MAX_GRU_SIZE.
+ */
+#define RNN_MODEL_MAGIC "RNNMODEL"
+#define RNN_MODEL_VERSION 1
+#define RNN_MODEL_ALIGN 64
+#define RNN_MODEL_LAYERS 10
+
+// rnn_model_map() / rnn_model_init() errors
+#define RNN_MODEL_ERR_IO -1       // cannot open or map the file
+#define RNN_MODEL_ERR_FORMAT -2   // not a model file, or truncated
+#define RNN_MODEL_ERR_VERSION -3  // written by a newer (or older) tools release
+#define RNN_MODEL_ERR_CHECKSUM -4 // corrupted
+#define RNN_MODEL_ERR_LAYOUT -5   // a section or layer size does not fit this build
+
+typedef enum
+{
+  RNN_SECTION_BIAS,          // float[nb_outputs]
+  RNN_SECTION_WEIGHTS,       // int8 8x4 blocks
+  RNN_SECTION_FLOAT_WEIGHTS, // float panels of panel_rows rows, or 8x4 blocks for sparse layers
+  RNN_SECTION_IDX,           // sparse layers: per 8-row group, a block count then column positions
+  RNN_SECTION_GROUP_BLOCKS,  // sparse layers: first block of each group, then the total
+  RNN_SECTION_DIAG,          // float[nb_outputs]
+  RNN_SECTION_SCALE,         // float[nb_outputs], required with int8 weights
+  RNN_SECTION_COUNT
+} RNNModelSectionId;
+
+typedef struct
+{
+  uint32_t offset; // bytes from the start of the file
+  uint32_t size;   // bytes, 0 when the layer has no such array
+} RNNModelSection;
+
+typedef struct
+{
+  char name[16]; // "conv1", "gru1_input", ... must match the slot
+  int32_t nb_inputs;
+  int32_t nb_outputs;
+  int32_t panel_rows; // see LinearLayer
+  int32_t reserved;
+  RNNModelSection sections[RNN_SECTION_COUNT];
+} RNNModelLayer;
+
+typedef struct
+{
+  char magic[8];        // RNN_MODEL_MAGIC, not NUL-terminated
+  uint32_t version;     // RNN_MODEL_VERSION
+  uint32_t header_size; // sizeof(RNNModelHeader)
+  uint32_t layer_count; // RNN_MODEL_LAYERS
+  uint32_t checksum;
+  uint64_t file_size;
+  uint32_t reserved[8];
+} RNNModelHeader;
+
+// A read-only view of a model file
+typedef struct
+{
+  const unsigned char *data;
+  size_t size;
+#if defined(_WIN32)
+  void *file;    // HANDLE
+  void *mapping; // HANDLE
+#endif
+} RNNModelMap;
+
+/**
+ * Map a model file read-only (path is UTF-8). Returns 0 or RNN_MODEL_ERR_IO.
+ */
+int rnn_model_map(RNNModelMap *map, const char *path);
+
+void rnn_model_unmap(RNNModelMap *map);
+
+/**
+ * Validate a model image (header, checksum, every section and layer size) and point the
+ * layers of model into it. data must stay valid while the model is in use and be at least
+ * 4-byte aligned; a mapping is page-aligned, which keeps every section 64-byte aligned.
+ * Returns 0 or one of the RNN_MODEL_ERR_ codes.
+ */
+int rnn_model_init(RNNoise *model, const void *data, size_t size);
+
+/**
+ * Write a model file. Repacked layers (rnnoise_repack()) are stored as they are in memory,
+ * so the file can be used in place; the others keep the exported layout.
+ * Returns 0, or RNN_MODEL_ERR_IO if memory runs out or the write fails.
+ */
+int rnn_model_write(FILE *f, const RNNoise *model);
+
+/**
+ * Short description of an RNN_MODEL_ERR_ code.
+ */
+const char *rnn_model_strerror(int error);
+
+#endif /* MODEL_H */
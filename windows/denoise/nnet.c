@@ -1,6 +1,5 @@
-#include <math.h> // floorf
-
 #include "nnet.h"
+#include "x86cpu.h"
 
 // Vector multiply-add for blocks of 8 or 16
 #define SGEMV_LOOP(N)                                   \
@@ -16,31 +15,30 @@
    }
 
 // compute_generic helper functions
-static inline void process_quantized_block(float *y, const opus_int8 *w, const opus_int8 *x, int j)
+// Row-major 8x4 block: row r reads w[4 * r .. 4 * r + 3]
+static inline void int8_block_rows(opus_int32 *acc, const opus_int8 *w, const opus_int8 *x)
 {
-   const int xj[4] = {x[j], x[j + 1], x[j + 2], x[j + 3]};
-   if (!FULL_DENOISE)
-   {
-      for (int r = 0; r < 8; ++r)
-         for (int c = 0; c < 4; ++c)
-            y[r] += (float)(w[8 * c + r] * xj[c]);
-   }
-   else
-   {
-      /* Process each row in the 8-row block */
-      y[0] += (float)(w[0] * xj[0] + w[1] * xj[1] + w[2] * xj[2] + w[3] * xj[3]);
-      y[1] += (float)(w[4] * xj[0] + w[5] * xj[1] + w[6] * xj[2] + w[7] * xj[3]);
-      y[2] += (float)(w[8] * xj[0] + w[9] * xj[1] + w[10] * xj[2] + w[11] * xj[3]);
-      y[3] += (float)(w[12] * xj[0] + w[13] * xj[1] + w[14] * xj[2] + w[15] * xj[3]);
-      y[4] += (float)(w[16] * xj[0] + w[17] * xj[1] + w[18] * xj[2] + w[19] * xj[3]);
-      y[5] += (float)(w[20] * xj[0] + w[21] * xj[1] + w[22] * xj[2] + w[23] * xj[3]);
-      y[6] += (float)(w[24] * xj[0] + w[25] * xj[1] + w[26] * xj[2] + w[27] * xj[3]);
-      y[7] += (float)(w[28] * xj[0] + w[29] * xj[1] + w[30] * xj[2] + w[31] * xj[3]);
-   }
+   const int x0 = x[0], x1 = x[1], x2 = x[2], x3 = x[3];
+   for (int r = 0; r < 8; ++r, w += 4)
+      acc[r] += w[0] * x0 + w[1] * x1 + w[2] * x2 + w[3] * x3;
+}
+
+// Column-major 8x4 block: row r reads w[r], w[8 + r], w[16 + r], w[24 + r]
+static inline void int8_block_cols(opus_int32 *acc, const opus_int8 *w, const opus_int8 *x)
+{
+   const int x0 = x[0], x1 = x[1], x2 = x[2], x3 = x[3];
+   for (int r = 0; r < 8; ++r)
+      acc[r] += w[r] * x0 + w[8 + r] * x1 + w[16 + r] * x2 + w[24 + r] * x3;
+}
+
+void quantize_input_c(opus_int8 *x, const float *_x, int n)
+{
+   for (int i = 0; i < n; i++)
+      x[i] = quantize_activation(_x[i]);
 }
 
 // General SGEMV
-static inline void sgemv(float *out, const float *weights, int rows, int cols, int col_stride, const float *x)
+void sgemv_c(float *out, const float *weights, int rows, int cols, int col_stride, const float *x)
 {
    int i, j;
    RNN_CLEAR(out, rows);
@@ -60,7 +58,7 @@ static inline void sgemv(float *out, const float *weights, int rows, int cols, i
 }
 
 // Sparse SGEMV 8x4 (unrolled)
-static inline void sparse_sgemv8x4(float *out, const float *w, const int *idx, int rows, const float *x)
+void sparse_sgemv8x4_c(float *out, const float *w, const int *idx, int rows, const float *x)
 {
    RNN_CLEAR(out, rows);
    for (int i = 0; i < rows; i += 8)
@@ -78,52 +76,190 @@ static inline void sparse_sgemv8x4(float *out, const float *w, const int *idx, i
    }
 }
 
-// Compressed sparse GEMV 8x4 (8-bit weights, quantized inputs)
-static inline void sparse_cgemv8x4(float *out, const opus_int8 *w, const int *idx, const float *scale, int rows, int cols, const float *_x)
-{
-   opus_int8 x[MAX_INPUTS];
-   for (int i = 0; i < cols; i++)
-      x[i] = (opus_int8)floorf(.5f + 127 * _x[i]);
+#if defined(RNN_X86)
+static void (*const SGEMV_IMPL[RNN_ARCH_COUNT])(float *out, const float *weights, int rows, int cols, int col_stride, const float *x) = {
+    sgemv_c,   // C
+    sgemv_c,   // SSE4.1
+    sgemv_avx2 // AVX2
+};
+
+static void (*const SPARSE_SGEMV8X4_IMPL[RNN_ARCH_COUNT])(float *out, const float *w, const int *idx, int rows, const float *x) = {
+    sparse_sgemv8x4_c,   // C
+    sparse_sgemv8x4_c,   // SSE4.1
+    sparse_sgemv8x4_avx2 // AVX2
+};
 
-   for (int i = 0; i < rows; i++)
-      out[i] = 0;
+#define sgemv(out, weights, rows, cols, col_stride, x) ((*SGEMV_IMPL[rnn_arch])(out, weights, rows, cols, col_stride, x))
+#define sparse_sgemv8x4(out, w, idx, rows, x) ((*SPARSE_SGEMV8X4_IMPL[rnn_arch])(out, w, idx, rows, x))
+#else
+#define sgemv sgemv_c
+#define sparse_sgemv8x4 sparse_sgemv8x4_c
+#endif
 
+// Compressed sparse GEMV 8x4 (8-bit weights, quantized inputs, int32 accumulation)
+void sparse_cgemv8x4_c(float *out, const opus_int8 *w, const int *idx, const float *scale, int rows, const opus_int8 *x, int row_major)
+{
    for (int i = 0; i < rows; i += 8)
    {
+      opus_int32 acc[8] = {0};
       int blocks = *idx++;
-      for (int j = 0; j < blocks; j++, w += 32)
+      if (row_major)
       {
-         int pos = *idx++;
-         process_quantized_block(&out[i], w, x, pos);
+         for (int j = 0; j < blocks; j++, w += 32)
+            int8_block_rows(acc, w, &x[*idx++]);
+      }
+      else
+      {
+         for (int j = 0; j < blocks; j++, w += 32)
+            int8_block_cols(acc, w, &x[*idx++]);
       }
+      for (int r = 0; r < 8; r++)
+         out[i + r] = (float)acc[r] * scale[i + r];
    }
+}
 
-   for (int i = 0; i < rows; i++)
-      out[i] *= scale[i];
+// Dense CGEMV 8x4 (8-bit weights, quantized inputs, int32 accumulation)
+void cgemv8x4_c(float *out, const opus_int8 *w, const float *scale, int rows, int cols, const opus_int8 *x, int row_major)
+{
+   for (int i = 0; i < rows; i += 8)
+   {
+      opus_int32 acc[8] = {0};
+      if (row_major)
+      {
+         for (int j = 0; j < cols; j += 4, w += 32)
+            int8_block_rows(acc, w, &x[j]);
+      }
+      else
+      {
+         for (int j = 0; j < cols; j += 4, w += 32)
+            int8_block_cols(acc, w, &x[j]);
+      }
+      for (int r = 0; r < 8; r++)
+         out[i + r] = (float)acc[r] * scale[i + r];
+   }
 }
 
-// Dense CGEMV 8x4 (8-bit weights, quantized inputs)
-static inline void cgemv8x4(float *out, const opus_int8 *w, const float *scale, int rows, int cols, const float *_x)
+// Batched kernels: the same products for K streams, x[k] and out[k] being stream k's
+// input and output. Each weight is loaded once per batch; per-stream rounding matches
+// the GEMV kernels above, so a stream gives the same result alone or in a batch.
+void sgemm_c(float *const *out, const float *weights, int rows, int cols, int col_stride, const float *const *x, int K)
 {
-   opus_int8 x[MAX_INPUTS];
-   for (int i = 0; i < cols; i++)
-      x[i] = (opus_int8)floorf(.5f + 127 * _x[i]);
+   for (int k = 0; k < K; k++)
+      RNN_CLEAR(out[k], rows);
+   for (int i = 0; i < rows; i += 8)
+   {
+      const int n = MIN(8, rows - i);
+      for (int j = 0; j < cols; j++)
+      {
+         const float *w = &weights[j * col_stride + i];
+         for (int k = 0; k < K; k++)
+         {
+            float xj = x[k][j], *y = &out[k][i];
+            for (int r = 0; r < n; r++)
+               y[r] += w[r] * xj;
+         }
+      }
+   }
+}
 
-   for (int i = 0; i < rows; i++)
-      out[i] = 0;
+void sparse_cgemm8x4_c(float *const *out, const opus_int8 *w, const int *idx, const float *scale, int rows, const opus_int8 *const *x, int K, int row_major)
+{
+   for (int i = 0; i < rows; i += 8)
+   {
+      opus_int32 acc[RNN_MAX_BATCH][8];
+      int blocks = *idx++;
+      RNN_CLEAR(&acc[0][0], 8 * K);
+      for (int j = 0; j < blocks; j++, w += 32)
+      {
+         int pos = *idx++;
+         for (int k = 0; k < K; k++)
+         {
+            if (row_major)
+               int8_block_rows(acc[k], w, &x[k][pos]);
+            else
+               int8_block_cols(acc[k], w, &x[k][pos]);
+         }
+      }
+      for (int k = 0; k < K; k++)
+         for (int r = 0; r < 8; r++)
+            out[k][i + r] = (float)acc[k][r] * scale[i + r];
+   }
+}
 
+void cgemm8x4_c(float *const *out, const opus_int8 *w, const float *scale, int rows, int cols, const opus_int8 *const *x, int K, int row_major)
+{
    for (int i = 0; i < rows; i += 8)
    {
+      opus_int32 acc[RNN_MAX_BATCH][8];
+      RNN_CLEAR(&acc[0][0], 8 * K);
       for (int j = 0; j < cols; j += 4, w += 32)
       {
-         process_quantized_block(&out[i], w, x, j);
+         for (int k = 0; k < K; k++)
+         {
+            if (row_major)
+               int8_block_rows(acc[k], w, &x[k][j]);
+            else
+               int8_block_cols(acc[k], w, &x[k][j]);
+         }
       }
+      for (int k = 0; k < K; k++)
+         for (int r = 0; r < 8; r++)
+            out[k][i + r] = (float)acc[k][r] * scale[i + r];
    }
-
-   for (int i = 0; i < rows; i++)
-      out[i] *= scale[i];
 }
 
+#if defined(RNN_X86)
+static void (*const QUANTIZE_INPUT_IMPL[RNN_ARCH_COUNT])(opus_int8 *x, const float *_x, int n) = {
+    quantize_input_c,      // C
+    quantize_input_sse4_1, // SSE4.1
+    quantize_input_avx2    // AVX2
+};
+
+static void (*const SPARSE_CGEMV8X4_IMPL[RNN_ARCH_COUNT])(float *out, const opus_int8 *w, const int *idx, const float *scale, int rows, const opus_int8 *x, int row_major) = {
+    sparse_cgemv8x4_c,      // C
+    sparse_cgemv8x4_sse4_1, // SSE4.1
+    sparse_cgemv8x4_avx2    // AVX2
+};
+
+static void (*const CGEMV8X4_IMPL[RNN_ARCH_COUNT])(float *out, const opus_int8 *w, const float *scale, int rows, int cols, const opus_int8 *x, int row_major) = {
+    cgemv8x4_c,      // C
+    cgemv8x4_sse4_1, // SSE4.1
+    cgemv8x4_avx2    // AVX2
+};
+
+static void (*const SGEMM_IMPL[RNN_ARCH_COUNT])(float *const *out, const float *weights, int rows, int cols, int col_stride, const float *const *x, int K) = {
+    sgemm_c,   // C
+    sgemm_c,   // SSE4.1
+    sgemm_avx2 // AVX2
+};
+
+static void (*const SPARSE_CGEMM8X4_IMPL[RNN_ARCH_COUNT])(float *const *out, const opus_int8 *w, const int *idx, const float *scale, int rows, const opus_int8 *const *x, int K, int row_major) = {
+    sparse_cgemm8x4_c,      // C
+    sparse_cgemm8x4_sse4_1, // SSE4.1
+    sparse_cgemm8x4_avx2    // AVX2
+};
+
+static void (*const CGEMM8X4_IMPL[RNN_ARCH_COUNT])(float *const *out, const opus_int8 *w, const float *scale, int rows, int cols, const opus_int8 *const *x, int K, int row_major) = {
+    cgemm8x4_c,      // C
+    cgemm8x4_sse4_1, // SSE4.1
+    cgemm8x4_avx2    // AVX2
+};
+
+#define quantize_input(x, _x, n) ((*QUANTIZE_INPUT_IMPL[rnn_arch])(x, _x, n))
+#define sgemm(out, weights, rows, cols, col_stride, x, K) ((*SGEMM_IMPL[rnn_arch])(out, weights, rows, cols, col_stride, x, K))
+#define sparse_cgemm8x4(out, w, idx, scale, rows, x, K, row_major) ((*SPARSE_CGEMM8X4_IMPL[rnn_arch])(out, w, idx, scale, rows, x, K, row_major))
+#define cgemm8x4(out, w, scale, rows, cols, x, K, row_major) ((*CGEMM8X4_IMPL[rnn_arch])(out, w, scale, rows, cols, x, K, row_major))
+#define sparse_cgemv8x4(out, w, idx, scale, rows, x, row_major) ((*SPARSE_CGEMV8X4_IMPL[rnn_arch])(out, w, idx, scale, rows, x, row_major))
+#define cgemv8x4(out, w, scale, rows, cols, x, row_major) ((*CGEMV8X4_IMPL[rnn_arch])(out, w, scale, rows, cols, x, row_major))
+#else
+#define quantize_input quantize_input_c
+#define sgemm sgemm_c
+#define sparse_cgemm8x4 sparse_cgemm8x4_c
+#define cgemm8x4 cgemm8x4_c
+#define sparse_cgemv8x4 sparse_cgemv8x4_c
+#define cgemv8x4 cgemv8x4_c
+#endif
+
 // Fast tanh approximation
 static float tanh_approx(float x)
 {
@@ -159,7 +295,8 @@ void compute_activation_c(float *output, const float *input, int N, int activati
    }
 }
 
-void compute_linear_c(const LinearLayer *linear, float *out, const float *in)
+// Same as compute_linear_c(), with the int8 activations quantized into x
+static void compute_linear_q(const LinearLayer *linear, float *out, const float *in, opus_int8 *x, int row_major)
 {
    int i, M, N;
    const float *bias;
@@ -170,15 +307,25 @@ void compute_linear_c(const LinearLayer *linear, float *out, const float *in)
    {
       if (linear->weights_idx != NULL)
          sparse_sgemv8x4(out, linear->float_weights, linear->weights_idx, N, in);
+      else if (linear->panel_rows != 0)
+      {
+         /* Repacked: each panel holds panel_rows rows stored column by column */
+         const int P = linear->panel_rows;
+         for (i = 0; i < N; i += P)
+            sgemv(&out[i], &linear->float_weights[i * M], P, M, P, in);
+      }
       else
          sgemv(out, linear->float_weights, N, M, N, in);
    }
    else if (linear->weights != NULL)
    {
+      /* FULL reads the 8x4 blocks row by row, the layout they were exported in.
+         SOFT reads them column by column, which is what makes its gains softer. */
+      quantize_input(x, in, M);
       if (linear->weights_idx != NULL)
-         sparse_cgemv8x4(out, linear->weights, linear->weights_idx, linear->scale, N, M, in);
+         sparse_cgemv8x4(out, linear->weights, linear->weights_idx, linear->scale, N, x, row_major);
       else
-         cgemv8x4(out, linear->weights, linear->scale, N, M, in);
+         cgemv8x4(out, linear->weights, linear->scale, N, M, x, row_major);
    }
    else
    {
@@ -200,20 +347,75 @@ void compute_linear_c(const LinearLayer *linear, float *out, const float *in)
    }
 }
 
-void compute_generic_conv1d(const LinearLayer *layer, float *output, float *mem, const float *input, int input_size, int activation)
+void compute_linear_c(const LinearLayer *linear, float *out, const float *in, int row_major)
 {
-   float tmp[MAX_NEURONS];
+   opus_int8 x[MAX_INPUTS];
+   compute_linear_q(linear, out, in, x, row_major);
+}
+
+// Rows 8 * g .. 8 * g + 7 of compute_linear_q(), with the input already quantized into x
+static void linear_group(const LinearLayer *linear, float *out, int g, const float *in, const opus_int8 *x, int row_major)
+{
+   const int M = linear->nb_inputs;
+   const int N = linear->nb_outputs;
+   const int row = 8 * g;
+   int i;
+   if (linear->float_weights != NULL)
+   {
+      if (linear->weights_idx != NULL)
+         sparse_sgemv8x4(out, &linear->float_weights[32 * linear->group_blocks[g]], &linear->weights_idx[g + linear->group_blocks[g]], 8, in);
+      else if (linear->panel_rows != 0)
+      {
+         const int P = linear->panel_rows;
+         sgemv(out, &linear->float_weights[(row / P) * P * M + row % P], 8, M, P, in);
+      }
+      else
+         sgemv(out, &linear->float_weights[row], 8, M, N, in);
+   }
+   else if (linear->weights != NULL)
+   {
+      if (linear->weights_idx != NULL)
+         sparse_cgemv8x4(out, &linear->weights[32 * linear->group_blocks[g]], &linear->weights_idx[g + linear->group_blocks[g]], &linear->scale[row], 8, x, row_major);
+      else
+         cgemv8x4(out, &linear->weights[row * M], &linear->scale[row], 8, M, x, row_major);
+   }
+   else
+   {
+      RNN_CLEAR(out, 8);
+   }
+   if (linear->bias != NULL)
+   {
+      for (i = 0; i < 8; i++)
+         out[i] += linear->bias[row + i];
+   }
+   if (linear->diag)
+   {
+      for (i = 0; i < 8; i++)
+         out[i] += linear->diag[row + i] * in[(row + i) % M];
+   }
+}
+
+// A sparse layer can only be entered mid-stream once rnnoise_repack() has indexed its groups
+static int linear_groups_ok(const LinearLayer *linear)
+{
+   return (linear->nb_outputs & 0x7) == 0 && (linear->weights_idx == NULL || linear->group_blocks != NULL);
+}
+
+void compute_generic_conv1d(const LinearLayer *layer, float *output, float *mem, const float *input, int input_size, int activation, int row_major, RNNScratch *scratch)
+{
+   float *tmp = scratch->conv_in;
 
    if (layer->nb_inputs != input_size)
       RNN_COPY(tmp, mem, layer->nb_inputs - input_size);
    RNN_COPY(&tmp[layer->nb_inputs - input_size], input, input_size);
-   compute_linear_c(layer, output, tmp);
+   compute_linear_q(layer, output, tmp, scratch->in_q, row_major);
    compute_activation_c(output, output, layer->nb_outputs, activation);
    if (layer->nb_inputs != input_size)
       RNN_COPY(mem, &tmp[input_size], layer->nb_inputs - input_size);
 }
 
-void compute_generic_gru(const LinearLayer *input_weights, const LinearLayer *recurrent_weights, float *state, const float *in)
+// Two-pass GRU for layers that were not repacked
+static void compute_gru_unfused(const LinearLayer *input_weights, const LinearLayer *recurrent_weights, float *state, const float *in, int row_major)
 {
    int i;
    int N;
@@ -228,8 +430,8 @@ void compute_generic_gru(const LinearLayer *input_weights, const LinearLayer *re
    r = &zrh[N];
    h = &zrh[2 * N];
 
-   compute_linear_c(input_weights, zrh, in);
-   compute_linear_c(recurrent_weights, recur, state);
+   compute_linear_c(input_weights, zrh, in, row_major);
+   compute_linear_c(recurrent_weights, recur, state, row_major);
    for (i = 0; i < 2 * N; i++)
       zrh[i] += recur[i];
    compute_activation_c(zrh, zrh, 2 * N, ACTIVATION_SIGMOID);
@@ -242,12 +444,235 @@ void compute_generic_gru(const LinearLayer *input_weights, const LinearLayer *re
       state[i] = h[i];
 }
 
-void compute_generic_dense(const LinearLayer *layer, float *output, const float *input, int activation)
+/* Fused GRU: for each tile of 8 neurons, the z, r and h rows of both matrices are
+   evaluated back to back and the gates are applied while the results are still in L1.
+   The per-row arithmetic is the same as compute_gru_unfused(), so the output is too. */
+void compute_generic_gru(const LinearLayer *input_weights, const LinearLayer *recurrent_weights, float *state, const float *in, int row_major, RNNScratch *scratch)
 {
-   compute_linear_c(layer, output, input);
+   const int N = recurrent_weights->nb_inputs;
+   const int G = N / 8;
+   float *out = scratch->gru_out;
+
+   if ((N & 0x7) != 0 || N > RNN_MAX_GRU_SIZE || input_weights->nb_inputs > SIZEOF(scratch->in_q) ||
+       !linear_groups_ok(input_weights) || !linear_groups_ok(recurrent_weights))
+   {
+      compute_gru_unfused(input_weights, recurrent_weights, state, in, row_major);
+      return;
+   }
+
+   if (input_weights->weights != NULL)
+      quantize_input(scratch->in_q, in, input_weights->nb_inputs);
+   if (recurrent_weights->weights != NULL)
+      quantize_input(scratch->state_q, state, N);
+
+   for (int t = 0; t < G; t++)
+   {
+      float z[8], r[8], h[8], zr[8], rr[8], hr[8];
+      linear_group(input_weights, z, t, in, scratch->in_q, row_major);
+      linear_group(recurrent_weights, zr, t, state, scratch->state_q, row_major);
+      linear_group(input_weights, r, G + t, in, scratch->in_q, row_major);
+      linear_group(recurrent_weights, rr, G + t, state, scratch->state_q, row_major);
+      linear_group(input_weights, h, 2 * G + t, in, scratch->in_q, row_major);
+      linear_group(recurrent_weights, hr, 2 * G + t, state, scratch->state_q, row_major);
+      for (int i = 0; i < 8; i++)
+      {
+         z[i] += zr[i];
+         r[i] += rr[i];
+      }
+      compute_activation_c(z, z, 8, ACTIVATION_SIGMOID);
+      compute_activation_c(r, r, 8, ACTIVATION_SIGMOID);
+      for (int i = 0; i < 8; i++)
+         h[i] += hr[i] * r[i];
+      compute_activation_c(h, h, 8, ACTIVATION_TANH);
+      for (int i = 0; i < 8; i++)
+         out[8 * t + i] = z[i] * state[8 * t + i] + (1 - z[i]) * h[i];
+   }
+   // The recurrent rows of later tiles still read the old state
+   RNN_COPY(state, out, N);
+}
+
+void compute_generic_dense(const LinearLayer *layer, float *output, const float *input, int activation, int row_major, RNNScratch *scratch)
+{
+   compute_linear_q(layer, output, input, scratch->in_q, row_major);
    compute_activation_c(output, output, layer->nb_outputs, activation);
 }
 
+// Batched layers: compute_rnn_batch() evaluates every layer for K streams at once.
+
+// Rows row0 .. row0 + rows - 1 of compute_linear_q() for K streams: either the whole layer
+// or one 8-row group, which for a sparse layer needs the group index from rnnoise_repack()
+static void linear_rows_batch(const LinearLayer *linear, float *const *out, int row0, int rows, const float *const *in, const opus_int8 *const *x, int K, int row_major)
+{
+   const int M = linear->nb_inputs;
+   const int N = linear->nb_outputs;
+   const int g = row0 / 8;
+   const int b = linear->group_blocks != NULL ? linear->group_blocks[g] : 0; // row0 == 0 without it
+
+   int i, k;
+   if (linear->float_weights != NULL)
+   {
+      if (linear->weights_idx != NULL)
+      {
+         /* No batched float sparse kernel, the exported GRUs are int8 */
+         for (k = 0; k < K; k++)
+            sparse_sgemv8x4(out[k], &linear->float_weights[32 * b], &linear->weights_idx[g + b], rows, in[k]);
+      }
+      else if (linear->panel_rows != 0)
+      {
+         const int P = linear->panel_rows;
+         if (rows < P)
+            sgemm(out, &linear->float_weights[(row0 / P) * P * M + row0 % P], rows, M, P, in, K);
+         else
+         {
+            float *o[RNN_MAX_BATCH];
+            for (i = 0; i < rows; i += P)
+            {
+               for (k = 0; k < K; k++)
+                  o[k] = &out[k][i];
+               sgemm(o, &linear->float_weights[(row0 + i) * M], P, M, P, in, K);
+            }
+         }
+      }
+      else
+         sgemm(out, &linear->float_weights[row0], rows, M, N, in, K);
+   }
+   else if (linear->weights != NULL)
+   {
+      if (linear->weights_idx != NULL)
+         sparse_cgemm8x4(out, &linear->weights[32 * b], &linear->weights_idx[g + b], &linear->scale[row0], rows, x, K, row_major);
+      else
+         cgemm8x4(out, &linear->weights[row0 * M], &linear->scale[row0], rows, M, x, K, row_major);
+   }
+   else
+   {
+      for (k = 0; k < K; k++)
+         RNN_CLEAR(out[k], rows);
+   }
+   for (k = 0; k < K; k++)
+   {
+      if (linear->bias != NULL)
+      {
+         for (i = 0; i < rows; i++)
+            out[k][i] += linear->bias[row0 + i];
+      }
+      if (linear->diag)
+      {
+         for (i = 0; i < rows; i++)
+            out[k][i] += linear->diag[row0 + i] * in[k][(row0 + i) % M];
+      }
+   }
+}
+
+// Quantizes each stream's input when the layer runs on int8 weights
+static void quantize_batch(const LinearLayer *linear, const opus_int8 **x, const float *const *in, RNNScratch *const *scratch, int K)
+{
+   for (int k = 0; k < K; k++)
+   {
+      x[k] = scratch[k]->in_q;
+      if (linear->float_weights == NULL && linear->weights != NULL)
+         quantize_input(scratch[k]->in_q, in[k], linear->nb_inputs);
+   }
+}
+
+void compute_generic_conv1d_batch(const LinearLayer *layer, float *const *output, float *const *mem, const float *const *input, int input_size, int activation, int row_major, RNNScratch *const *scratch, int K)
+{
+   const float *in[RNN_MAX_BATCH];
+   const opus_int8 *x[RNN_MAX_BATCH];
+   const int history = layer->nb_inputs - input_size;
+
+   if (K < 1 || K > RNN_MAX_BATCH)
+      return;
+   for (int k = 0; k < K; k++)
+   {
+      float *tmp = scratch[k]->conv_in;
+      RNN_COPY(tmp, mem[k], history);
+      RNN_COPY(&tmp[history], input[k], input_size);
+      in[k] = tmp;
+   }
+   quantize_batch(layer, x, in, scratch, K);
+   linear_rows_batch(layer, output, 0, layer->nb_outputs, in, x, K, row_major);
+   for (int k = 0; k < K; k++)
+   {
+      compute_activation_c(output[k], output[k], layer->nb_outputs, activation);
+      RNN_COPY(mem[k], &in[k][input_size], history);
+   }
+}
+
+// compute_generic_gru() for K streams, one tile of 8 neurons of all streams at a time
+void compute_generic_gru_batch(const LinearLayer *input_weights, const LinearLayer *recurrent_weights, float *const *state, const float *const *in, int row_major, RNNScratch *const *scratch, int K)
+{
+   const int N = recurrent_weights->nb_inputs;
+   const int G = N / 8;
+   const opus_int8 *x[RNN_MAX_BATCH], *xs[RNN_MAX_BATCH];
+   float gates[6][RNN_MAX_BATCH][8];
+   float *z[RNN_MAX_BATCH], *zr[RNN_MAX_BATCH], *r[RNN_MAX_BATCH], *rr[RNN_MAX_BATCH], *h[RNN_MAX_BATCH], *hr[RNN_MAX_BATCH];
+   int k;
+
+   if (K < 1 || K > RNN_MAX_BATCH)
+      return;
+   if ((N & 0x7) != 0 || N > RNN_MAX_GRU_SIZE || input_weights->nb_inputs > SIZEOF(scratch[0]->in_q) ||
+       !linear_groups_ok(input_weights) || !linear_groups_ok(recurrent_weights))
+   {
+      for (k = 0; k < K; k++)
+         compute_gru_unfused(input_weights, recurrent_weights, state[k], in[k], row_major);
+      return;
+   }
+
+   quantize_batch(input_weights, x, in, scratch, K);
+   for (k = 0; k < K; k++)
+   {
+      xs[k] = scratch[k]->state_q;
+      if (recurrent_weights->float_weights == NULL && recurrent_weights->weights != NULL)
+         quantize_input(scratch[k]->state_q, state[k], N);
+      z[k] = gates[0][k];
+      zr[k] = gates[1][k];
+      r[k] = gates[2][k];
+      rr[k] = gates[3][k];
+      h[k] = gates[4][k];
+      hr[k] = gates[5][k];
+   }
+
+   for (int t = 0; t < G; t++)
+   {
+      linear_rows_batch(input_weights, z, 8 * t, 8, in, x, K, row_major);
+      linear_rows_batch(recurrent_weights, zr, 8 * t, 8, (const float *const *)state, xs, K, row_major);
+      linear_rows_batch(input_weights, r, 8 * (G + t), 8, in, x, K, row_major);
+      linear_rows_batch(recurrent_weights, rr, 8 * (G + t), 8, (const float *const *)state, xs, K, row_major);
+      linear_rows_batch(input_weights, h, 8 * (2 * G + t), 8, in, x, K, row_major);
+      linear_rows_batch(recurrent_weights, hr, 8 * (2 * G + t), 8, (const float *const *)state, xs, K, row_major);
+      for (k = 0; k < K; k++)
+      {
+         float *out = &scratch[k]->gru_out[8 * t];
+         const float *s = &state[k][8 * t];
+         for (int i = 0; i < 8; i++)
+         {
+            z[k][i] += zr[k][i];
+            r[k][i] += rr[k][i];
+         }
+         compute_activation_c(z[k], z[k], 8, ACTIVATION_SIGMOID);
+         compute_activation_c(r[k], r[k], 8, ACTIVATION_SIGMOID);
+         for (int i = 0; i < 8; i++)
+            h[k][i] += hr[k][i] * r[k][i];
+         compute_activation_c(h[k], h[k], 8, ACTIVATION_TANH);
+         for (int i = 0; i < 8; i++)
+            out[i] = z[k][i] * s[i] + (1 - z[k][i]) * h[k][i];
+      }
+   }
+   for (k = 0; k < K; k++)
+      RNN_COPY(state[k], scratch[k]->gru_out, N);
+}
+
+void compute_generic_dense_batch(const LinearLayer *layer, float *const *output, const float *const *input, int activation, int row_major, RNNScratch *const *scratch, int K)
+{
+   const opus_int8 *x[RNN_MAX_BATCH];
+   if (K < 1 || K > RNN_MAX_BATCH)
+      return;
+   quantize_batch(layer, x, input, scratch, K);
+   linear_rows_batch(layer, output, 0, layer->nb_outputs, input, x, K, row_major);
+   for (int k = 0; k < K; k++)
+      compute_activation_c(output[k], output[k], layer->nb_outputs, activation);
+}
+
 // linear_init helper functions
 static const WeightArray *find_array_entry(const WeightArray *arrays, const char *name)
 {
@@ -324,6 +749,8 @@ int linear_init(LinearLayer *layer, const WeightArray *arrays,
    layer->weights_idx = NULL;
    layer->diag = NULL;
    layer->scale = NULL;
+   layer->group_blocks = NULL;
+   layer->panel_rows = 0;
    if (bias != NULL)
    {
       if ((layer->bias = (float *)find_array_check(arrays, bias, nb_outputs * SIZEOF(layer->bias[0]))) == NULL)
@@ -373,4 +800,122 @@ int linear_init(LinearLayer *layer, const WeightArray *arrays,
    layer->nb_inputs = nb_inputs;
    layer->nb_outputs = nb_outputs;
    return 0;
-}
\ No newline at end of file
+}
+
+// linear_repack helper functions
+#define PANEL_ALIGN 64
+#define ALIGN_UP(n) (((n) + PANEL_ALIGN - 1) & ~(size_t)(PANEL_ALIGN - 1))
+
+static int count_blocks(const int *idx, int nb_outputs)
+{
+   int total = 0;
+   for (int i = 0; i < nb_outputs; i += 8)
+   {
+      int blocks = *idx++;
+      idx += blocks;
+      total += blocks;
+   }
+   return total;
+}
+
+size_t linear_repack_size(const LinearLayer *layer)
+{
+   const int M = layer->nb_inputs;
+   const int N = layer->nb_outputs;
+   size_t size = 0;
+   if (layer->weights_idx != NULL)
+   {
+      const int groups = N / 8;
+      const int blocks = count_blocks(layer->weights_idx, N);
+      size += ALIGN_UP((size_t)(groups + blocks) * sizeof(int));
+      size += ALIGN_UP((size_t)(groups + 1) * sizeof(int));
+      if (layer->float_weights != NULL)
+         size += ALIGN_UP((size_t)blocks * 32 * sizeof(float));
+      if (layer->weights != NULL)
+         size += ALIGN_UP((size_t)blocks * 32);
+   }
+   else
+   {
+      if (layer->float_weights != NULL)
+         size += ALIGN_UP((size_t)M * N * sizeof(float));
+      if (layer->weights != NULL)
+         size += ALIGN_UP((size_t)M * N);
+   }
+   return size;
+}
+
+static void *arena_take(char **arena, size_t size)
+{
+   void *p = *arena;
+   *arena += ALIGN_UP(size);
+   return p;
+}
+
+void linear_repack(LinearLayer *layer, char **arena)
+{
+   const int M = layer->nb_inputs;
+   const int N = layer->nb_outputs;
+   if (layer->weights_idx != NULL)
+   {
+      /* The index stream is kept as is (count, then positions, per 8-row group) so every
+         kernel can read it unchanged; group_blocks adds the block offset of each group. */
+      const int groups = N / 8;
+      const int blocks = count_blocks(layer->weights_idx, N);
+      int *idx = (int *)arena_take(arena, (size_t)(groups + blocks) * sizeof(int));
+      int *group_blocks = (int *)arena_take(arena, (size_t)(groups + 1) * sizeof(int));
+      const int *src = layer->weights_idx;
+      int *dst = idx;
+      group_blocks[0] = 0;
+      for (int g = 0; g < groups; g++)
+      {
+         int count = *src++;
+         *dst++ = count;
+         for (int j = 0; j < count; j++)
+            *dst++ = *src++;
+         group_blocks[g + 1] = group_blocks[g] + count;
+      }
+      if (layer->float_weights != NULL)
+      {
+         float *w = (float *)arena_take(arena, (size_t)blocks * 32 * sizeof(float));
+         RNN_COPY(w, layer->float_weights, blocks * 32);
+         layer->float_weights = w;
+      }
+      if (layer->weights != NULL)
+      {
+         opus_int8 *w = (opus_int8 *)arena_take(arena, (size_t)blocks * 32);
+         RNN_COPY(w, layer->weights, blocks * 32);
+         layer->weights = w;
+      }
+      layer->weights_idx = idx;
+      layer->group_blocks = group_blocks;
+   }
+   else
+   {
+      if (layer->float_weights != NULL)
+      {
+         float *w = (float *)arena_take(arena, (size_t)M * N * sizeof(float));
+         const int P = (N & 0xf) == 0 ? 16 : (N & 0x7) == 0 ? 8 : 0;
+         if (P == 0)
+         {
+            RNN_COPY(w, layer->float_weights, M * N);
+         }
+         else
+         {
+            /* Column-major M x N becomes N / P panels of M columns x P rows, so the
+               GEMV walks each panel front to back instead of striding by N floats. */
+            for (int i = 0; i < N; i += P)
+               for (int j = 0; j < M; j++)
+                  RNN_COPY(&w[i * M + j * P], &layer->float_weights[j * N + i], P);
+         }
+         layer->float_weights = w;
+         layer->panel_rows = P;
+      }
+      if (layer->weights != NULL)
+      {
+         /* Int8 weights are already stored 8 rows x 4 columns at a time, in kernel order */
+         opus_int8 *w = (opus_int8 *)arena_take(arena, (size_t)M * N);
+         RNN_COPY(w, layer->weights, M * N);
+         layer->weights = w;
+      }
+   }
+}
@@ -1,6 +1,8 @@
 #ifndef NNET_H
 #define NNET_H
 
+#include <math.h> // floorf
+
 #include "rnn.h"
 
 int linear_init(LinearLayer *layer, const WeightArray *arrays,
@@ -13,19 +15,62 @@ int linear_init(LinearLayer *layer, const WeightArray *arrays,
   int nb_inputs,
   int nb_outputs);
 
-void compute_generic_conv1d(const LinearLayer *layer, float *output, float *mem, const float *input, int input_size, int activation);
-void compute_generic_gru(const LinearLayer *input_weights, const LinearLayer *recurrent_weights, float *state, const float *in);
-void compute_generic_dense(const LinearLayer *layer, float *output, const float *input, int activation);
+// row_major: int8 block order, 1 for FULL denoise and 0 for SOFT (see compute_rnn)
+void compute_generic_conv1d(const LinearLayer *layer, float *output, float *mem, const float *input, int input_size, int activation, int row_major, RNNScratch *scratch);
+void compute_generic_gru(const LinearLayer *input_weights, const LinearLayer *recurrent_weights, float *state, const float *in, int row_major, RNNScratch *scratch);
+void compute_generic_dense(const LinearLayer *layer, float *output, const float *input, int activation, int row_major, RNNScratch *scratch);
+
+// Same layers for 1 <= K <= RNN_MAX_BATCH streams (any other K computes nothing), each weight
+// block shared by all of them.
+// Every stream gets exactly the result of the single-stream function.
+void compute_generic_conv1d_batch(const LinearLayer *layer, float *const *output, float *const *mem, const float *const *input, int input_size, int activation, int row_major, RNNScratch *const *scratch, int K);
+void compute_generic_gru_batch(const LinearLayer *input_weights, const LinearLayer *recurrent_weights, float *const *state, const float *const *in, int row_major, RNNScratch *const *scratch, int K);
+void compute_generic_dense_batch(const LinearLayer *layer, float *const *output, const float *const *input, int activation, int row_major, RNNScratch *const *scratch, int K);
+
+// Size in bytes and copy of one layer in the repacked arena (64-byte aligned sections)
+size_t linear_repack_size(const LinearLayer *layer);
+void linear_repack(LinearLayer *layer, char **arena);
 
 // rnnoise_data.c
 int init_rnnoise(RNNoise *model, const WeightArray *arrays);
 
-#if !defined(__AVX2__)
-  #if defined(_MSC_VER)
-    #pragma message("AVX2 not enabled. Use /arch:AVX2 or appropriate settings for better performance.")
-  #else
-    #warning "AVX2 not enabled. Use -march=native or -march=haswell for better performance."
-  #endif
-#endif
+// Float GEMV kernels, picked at runtime through rnn_arch (x86cpu.h)
+void sgemv_c(float *out, const float *weights, int rows, int cols, int col_stride, const float *x);
+void sparse_sgemv8x4_c(float *out, const float *w, const int *idx, int rows, const float *x);
+
+// Int8 GEMV kernels: x is quantized once by quantize_input_*, products accumulate in int32
+// and each output row is rescaled by scale[] once. row_major selects how the 8x4 blocks are read.
+void sparse_cgemv8x4_c(float *out, const opus_int8 *w, const int *idx, const float *scale, int rows, const opus_int8 *x, int row_major);
+void cgemv8x4_c(float *out, const opus_int8 *w, const float *scale, int rows, int cols, const opus_int8 *x, int row_major);
+void quantize_input_c(opus_int8 *x, const float *_x, int n);
+
+// Batched GEMM forms of the kernels above for K <= RNN_MAX_BATCH streams (compute_rnn_batch)
+void sgemm_c(float *const *out, const float *weights, int rows, int cols, int col_stride, const float *const *x, int K);
+void sparse_cgemm8x4_c(float *const *out, const opus_int8 *w, const int *idx, const float *scale, int rows, const opus_int8 *const *x, int K, int row_major);
+void cgemm8x4_c(float *const *out, const opus_int8 *w, const float *scale, int rows, int cols, const opus_int8 *const *x, int K, int row_major);
+
+// Activations in [-1, 1] map to [-127, 127]; out-of-range values saturate so SIMD sign tricks stay exact
+static inline opus_int8 quantize_activation(float v)
+{
+   float q = floorf(.5f + 127 * v);
+   return (opus_int8)MAX(-127.f, MIN(127.f, q));
+}
+
+// nnet_sse4_1.c
+void sparse_cgemv8x4_sse4_1(float *out, const opus_int8 *w, const int *idx, const float *scale, int rows, const opus_int8 *x, int row_major);
+void cgemv8x4_sse4_1(float *out, const opus_int8 *w, const float *scale, int rows, int cols, const opus_int8 *x, int row_major);
+void quantize_input_sse4_1(opus_int8 *x, const float *_x, int n);
+void sparse_cgemm8x4_sse4_1(float *const *out, const opus_int8 *w, const int *idx, const float *scale, int rows, const opus_int8 *const *x, int K, int row_major);
+void cgemm8x4_sse4_1(float *const *out, const opus_int8 *w, const float *scale, int rows, int cols, const opus_int8 *const *x, int K, int row_major);
+
+// nnet_avx2.c
+void sgemv_avx2(float *out, const float *weights, int rows, int cols, int col_stride, const float *x);
+void sparse_sgemv8x4_avx2(float *out, const float *w, const int *idx, int rows, const float *x);
+void sparse_cgemv8x4_avx2(float *out, const opus_int8 *w, const int *idx, const float *scale, int rows, const opus_int8 *x, int row_major);
+void cgemv8x4_avx2(float *out, const opus_int8 *w, const float *scale, int rows, int cols, const opus_int8 *x, int row_major);
+void quantize_input_avx2(opus_int8 *x, const float *_x, int n);
+void sgemm_avx2(float *const *out, const float *weights, int rows, int cols, int col_stride, const float *const *x, int K);
+void sparse_cgemm8x4_avx2(float *const *out, const opus_int8 *w, const int *idx, const float *scale, int rows, const opus_int8 *const *x, int K, int row_major);
+void cgemm8x4_avx2(float *const *out, const opus_int8 *w, const float *scale, int rows, int cols, const opus_int8 *const *x, int K, int row_major);
 
 #endif /* NNET_H */
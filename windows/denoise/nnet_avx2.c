@@ -0,0 +1,275 @@
+#include "nnet.h"
+#include "x86cpu.h"
+
+#if defined(RNN_X86)
+#include <immintrin.h> // AVX2, FMA
+
+// 16 rows per iteration, one broadcast of x[j] feeds two FMAs
+RNN_TARGET_AVX2
+static void sgemv16x1_avx2(float *out, const float *weights, int rows, int cols, int col_stride, const float *x)
+{
+   for (int i = 0; i < rows; i += 16)
+   {
+      __m256 vy0 = _mm256_setzero_ps();
+      __m256 vy8 = _mm256_setzero_ps();
+      for (int j = 0; j < cols; j++)
+      {
+         const float *w = &weights[j * col_stride + i];
+         __m256 vxj = _mm256_broadcast_ss(&x[j]);
+         vy0 = _mm256_fmadd_ps(_mm256_loadu_ps(&w[0]), vxj, vy0);
+         vy8 = _mm256_fmadd_ps(_mm256_loadu_ps(&w[8]), vxj, vy8);
+      }
+      _mm256_storeu_ps(&out[i], vy0);
+      _mm256_storeu_ps(&out[i + 8], vy8);
+   }
+}
+
+RNN_TARGET_AVX2
+static void sgemv8x1_avx2(float *out, const float *weights, int rows, int cols, int col_stride, const float *x)
+{
+   for (int i = 0; i < rows; i += 8)
+   {
+      __m256 vy0 = _mm256_setzero_ps();
+      for (int j = 0; j < cols; j++)
+      {
+         __m256 vxj = _mm256_broadcast_ss(&x[j]);
+         vy0 = _mm256_fmadd_ps(_mm256_loadu_ps(&weights[j * col_stride + i]), vxj, vy0);
+      }
+      _mm256_storeu_ps(&out[i], vy0);
+   }
+}
+
+void sgemv_avx2(float *out, const float *weights, int rows, int cols, int col_stride, const float *x)
+{
+   if ((rows & 0xf) == 0)
+      sgemv16x1_avx2(out, weights, rows, cols, col_stride, x);
+   else if ((rows & 0x7) == 0)
+      sgemv8x1_avx2(out, weights, rows, cols, col_stride, x);
+   else
+      sgemv_c(out, weights, rows, cols, col_stride, x);
+}
+
+// Each 8x4 block is stored column by column, so every column is one 8-float load
+RNN_TARGET_AVX2
+void sparse_sgemv8x4_avx2(float *out, const float *w, const int *idx, int rows, const float *x)
+{
+   for (int i = 0; i < rows; i += 8)
+   {
+      int cols = *idx++;
+      __m256 vy0 = _mm256_setzero_ps();
+      for (int j = 0; j < cols; j++, w += 32)
+      {
+         int pos = *idx++;
+         vy0 = _mm256_fmadd_ps(_mm256_loadu_ps(&w[0]), _mm256_broadcast_ss(&x[pos]), vy0);
+         vy0 = _mm256_fmadd_ps(_mm256_loadu_ps(&w[8]), _mm256_broadcast_ss(&x[pos + 1]), vy0);
+         vy0 = _mm256_fmadd_ps(_mm256_loadu_ps(&w[16]), _mm256_broadcast_ss(&x[pos + 2]), vy0);
+         vy0 = _mm256_fmadd_ps(_mm256_loadu_ps(&w[24]), _mm256_broadcast_ss(&x[pos + 3]), vy0);
+      }
+      _mm256_storeu_ps(&out[i], vy0);
+   }
+}
+
+// Same rounding and saturation as quantize_activation(), eight values per step
+RNN_TARGET_AVX2
+void quantize_input_avx2(opus_int8 *x, const float *_x, int n)
+{
+   const __m256 half = _mm256_set1_ps(.5f);
+   const __m256 q127 = _mm256_set1_ps(127.f);
+   const __m128i lo = _mm_set1_epi8(-127);
+   int i;
+   for (i = 0; i + 8 <= n; i += 8)
+   {
+      __m256 v = _mm256_add_ps(half, _mm256_mul_ps(q127, _mm256_loadu_ps(&_x[i])));
+      __m256i q = _mm256_cvtps_epi32(_mm256_floor_ps(v));
+      __m128i q16 = _mm_packs_epi32(_mm256_castsi256_si128(q), _mm256_extracti128_si256(q, 1));
+      __m128i q8 = _mm_max_epi8(_mm_packs_epi16(q16, _mm_setzero_si128()), lo);
+      _mm_storel_epi64((__m128i *)&x[i], q8);
+   }
+   for (; i < n; i++)
+      x[i] = quantize_activation(_x[i]);
+}
+
+// An 8x4 block with rows 0-3 in the low lane and rows 4-7 in the high lane
+RNN_TARGET_AVX2
+static inline __m256i int8_load_block_avx2(const opus_int8 *w, int row_major)
+{
+   __m256i vw = _mm256_loadu_si256((const __m256i *)w);
+   if (!row_major)
+   {
+      // Column-major block: gather rows 0-3 into the low lane and rows 4-7 into the high lane,
+      // then transpose each 4x4 byte tile.
+      const __m256i lanes = _mm256_setr_epi32(0, 2, 4, 6, 1, 3, 5, 7);
+      const __m256i order = _mm256_setr_epi8(0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15,
+                                             0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15);
+      vw = _mm256_shuffle_epi8(_mm256_permutevar8x32_epi32(vw, lanes), order);
+   }
+   return vw;
+}
+
+// |w| is the unsigned maddubs operand and w's sign moves onto x,
+// which never holds -128, so the 16-bit pair sums cannot saturate.
+RNN_TARGET_AVX2
+static inline __m256i int8_dot_block_avx2(__m256i acc, __m256i vw, const opus_int8 *x, __m256i ones)
+{
+   int x4;
+   memcpy(&x4, x, sizeof(x4));
+   __m256i vx = _mm256_set1_epi32(x4);
+   __m256i pairs = _mm256_maddubs_epi16(_mm256_abs_epi8(vw), _mm256_sign_epi8(vx, vw));
+   return _mm256_add_epi32(acc, _mm256_madd_epi16(pairs, ones));
+}
+
+// One 8x4 block per call
+RNN_TARGET_AVX2
+static inline __m256i int8_block_avx2(__m256i acc, const opus_int8 *w, const opus_int8 *x, int row_major, __m256i ones)
+{
+   return int8_dot_block_avx2(acc, int8_load_block_avx2(w, row_major), x, ones);
+}
+
+RNN_TARGET_AVX2
+void sparse_cgemv8x4_avx2(float *out, const opus_int8 *w, const int *idx, const float *scale, int rows, const opus_int8 *x, int row_major)
+{
+   const __m256i ones = _mm256_set1_epi16(1);
+
+   for (int i = 0; i < rows; i += 8)
+   {
+      __m256i acc = _mm256_setzero_si256();
+      int blocks = *idx++;
+      if (row_major)
+      {
+         for (int j = 0; j < blocks; j++, w += 32)
+            acc = int8_block_avx2(acc, w, &x[*idx++], 1, ones);
+      }
+      else
+      {
+         for (int j = 0; j < blocks; j++, w += 32)
+            acc = int8_block_avx2(acc, w, &x[*idx++], 0, ones);
+      }
+      _mm256_storeu_ps(&out[i], _mm256_mul_ps(_mm256_cvtepi32_ps(acc), _mm256_loadu_ps(&scale[i])));
+   }
+}
+
+RNN_TARGET_AVX2
+void cgemv8x4_avx2(float *out, const opus_int8 *w, const float *scale, int rows, int cols, const opus_int8 *x, int row_major)
+{
+   const __m256i ones = _mm256_set1_epi16(1);
+
+   for (int i = 0; i < rows; i += 8)
+   {
+      __m256i acc = _mm256_setzero_si256();
+      if (row_major)
+      {
+         for (int j = 0; j < cols; j += 4, w += 32)
+            acc = int8_block_avx2(acc, w, &x[j], 1, ones);
+      }
+      else
+      {
+         for (int j = 0; j < cols; j += 4, w += 32)
+            acc = int8_block_avx2(acc, w, &x[j], 0, ones);
+      }
+      _mm256_storeu_ps(&out[i], _mm256_mul_ps(_mm256_cvtepi32_ps(acc), _mm256_loadu_ps(&scale[i])));
+   }
+}
+
+// Batched forms: streams go four at a time with their accumulators in registers; a weight
+// strip is fetched from memory once per batch and re-read from L1 by each group of four.
+RNN_TARGET_AVX2
+static void sgemm8x1_avx2(float *const *out, const float *weights, int rows, int cols, int col_stride, const float *const *x, int K)
+{
+   for (int i = 0; i < rows; i += 8)
+   {
+      for (int k0 = 0; k0 < K; k0 += 4)
+      {
+         const int kb = MIN(4, K - k0);
+         const float *const *xk = &x[k0];
+         __m256 vy0 = _mm256_setzero_ps(), vy1 = vy0, vy2 = vy0, vy3 = vy0;
+         for (int j = 0; j < cols; j++)
+         {
+            __m256 vw = _mm256_loadu_ps(&weights[j * col_stride + i]);
+            vy0 = _mm256_fmadd_ps(vw, _mm256_broadcast_ss(&xk[0][j]), vy0);
+            if (kb > 1)
+               vy1 = _mm256_fmadd_ps(vw, _mm256_broadcast_ss(&xk[1][j]), vy1);
+            if (kb > 2)
+               vy2 = _mm256_fmadd_ps(vw, _mm256_broadcast_ss(&xk[2][j]), vy2);
+            if (kb > 3)
+               vy3 = _mm256_fmadd_ps(vw, _mm256_broadcast_ss(&xk[3][j]), vy3);
+         }
+         _mm256_storeu_ps(&out[k0][i], vy0);
+         if (kb > 1)
+            _mm256_storeu_ps(&out[k0 + 1][i], vy1);
+         if (kb > 2)
+            _mm256_storeu_ps(&out[k0 + 2][i], vy2);
+         if (kb > 3)
+            _mm256_storeu_ps(&out[k0 + 3][i], vy3);
+      }
+   }
+}
+
+void sgemm_avx2(float *const *out, const float *weights, int rows, int cols, int col_stride, const float *const *x, int K)
+{
+   if ((rows & 0x7) == 0)
+      sgemm8x1_avx2(out, weights, rows, cols, col_stride, x, K);
+   else
+      sgemm_c(out, weights, rows, cols, col_stride, x, K);
+}
+
+// 8 rows of up to four streams; idx is NULL for a dense row group
+RNN_TARGET_AVX2
+static void int8_rows_batch_avx2(float *const *out, const opus_int8 *w, const int *idx, int blocks, const float *scale, const opus_int8 *const *x, int kb, int row_major)
+{
+   const __m256i ones = _mm256_set1_epi16(1);
+   __m256i a0 = _mm256_setzero_si256(), a1 = a0, a2 = a0, a3 = a0;
+   for (int j = 0; j < blocks; j++, w += 32)
+   {
+      const int pos = idx != NULL ? idx[j] : 4 * j;
+      __m256i vw = int8_load_block_avx2(w, row_major);
+      a0 = int8_dot_block_avx2(a0, vw, &x[0][pos], ones);
+      if (kb > 1)
+         a1 = int8_dot_block_avx2(a1, vw, &x[1][pos], ones);
+      if (kb > 2)
+         a2 = int8_dot_block_avx2(a2, vw, &x[2][pos], ones);
+      if (kb > 3)
+         a3 = int8_dot_block_avx2(a3, vw, &x[3][pos], ones);
+   }
+   const __m256 vscale = _mm256_loadu_ps(scale);
+   _mm256_storeu_ps(out[0], _mm256_mul_ps(_mm256_cvtepi32_ps(a0), vscale));
+   if (kb > 1)
+      _mm256_storeu_ps(out[1], _mm256_mul_ps(_mm256_cvtepi32_ps(a1), vscale));
+   if (kb > 2)
+      _mm256_storeu_ps(out[2], _mm256_mul_ps(_mm256_cvtepi32_ps(a2), vscale));
+   if (kb > 3)
+      _mm256_storeu_ps(out[3], _mm256_mul_ps(_mm256_cvtepi32_ps(a3), vscale));
+}
+
+void sparse_cgemm8x4_avx2(float *const *out, const opus_int8 *w, const int *idx, const float *scale, int rows, const opus_int8 *const *x, int K, int row_major)
+{
+   for (int i = 0; i < rows; i += 8)
+   {
+      const int blocks = *idx++;
+      for (int k0 = 0; k0 < K; k0 += 4)
+      {
+         float *o[4];
+         const int kb = MIN(4, K - k0);
+         for (int k = 0; k < kb; k++)
+            o[k] = &out[k0 + k][i];
+         int8_rows_batch_avx2(o, w, idx, blocks, &scale[i], &x[k0], kb, row_major);
+      }
+      idx += blocks;
+      w += 32 * blocks;
+   }
+}
+
+void cgemm8x4_avx2(float *const *out, const opus_int8 *w, const float *scale, int rows, int cols, const opus_int8 *const *x, int K, int row_major)
+{
+   for (int i = 0; i < rows; i += 8, w += 8 * cols)
+   {
+      for (int k0 = 0; k0 < K; k0 += 4)
+      {
+         float *o[4];
+         const int kb = MIN(4, K - k0);
+         for (int k = 0; k < kb; k++)
+            o[k] = &out[k0 + k][i];
+         int8_rows_batch_avx2(o, w, NULL, cols / 4, &scale[i], &x[k0], kb, row_major);
+      }
+   }
+}
+#endif
@@ -0,0 +1,199 @@
+#include "nnet.h"
+#include "x86cpu.h"
+
+#if defined(RNN_X86)
+#include <smmintrin.h> // SSE4.1, SSSE3
+
+// Same rounding and saturation as quantize_activation(), four values per step
+RNN_TARGET_SSE4_1
+void quantize_input_sse4_1(opus_int8 *x, const float *_x, int n)
+{
+   const __m128 half = _mm_set1_ps(.5f);
+   const __m128 q127 = _mm_set1_ps(127.f);
+   const __m128i lo = _mm_set1_epi8(-127);
+   int i;
+   for (i = 0; i + 8 <= n; i += 8)
+   {
+      __m128 v0 = _mm_add_ps(half, _mm_mul_ps(q127, _mm_loadu_ps(&_x[i])));
+      __m128 v1 = _mm_add_ps(half, _mm_mul_ps(q127, _mm_loadu_ps(&_x[i + 4])));
+      __m128i q0 = _mm_cvtps_epi32(_mm_floor_ps(v0));
+      __m128i q1 = _mm_cvtps_epi32(_mm_floor_ps(v1));
+      __m128i q = _mm_max_epi8(_mm_packs_epi16(_mm_packs_epi32(q0, q1), _mm_setzero_si128()), lo);
+      _mm_storel_epi64((__m128i *)&x[i], q);
+   }
+   for (; i < n; i++)
+      x[i] = quantize_activation(_x[i]);
+}
+
+// Signed int8 dot products through maddubs: |w| is the unsigned operand and w's sign moves onto x.
+// x never holds -128, so sign() cannot overflow and the 16-bit pair sums stay below 2 * 128 * 127.
+RNN_TARGET_SSE4_1
+static inline __m128i int8_dot4(__m128i w, __m128i vx, __m128i ones)
+{
+   __m128i pairs = _mm_maddubs_epi16(_mm_abs_epi8(w), _mm_sign_epi8(vx, w));
+   return _mm_madd_epi16(pairs, ones);
+}
+
+// Turns a column-major 8x4 block into rows 0-3 and rows 4-7 in row-major order
+RNN_TARGET_SSE4_1
+static inline void int8_transpose_block(__m128i *rows03, __m128i *rows47, const opus_int8 *w)
+{
+   const __m128i order = _mm_setr_epi8(0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15);
+   __m128i c01 = _mm_loadu_si128((const __m128i *)&w[0]);
+   __m128i c23 = _mm_loadu_si128((const __m128i *)&w[16]);
+   __m128i a = _mm_unpacklo_epi32(c01, c23);
+   __m128i b = _mm_unpackhi_epi32(c01, c23);
+   *rows03 = _mm_shuffle_epi8(_mm_unpacklo_epi32(a, b), order);
+   *rows47 = _mm_shuffle_epi8(_mm_unpackhi_epi32(a, b), order);
+}
+
+// Rows 0-3 and 4-7 of an 8x4 block in row-major order
+RNN_TARGET_SSE4_1
+static inline void int8_load_block(__m128i *w03, __m128i *w47, const opus_int8 *w, int row_major)
+{
+   if (row_major)
+   {
+      *w03 = _mm_loadu_si128((const __m128i *)&w[0]);
+      *w47 = _mm_loadu_si128((const __m128i *)&w[16]);
+   }
+   else
+   {
+      int8_transpose_block(w03, w47, w);
+   }
+}
+
+RNN_TARGET_SSE4_1
+static inline void int8_dot_block(__m128i *acc03, __m128i *acc47, __m128i w03, __m128i w47, const opus_int8 *x, __m128i ones)
+{
+   int x4;
+   memcpy(&x4, x, sizeof(x4));
+   __m128i vx = _mm_set1_epi32(x4);
+   *acc03 = _mm_add_epi32(*acc03, int8_dot4(w03, vx, ones));
+   *acc47 = _mm_add_epi32(*acc47, int8_dot4(w47, vx, ones));
+}
+
+RNN_TARGET_SSE4_1
+static inline void int8_block(__m128i *acc03, __m128i *acc47, const opus_int8 *w, const opus_int8 *x, int row_major, __m128i ones)
+{
+   __m128i w03, w47;
+   int8_load_block(&w03, &w47, w, row_major);
+   int8_dot_block(acc03, acc47, w03, w47, x, ones);
+}
+
+RNN_TARGET_SSE4_1
+static inline void int8_store_rows(float *out, const float *scale, __m128i acc03, __m128i acc47)
+{
+   _mm_storeu_ps(&out[0], _mm_mul_ps(_mm_cvtepi32_ps(acc03), _mm_loadu_ps(&scale[0])));
+   _mm_storeu_ps(&out[4], _mm_mul_ps(_mm_cvtepi32_ps(acc47), _mm_loadu_ps(&scale[4])));
+}
+
+RNN_TARGET_SSE4_1
+void sparse_cgemv8x4_sse4_1(float *out, const opus_int8 *w, const int *idx, const float *scale, int rows, const opus_int8 *x, int row_major)
+{
+   const __m128i ones = _mm_set1_epi16(1);
+
+   for (int i = 0; i < rows; i += 8)
+   {
+      __m128i acc03 = _mm_setzero_si128();
+      __m128i acc47 = _mm_setzero_si128();
+      int blocks = *idx++;
+      if (row_major)
+      {
+         for (int j = 0; j < blocks; j++, w += 32)
+            int8_block(&acc03, &acc47, w, &x[*idx++], 1, ones);
+      }
+      else
+      {
+         for (int j = 0; j < blocks; j++, w += 32)
+            int8_block(&acc03, &acc47, w, &x[*idx++], 0, ones);
+      }
+      int8_store_rows(&out[i], &scale[i], acc03, acc47);
+   }
+}
+
+RNN_TARGET_SSE4_1
+void cgemv8x4_sse4_1(float *out, const opus_int8 *w, const float *scale, int rows, int cols, const opus_int8 *x, int row_major)
+{
+   const __m128i ones = _mm_set1_epi16(1);
+
+   for (int i = 0; i < rows; i += 8)
+   {
+      __m128i acc03 = _mm_setzero_si128();
+      __m128i acc47 = _mm_setzero_si128();
+      if (row_major)
+      {
+         for (int j = 0; j < cols; j += 4, w += 32)
+            int8_block(&acc03, &acc47, w, &x[j], 1, ones);
+      }
+      else
+      {
+         for (int j = 0; j < cols; j += 4, w += 32)
+            int8_block(&acc03, &acc47, w, &x[j], 0, ones);
+      }
+      int8_store_rows(&out[i], &scale[i], acc03, acc47);
+   }
+}
+
+// Batched forms: streams go four at a time with their accumulators in registers, so each
+// block is fetched once per batch and re-read from L1 by every group of four
+RNN_TARGET_SSE4_1
+static void int8_rows_batch(float *const *out, const opus_int8 *w, const int *idx, int blocks, const float *scale, const opus_int8 *const *x, int kb, int row_major)
+{
+   const __m128i ones = _mm_set1_epi16(1);
+   __m128i a03 = _mm_setzero_si128(), a47 = a03, b03 = a03, b47 = a03;
+   __m128i c03 = a03, c47 = a03, d03 = a03, d47 = a03;
+   for (int j = 0; j < blocks; j++, w += 32)
+   {
+      const int pos = idx != NULL ? idx[j] : 4 * j;
+      __m128i w03, w47;
+      int8_load_block(&w03, &w47, w, row_major);
+      int8_dot_block(&a03, &a47, w03, w47, &x[0][pos], ones);
+      if (kb > 1)
+         int8_dot_block(&b03, &b47, w03, w47, &x[1][pos], ones);
+      if (kb > 2)
+         int8_dot_block(&c03, &c47, w03, w47, &x[2][pos], ones);
+      if (kb > 3)
+         int8_dot_block(&d03, &d47, w03, w47, &x[3][pos], ones);
+   }
+   int8_store_rows(out[0], scale, a03, a47);
+   if (kb > 1)
+      int8_store_rows(out[1], scale, b03, b47);
+   if (kb > 2)
+      int8_store_rows(out[2], scale, c03, c47);
+   if (kb > 3)
+      int8_store_rows(out[3], scale, d03, d47);
+}
+
+void sparse_cgemm8x4_sse4_1(float *const *out, const opus_int8 *w, const int *idx, const float *scale, int rows, const opus_int8 *const *x, int K, int row_major)
+{
+   for (int i = 0; i < rows; i += 8)
+   {
+      const int blocks = *idx++;
+      for (int k0 = 0; k0 < K; k0 += 4)
+      {
+         float *o[4];
+         const int kb = MIN(4, K - k0);
+         for (int k = 0; k < kb; k++)
+            o[k] = &out[k0 + k][i];
+         int8_rows_batch(o, w, idx, blocks, &scale[i], &x[k0], kb, row_major);
+      }
+      idx += blocks;
+      w += 32 * blocks;
+   }
+}
+
+void cgemm8x4_sse4_1(float *const *out, const opus_int8 *w, const float *scale, int rows, int cols, const opus_int8 *const *x, int K, int row_major)
+{
+   for (int i = 0; i < rows; i += 8, w += 8 * cols)
+   {
+      for (int k0 = 0; k0 < K; k0 += 4)
+      {
+         float *o[4];
+         const int kb = MIN(4, K - k0);
+         for (int k = 0; k < kb; k++)
+            o[k] = &out[k0 + k][i];
+         int8_rows_batch(o, w, NULL, cols / 4, &scale[i], &x[k0], kb, row_major);
+      }
+   }
+}
+#endif
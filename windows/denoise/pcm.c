@@ -0,0 +1,40 @@
+#include "pcm.h"
+#include "x86cpu.h"
+
+static void deinterleave_c(float *const *out, const int16_t *in, int channels, int n)
+{
+  for (int i = 0; i < n; i++)
+    for (int c = 0; c < channels; c++)
+      out[c][i] = (float)in[i * channels + c];
+}
+
+static void interleave_c(int16_t *out, const float *const *in, int channels, int n)
+{
+  for (int i = 0; i < n; i++)
+    for (int c = 0; c < channels; c++)
+      out[i * channels + c] = rnn_float2s16(in[c][i]);
+}
+
+void rnn_deinterleave_s16(float *const *out, const int16_t *in, int channels, int n)
+{
+#if defined(RNN_X86)
+  if (channels == 2 && rnn_arch == RNN_ARCH_AVX2)
+  {
+    rnn_deinterleave_s16_stereo_avx2(out, in, n);
+    return;
+  }
+#endif
+  deinterleave_c(out, in, channels, n);
+}
+
+void rnn_interleave_s16(int16_t *out, const float *const *in, int channels, int n)
+{
+#if defined(RNN_X86)
+  if (channels == 2 && rnn_arch == RNN_ARCH_AVX2)
+  {
+    rnn_interleave_s16_stereo_avx2(out, in, n);
+    return;
+  }
+#endif
+  interleave_c(out, in, channels, n);
+}
@@ -0,0 +1,43 @@
+#ifndef PCM_H
+#define PCM_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <math.h> // lrintf
+
+#include "rnn.h"
+
+/*
+ * Conversion between interleaved 16-bit PCM and the per-channel float frames of
+ * rnnoise_process_frames(), in the integer range the network expects (no 1/32768 scaling).
+ * Stereo has an AVX2 kernel; other channel counts use the scalar loop. Both round to nearest
+ * and saturate, so every level gives the same samples.
+ */
+
+// One sample rounded to nearest and saturated, as every 16-bit output path does it
+static inline int16_t rnn_float2s16(float v)
+{
+  return (int16_t)lrintf(MAX(-32768.f, MIN(32767.f, v)));
+}
+
+/**
+ * Split n frames of channels-interleaved samples into out[0..channels-1].
+ */
+void rnn_deinterleave_s16(float *const *out, const int16_t *in, int channels, int n);
+
+/**
+ * Interleave n frames of in[0..channels-1] into out, rounded and clamped to 16 bits.
+ */
+void rnn_interleave_s16(int16_t *out, const float *const *in, int channels, int n);
+
+// pcm_avx2.c: channels == 2
+void rnn_deinterleave_s16_stereo_avx2(float *const *out, const int16_t *in, int n);
+void rnn_interleave_s16_stereo_avx2(int16_t *out, const float *const *in, int n);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PCM_H */
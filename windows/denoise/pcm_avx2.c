@@ -0,0 +1,50 @@
+#include "pcm.h"
+#include "x86cpu.h"
+
+#if defined(RNN_X86)
+#include <immintrin.h> // AVX2
+
+/* A stereo frame is one 32-bit word, left sample in the low half: eight frames per register,
+   split by sign-extending each half. */
+RNN_TARGET_AVX2
+void rnn_deinterleave_s16_stereo_avx2(float *const *out, const int16_t *in, int n)
+{
+  float *left = out[0], *right = out[1];
+  int i = 0;
+  for (; i + 8 <= n; i += 8)
+  {
+    __m256i v = _mm256_loadu_si256((const __m256i *)&in[2 * i]);
+    __m256i l = _mm256_srai_epi32(_mm256_slli_epi32(v, 16), 16);
+    __m256i r = _mm256_srai_epi32(v, 16);
+    _mm256_storeu_ps(&left[i], _mm256_cvtepi32_ps(l));
+    _mm256_storeu_ps(&right[i], _mm256_cvtepi32_ps(r));
+  }
+  for (; i < n; i++)
+  {
+    left[i] = (float)in[2 * i];
+    right[i] = (float)in[2 * i + 1];
+  }
+}
+
+// Clamped before the conversion, which rounds to nearest like lrintf()
+RNN_TARGET_AVX2
+void rnn_interleave_s16_stereo_avx2(int16_t *out, const float *const *in, int n)
+{
+  const float *left = in[0], *right = in[1];
+  const __m256 lo = _mm256_set1_ps(-32768.f), hi = _mm256_set1_ps(32767.f);
+  const __m256i mask = _mm256_set1_epi32(0xffff);
+  int i = 0;
+  for (; i + 8 <= n; i += 8)
+  {
+    __m256i l = _mm256_cvtps_epi32(_mm256_min_ps(_mm256_max_ps(_mm256_loadu_ps(&left[i]), lo), hi));
+    __m256i r = _mm256_cvtps_epi32(_mm256_min_ps(_mm256_max_ps(_mm256_loadu_ps(&right[i]), lo), hi));
+    __m256i v = _mm256_or_si256(_mm256_and_si256(l, mask), _mm256_slli_epi32(r, 16));
+    _mm256_storeu_si256((__m256i *)&out[2 * i], v);
+  }
+  for (; i < n; i++)
+  {
+    out[2 * i] = rnn_float2s16(left[i]);
+    out[2 * i + 1] = rnn_float2s16(right[i]);
+  }
+}
+#endif
@@ -2,6 +2,7 @@
 #include <math.h>   // sqrt
 
 #include "pitch.h"
+#include "x86cpu.h"
 
 static void xcorr_kernel(const float_t *x, const float_t *y, float_t sum[4], int len)
 {
@@ -69,7 +70,7 @@ static void xcorr_kernel(const float_t *x, const float_t *y, float_t sum[4], int
    }
 }
 
-static float_t celt_inner_prod(const float_t *x, const float_t *y, int N)
+static float_t celt_inner_prod_c(const float_t *x, const float_t *y, int N)
 {
    int i;
    float_t xy = 0;
@@ -78,7 +79,7 @@ static float_t celt_inner_prod(const float_t *x, const float_t *y, int N)
    return xy;
 }
 
-void rnn_pitch_xcorr(const float_t *_x, const float_t *_y, float_t *xcorr, int len, int max_pitch)
+static void rnn_pitch_xcorr_c(const float_t *_x, const float_t *_y, float_t *xcorr, int len, int max_pitch)
 {
    int i;
    /*The EDSP version requires that max_pitch is at least 1, and that _x is
@@ -97,11 +98,59 @@ void rnn_pitch_xcorr(const float_t *_x, const float_t *_y, float_t *xcorr, int l
    for (; i < max_pitch; i++)
    {
       float_t sum;
-      sum = celt_inner_prod(_x, _y + i, len);
+      sum = celt_inner_prod_c(_x, _y + i, len);
       xcorr[i] = sum;
    }
 }
 
+static void dual_inner_prod_c(const float_t *x, const float_t *y01, const float_t *y02,
+                            int N, float_t *xy1, float_t *xy2)
+{
+   int i;
+   float_t xy01 = 0;
+   float_t xy02 = 0;
+   for (i = 0; i < N; i++)
+   {
+      xy01 = MAC(xy01, x[i], y01[i]);
+      xy02 = MAC(xy02, x[i], y02[i]);
+   }
+   *xy1 = xy01;
+   *xy2 = xy02;
+}
+
+#if defined(RNN_X86)
+static void (*const PITCH_XCORR_IMPL[RNN_ARCH_COUNT])(const float_t *x, const float_t *y, float_t *xcorr, int len, int max_pitch) = {
+    rnn_pitch_xcorr_c,   // C
+    rnn_pitch_xcorr_c,   // SSE4.1
+    rnn_pitch_xcorr_avx2 // AVX2
+};
+
+static float_t (*const INNER_PROD_IMPL[RNN_ARCH_COUNT])(const float_t *x, const float_t *y, int N) = {
+    celt_inner_prod_c,   // C
+    celt_inner_prod_c,   // SSE4.1
+    celt_inner_prod_avx2 // AVX2
+};
+
+static void (*const DUAL_INNER_PROD_IMPL[RNN_ARCH_COUNT])(const float_t *x, const float_t *y01, const float_t *y02, int N, float_t *xy1, float_t *xy2) = {
+    dual_inner_prod_c,   // C
+    dual_inner_prod_c,   // SSE4.1
+    dual_inner_prod_avx2 // AVX2
+};
+
+#define rnn_pitch_xcorr(x, y, xcorr, len, max_pitch) ((*PITCH_XCORR_IMPL[rnn_arch])(x, y, xcorr, len, max_pitch))
+#define celt_inner_prod(x, y, N) ((*INNER_PROD_IMPL[rnn_arch])(x, y, N))
+#define dual_inner_prod(x, y01, y02, N, xy1, xy2) ((*DUAL_INNER_PROD_IMPL[rnn_arch])(x, y01, y02, N, xy1, xy2))
+#else
+#define rnn_pitch_xcorr rnn_pitch_xcorr_c
+#define celt_inner_prod celt_inner_prod_c
+#define dual_inner_prod dual_inner_prod_c
+#endif
+
+void rnn_xcorr(const float_t *x, const float_t *y, float_t *xcorr, int len, int max_pitch)
+{
+   rnn_pitch_xcorr(x, y, xcorr, len, max_pitch);
+}
+
 static void celt_fir5(const float_t *x, const float_t *num, float_t *y, int N, float_t *mem)
 {
    float_t mem0 = mem[0], mem1 = mem[1], mem2 = mem[2], mem3 = mem[3], mem4 = mem[4];
@@ -319,15 +368,19 @@ void rnn_pitch_search(const float_t *x_lp, float_t *y, int len, int max_pitch, i
 
    /* Finer search with 2x decimation */
 
+   /* Only the five lags around each coarse candidate are needed; correlating each window
+      in one call lets the lag-parallel kernel share its loads of x_lp across lags. */
    for (i = 0; i < max_pitch >> 1; i++)
-   {
-      float_t sum;
       xcorr[i] = 0;
-      if (abs(i - 2 * best_pitch[0]) > 2 && abs(i - 2 * best_pitch[1]) > 2)
+   for (j = 0; j < 2; j++)
+   {
+      int start = MAX(0, 2 * best_pitch[j] - 2);
+      int end = MIN((max_pitch >> 1), 2 * best_pitch[j] + 3);
+      if (start >= end)
          continue;
-      sum = celt_inner_prod(x_lp, y + i, len >> 1);
-
-      xcorr[i] = MAX(-1, sum);
+      rnn_pitch_xcorr(x_lp, y + start, xcorr + start, len >> 1, end - start);
+      for (i = start; i < end; i++)
+         xcorr[i] = MAX(-1, xcorr[i]);
    }
    find_best_pitch(xcorr, y, len >> 1, max_pitch >> 1, best_pitch);
 
@@ -352,21 +405,6 @@ void rnn_pitch_search(const float_t *x_lp, float_t *y, int len, int max_pitch, i
    *pitch = 2 * best_pitch[0] - offset;
 }
 
-static void dual_inner_prod(const float_t *x, const float_t *y01, const float_t *y02,
-                            int N, float_t *xy1, float_t *xy2)
-{
-   int i;
-   float_t xy01 = 0;
-   float_t xy02 = 0;
-   for (i = 0; i < N; i++)
-   {
-      xy01 = MAC(xy01, x[i], y01[i]);
-      xy02 = MAC(xy02, x[i], y02[i]);
-   }
-   *xy1 = xy01;
-   *xy2 = xy02;
-}
-
 static float_t compute_pitch_gain(float_t xy, float_t xx, float_t yy)
 {
    return xy / (float)sqrt(1 + xx * yy);
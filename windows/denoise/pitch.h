@@ -9,4 +9,13 @@ void rnn_pitch_search(const float_t *x_lp, float_t *y, int len, int max_pitch, i
 
 float_t rnn_remove_doubling(float_t *x, int maxperiod, int minperiod, int N, int *T0, int prev_period, float_t prev_gain);
 
+// xcorr[i] = <x, y + i> for i < max_pitch (y holds len + max_pitch - 1 samples), with the
+// kernel the pitch search uses at the current rnn_arch
+void rnn_xcorr(const float_t *x, const float_t *y, float_t *xcorr, int len, int max_pitch);
+
+// pitch_avx2.c
+void rnn_pitch_xcorr_avx2(const float_t *x, const float_t *y, float_t *xcorr, int len, int max_pitch);
+float_t celt_inner_prod_avx2(const float_t *x, const float_t *y, int N);
+void dual_inner_prod_avx2(const float_t *x, const float_t *y01, const float_t *y02, int N, float_t *xy1, float_t *xy2);
+
 #endif /* PITCH_H */
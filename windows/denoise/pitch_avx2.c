@@ -0,0 +1,96 @@
+#include "pitch.h"
+#include "x86cpu.h"
+
+#if defined(RNN_X86)
+#include <immintrin.h> // AVX, FMA
+
+/* Eight lags per register: lane k accumulates x[j] * y[i + k + j] over j in the same order as
+   xcorr_kernel(), with a separate multiply and add (AVX, no FMA), so the result is bit-identical
+   to the scalar cross-correlation. Four registers in flight hide the add latency. */
+RNN_TARGET_AVX
+void rnn_pitch_xcorr_avx2(const float_t *x, const float_t *y, float_t *xcorr, int len, int max_pitch)
+{
+   int i = 0;
+   for (; i + 32 <= max_pitch; i += 32)
+   {
+      __m256 s0 = _mm256_setzero_ps(), s1 = s0, s2 = s0, s3 = s0;
+      for (int j = 0; j < len; j++)
+      {
+         const __m256 vx = _mm256_broadcast_ss(&x[j]);
+         const float_t *yj = &y[i + j];
+         s0 = _mm256_add_ps(s0, _mm256_mul_ps(vx, _mm256_loadu_ps(yj)));
+         s1 = _mm256_add_ps(s1, _mm256_mul_ps(vx, _mm256_loadu_ps(yj + 8)));
+         s2 = _mm256_add_ps(s2, _mm256_mul_ps(vx, _mm256_loadu_ps(yj + 16)));
+         s3 = _mm256_add_ps(s3, _mm256_mul_ps(vx, _mm256_loadu_ps(yj + 24)));
+      }
+      _mm256_storeu_ps(&xcorr[i], s0);
+      _mm256_storeu_ps(&xcorr[i + 8], s1);
+      _mm256_storeu_ps(&xcorr[i + 16], s2);
+      _mm256_storeu_ps(&xcorr[i + 24], s3);
+   }
+   for (; i + 8 <= max_pitch; i += 8)
+   {
+      __m256 s = _mm256_setzero_ps();
+      for (int j = 0; j < len; j++)
+         s = _mm256_add_ps(s, _mm256_mul_ps(_mm256_broadcast_ss(&x[j]), _mm256_loadu_ps(&y[i + j])));
+      _mm256_storeu_ps(&xcorr[i], s);
+   }
+   // Lags past the last full register must not read y beyond max_pitch + len
+   for (; i < max_pitch; i++)
+   {
+      float_t sum = 0;
+      for (int j = 0; j < len; j++)
+         sum = MAC(sum, x[j], y[i + j]);
+      xcorr[i] = sum;
+   }
+}
+
+RNN_TARGET_AVX2
+static inline float hsum(__m256 v)
+{
+   __m128 s = _mm_add_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1));
+   s = _mm_add_ps(s, _mm_movehl_ps(s, s));
+   s = _mm_add_ss(s, _mm_movehdup_ps(s));
+   return _mm_cvtss_f32(s);
+}
+
+/* Inner products for rnn_remove_doubling(), where every candidate lag is different and the
+   lag-parallel form does not apply: eight partial sums per register with fused multiply-adds.
+   Not bit-identical to the sequential C sums. */
+RNN_TARGET_AVX2
+float_t celt_inner_prod_avx2(const float_t *x, const float_t *y, int N)
+{
+   __m256 s0 = _mm256_setzero_ps(), s1 = s0;
+   int i = 0;
+   for (; i + 16 <= N; i += 16)
+   {
+      s0 = _mm256_fmadd_ps(_mm256_loadu_ps(&x[i]), _mm256_loadu_ps(&y[i]), s0);
+      s1 = _mm256_fmadd_ps(_mm256_loadu_ps(&x[i + 8]), _mm256_loadu_ps(&y[i + 8]), s1);
+   }
+   float_t xy = hsum(_mm256_add_ps(s0, s1));
+   for (; i < N; i++)
+      xy = MAC(xy, x[i], y[i]);
+   return xy;
+}
+
+RNN_TARGET_AVX2
+void dual_inner_prod_avx2(const float_t *x, const float_t *y01, const float_t *y02, int N, float_t *xy1, float_t *xy2)
+{
+   __m256 s1 = _mm256_setzero_ps(), s2 = s1;
+   int i = 0;
+   for (; i + 8 <= N; i += 8)
+   {
+      const __m256 vx = _mm256_loadu_ps(&x[i]);
+      s1 = _mm256_fmadd_ps(vx, _mm256_loadu_ps(&y01[i]), s1);
+      s2 = _mm256_fmadd_ps(vx, _mm256_loadu_ps(&y02[i]), s2);
+   }
+   float_t a = hsum(s1), b = hsum(s2);
+   for (; i < N; i++)
+   {
+      a = MAC(a, x[i], y01[i]);
+      b = MAC(b, x[i], y02[i]);
+   }
+   *xy1 = a;
+   *xy2 = b;
+}
+#endif
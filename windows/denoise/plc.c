@@ -0,0 +1,144 @@
+#include <stdlib.h>
+
+#include "pcm.h"
+#include "pitch.h"
+#include "plc.h"
+#include "spectral.h"
+#include "x86cpu.h"
+
+PlcState *plc_create(int channels, int hop)
+{
+  PlcState *st;
+  if (channels < 1 || channels > PLC_MAX_CHANNELS || (hop != SPECTRAL_FRAME_SIZE && hop != FRAME_SIZE))
+    return NULL;
+  rnn_init_arch(); // the pitch search kernels
+  st = (PlcState *)malloc(sizeof(PlcState));
+  if (!st)
+    return NULL;
+  memset(st, 0, sizeof(PlcState));
+  st->channels = channels;
+  st->hop = hop;
+  st->max_period = PITCH_MAX_PERIOD * hop / FRAME_SIZE;
+  st->min_period = PITCH_MIN_PERIOD * hop / FRAME_SIZE;
+  st->pitch_frame = PITCH_FRAME_SIZE * hop / FRAME_SIZE;
+  st->hist_size = st->max_period + st->pitch_frame;
+  st->delay = hop / 4;
+  return st;
+}
+
+void plc_destroy(PlcState *st)
+{
+  free(st);
+}
+
+// Level of sample i of the frame-th concealed frame (from 1): full for the first frame, then
+// falling linearly to zero over PLC_FADE_FRAMES
+static float fade(const PlcState *st, int frame, int i)
+{
+  if (frame <= 1)
+    return 1.f;
+  float level = 1.f - (float)((frame - 2) * st->hop + i + 1) / (float)(PLC_FADE_FRAMES * st->hop);
+  return MAX(level, 0.f);
+}
+
+// Appends a frame to the history and writes out the frame that is now delay samples old
+static void append(PlcState *st, opus_int16 *out, float frame[PLC_MAX_CHANNELS][FRAME_SIZE])
+{
+  const int hop = st->hop;
+  for (int c = 0; c < st->channels; c++)
+  {
+    float *hist = st->hist[c];
+    RNN_MOVE(hist, &hist[hop], st->hist_size - hop);
+    RNN_COPY(&hist[st->hist_size - hop], frame[c], hop);
+    for (int i = 0; i < hop; i++)
+      out[i * st->channels + c] = rnn_float2s16(hist[st->hist_size - st->delay - hop + i]);
+  }
+}
+
+// Picks the period to repeat, with the denoiser's pitch search over the history
+static void start_concealment(PlcState *st)
+{
+  float x_lp[PITCH_BUF_SIZE >> 1];
+  float *pre[PLC_MAX_CHANNELS];
+  const int size = st->hist_size;
+  int period;
+  float gain;
+  for (int c = 0; c < st->channels; c++)
+    pre[c] = st->hist[c];
+  rnn_pitch_downsample(pre, x_lp, size, st->channels);
+  rnn_pitch_search(x_lp + (st->max_period >> 1), x_lp, st->pitch_frame,
+                   st->max_period - 3 * st->min_period, &period);
+  period = st->max_period - period;
+  gain = rnn_remove_doubling(x_lp, st->max_period, st->min_period, st->pitch_frame, &period,
+                             st->last_period, st->last_gain);
+  st->last_period = period;
+  st->last_gain = gain;
+  if (gain < PLC_VOICED_GAIN)
+    period = st->max_period; // no pitch: a long stretch repeated buzzes less than a short one
+
+  // The period ends where the history ends, so it repeats seamlessly once its end blends into
+  // the samples before its start. The blend is within the held-back samples, not yet played.
+  const int overlap = MIN(st->delay, MAX(period / 4, 1));
+  for (int c = 0; c < st->channels; c++)
+  {
+    float *end = &st->hist[c][size - overlap];
+    for (int i = 0; i < overlap; i++)
+    {
+      float a = (float)(i + 1) / (float)(overlap + 1);
+      end[i] = (1.f - a) * end[i] + a * end[i - period];
+    }
+    RNN_COPY(st->period[c], &st->hist[c][size - period], period);
+  }
+  st->period_size = period;
+  st->phase = 0;
+}
+
+void plc_good(PlcState *st, opus_int16 *out, const opus_int16 *in)
+{
+  float frame[PLC_MAX_CHANNELS][FRAME_SIZE];
+  for (int c = 0; c < st->channels; c++)
+    for (int i = 0; i < st->hop; i++)
+      frame[c][i] = (float)in[i * st->channels + c];
+
+  if (st->period_size)
+  {
+    // Fade in from where the repetition would have gone on
+    const int overlap = st->hop / 2;
+    for (int c = 0; c < st->channels; c++)
+    {
+      int phase = st->phase;
+      for (int i = 0; i < overlap; i++)
+      {
+        float a = (float)(i + 1) / (float)(overlap + 1);
+        frame[c][i] = a * frame[c][i] + (1.f - a) * fade(st, st->lost + 1, i) * st->period[c][phase];
+        if (++phase == st->period_size)
+          phase = 0;
+      }
+    }
+    st->period_size = 0;
+    st->lost = 0;
+  }
+  append(st, out, frame);
+}
+
+int plc_conceal(PlcState *st, opus_int16 *out)
+{
+  float frame[PLC_MAX_CHANNELS][FRAME_SIZE];
+  int phase = 0;
+  if (!st->period_size)
+    start_concealment(st);
+  st->lost++;
+  for (int c = 0; c < st->channels; c++)
+  {
+    phase = st->phase;
+    for (int i = 0; i < st->hop; i++)
+    {
+      frame[c][i] = fade(st, st->lost, i) * st->period[c][phase];
+      if (++phase == st->period_size)
+        phase = 0;
+    }
+  }
+  st->phase = phase;
+  append(st, out, frame);
+  return st->lost <= PLC_FADE_FRAMES + 1;
+}
@@ -0,0 +1,64 @@
+#ifndef PLC_H
+#define PLC_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "rnn.h"
+
+/*
+ * Packet loss concealment for playback. A missing 10ms frame (160 samples at 16 kHz or 480
+ * at 48 kHz per channel) is replaced by the last pitch period of the stream, repeated, after
+ * the period's end is crossfaded into the samples before its start so the repetition has no
+ * seam. The pitch comes from the same estimator as the denoiser's features. The first
+ * concealed frame plays at full level, then the level falls linearly to silence over
+ * PLC_FADE_FRAMES more; the next good frame is crossfaded in from the repetition. Output is
+ * held back 2.5ms (a quarter frame), so the start of a loss can still be blended into.
+ */
+#define PLC_MAX_CHANNELS 2
+#define PLC_FADE_FRAMES 5   // concealed frames after the first until silence
+#define PLC_VOICED_GAIN .3f // below this pitch gain the longest period is repeated, not the pitch
+
+typedef struct
+{
+  int channels;
+  int hop;         // samples per channel per frame
+  int max_period;  // the denoiser's pitch range and analysis frame, scaled to the stream rate
+  int min_period;
+  int pitch_frame;
+  int hist_size;   // max_period + pitch_frame
+  int delay;       // samples per channel held back
+  float hist[PLC_MAX_CHANNELS][PITCH_BUF_SIZE]; // the stream as played, concealment included; its last delay samples are not out yet
+  float period[PLC_MAX_CHANNELS][PITCH_MAX_PERIOD]; // what a loss repeats
+  int period_size; // 0 while the stream is not concealed
+  int phase;       // next sample of period
+  int lost;        // frames concealed in a row
+  int last_period; // pitch tracking for rnn_remove_doubling
+  float last_gain;
+} PlcState;
+
+/**
+ * hop is 160 (16 kHz) or 480 (48 kHz) and channels at most PLC_MAX_CHANNELS; NULL otherwise.
+ */
+PlcState *plc_create(int channels, int hop);
+
+void plc_destroy(PlcState *st);
+
+/**
+ * A frame that arrived: out gets one frame of interleaved output, delay samples behind in.
+ * After a loss, in fades in from the repetition over half a frame.
+ */
+void plc_good(PlcState *st, opus_int16 *out, const opus_int16 *in);
+
+/**
+ * A frame that did not arrive: out gets one frame of concealment. Returns 0 once the
+ * concealment has faded out; later frames only repeat silence.
+ */
+int plc_conceal(PlcState *st, opus_int16 *out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PLC_H */
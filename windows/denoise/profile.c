@@ -0,0 +1,114 @@
+#include <string.h> // memset
+#if defined(_MSC_VER)
+#include <intrin.h> // _BitScanReverse
+#endif
+
+#include "profile.h"
+
+static const char *stage_names[RNN_STAGE_COUNT] = {
+    "analysis", "pitch_downsample", "pitch_search", "remove_doubling", "features",
+    "rnn", "pitch_filter", "synthesis", "frame"};
+
+const char *rnn_profile_stage_name(int stage)
+{
+  return stage >= 0 && stage < RNN_STAGE_COUNT ? stage_names[stage] : NULL;
+}
+
+#if defined(RNN_PROFILE)
+static int floor_log2(unsigned int v)
+{
+#if defined(_MSC_VER)
+  unsigned long e;
+  _BitScanReverse(&e, v);
+  return (int)e;
+#else
+  return 31 - __builtin_clz(v);
+#endif
+}
+
+static int bucket_of(unsigned long long ticks)
+{
+  unsigned int v = ticks > 0xffffffffull ? 0xffffffffu : (unsigned int)ticks;
+  if (v < 8)
+    return (int)v;
+  int e = floor_log2(v);
+  return (e - 2) * 8 + (int)((v >> (e - 3)) & 7);
+}
+
+static unsigned long long bucket_mid(int b)
+{
+  if (b < 8)
+    return (unsigned long long)b;
+  int e = b / 8 + 2;
+  unsigned long long width = 1ull << (e - 3);
+  return (8 + b % 8) * width + width / 2;
+}
+
+void rnn_profile_add(RNNProfile *p, int stage, unsigned long long ticks)
+{
+  p->hist[stage][bucket_of(ticks)]++;
+  p->sum[stage] += ticks;
+  if (ticks > p->max[stage])
+    p->max[stage] = ticks;
+  p->frame += ticks;
+}
+
+void rnn_profile_lap(RNNProfile *p, int stage)
+{
+  unsigned long long now = rnn_ticks();
+  rnn_profile_add(p, stage, now - p->last);
+  p->last = now;
+}
+
+void rnn_profile_end(RNNProfile *p)
+{
+  unsigned long long frame = p->frame;
+  rnn_profile_add(p, RNN_STAGE_FRAME, frame);
+}
+
+int rnn_profile_stats(const RNNProfile *p, int stage, RNNProfileStats *stats)
+{
+  if (stage < 0 || stage >= RNN_STAGE_COUNT)
+    return -1;
+  memset(stats, 0, sizeof(*stats));
+  const unsigned int *h = p->hist[stage];
+  unsigned int count = 0;
+  for (int b = 0; b < RNN_PROFILE_BUCKETS; b++)
+    count += h[b];
+  if (count == 0)
+    return 0;
+
+  // Smallest buckets holding at least half / 99% of the frames
+  const unsigned long long want50 = ((unsigned long long)count * 50 + 99) / 100;
+  const unsigned long long want99 = ((unsigned long long)count * 99 + 99) / 100;
+  unsigned long long seen = 0;
+  int b50 = -1, b99 = -1;
+  for (int b = 0; b < RNN_PROFILE_BUCKETS && b99 < 0; b++)
+  {
+    seen += h[b];
+    if (b50 < 0 && seen >= want50)
+      b50 = b;
+    if (seen >= want99)
+      b99 = b;
+  }
+  stats->count = count;
+  stats->p50 = bucket_mid(b50);
+  stats->p99 = bucket_mid(b99);
+  stats->max = p->max[stage];
+  stats->mean = (double)p->sum[stage] / count;
+  // A bucket midpoint can overshoot the largest sample in it
+  if (stats->p50 > stats->max)
+    stats->p50 = stats->max;
+  if (stats->p99 > stats->max)
+    stats->p99 = stats->max;
+  return 0;
+}
+#else
+int rnn_profile_stats(const RNNProfile *p, int stage, RNNProfileStats *stats)
+{
+  (void)p;
+  (void)stage;
+  memset(stats, 0, sizeof(*stats));
+  return -1;
+}
+#endif
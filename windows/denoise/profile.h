@@ -0,0 +1,112 @@
+#ifndef PROFILE_H
+#define PROFILE_H
+
+// Per-stage tick counters for rnnoise_process_frame(). On by default in debug builds and
+// compiled out under NDEBUG; define RNN_PROFILE to keep them in a release build.
+#if !defined(RNN_PROFILE) && !defined(NDEBUG)
+#define RNN_PROFILE 1
+#endif
+
+#if defined(RNN_PROFILE)
+#include "x86cpu.h" // RNN_X86
+#if defined(RNN_X86) && defined(_MSC_VER)
+#include <intrin.h> // __rdtsc
+#elif defined(RNN_X86)
+#include <x86intrin.h> // __rdtsc
+#elif defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h> // QueryPerformanceCounter
+#else
+#include <time.h> // clock_gettime
+#endif
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum
+{
+  RNN_STAGE_ANALYSIS,         // high-pass, window, forward FFT, band energies
+  RNN_STAGE_PITCH_DOWNSAMPLE, // pitch history append and rnn_pitch_downsample
+  RNN_STAGE_PITCH_SEARCH,     // rnn_pitch_search
+  RNN_STAGE_REMOVE_DOUBLING,  // rnn_remove_doubling
+  RNN_STAGE_FEATURES,         // pitch spectrum, correlations, cepstrum
+  RNN_STAGE_RNN,              // compute_rnn (a batch's time is split evenly between its states)
+  RNN_STAGE_PITCH_FILTER,     // rnn_pitch_filter
+  RNN_STAGE_SYNTHESIS,        // gain smoothing, interpolation, inverse FFT, overlap-add
+  RNN_STAGE_FRAME,            // sum of the above for one frame
+  RNN_STAGE_COUNT
+} RNNStage;
+
+// Log-linear histogram: exact below 8 ticks, then 8 buckets per power of two (<= 12.5% wide)
+#define RNN_PROFILE_BUCKETS 240
+
+typedef struct
+{
+  unsigned long long last;  // tick count at the end of the previous stage
+  unsigned long long frame; // ticks recorded so far in the current frame
+  unsigned int hist[RNN_STAGE_COUNT][RNN_PROFILE_BUCKETS];
+  unsigned long long sum[RNN_STAGE_COUNT];
+  unsigned long long max[RNN_STAGE_COUNT];
+} RNNProfile;
+
+typedef struct
+{
+  unsigned int count;      // frames recorded
+  unsigned long long p50;  // ticks, bucket midpoint
+  unsigned long long p99;  // ticks, bucket midpoint
+  unsigned long long max;  // ticks, exact
+  double mean;             // ticks, exact
+} RNNProfileStats;
+
+#if defined(RNN_PROFILE)
+// TSC cycles on x86, otherwise the finest monotonic clock available
+static inline unsigned long long rnn_ticks(void)
+{
+#if defined(RNN_X86)
+  return __rdtsc();
+#elif defined(_WIN32)
+  LARGE_INTEGER t;
+  QueryPerformanceCounter(&t);
+  return (unsigned long long)t.QuadPart;
+#else
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (unsigned long long)ts.tv_sec * 1000000000ull + (unsigned long long)ts.tv_nsec;
+#endif
+}
+
+void rnn_profile_add(RNNProfile *p, int stage, unsigned long long ticks);
+void rnn_profile_lap(RNNProfile *p, int stage);
+void rnn_profile_end(RNNProfile *p);
+
+#define PROFILE_BEGIN(p) ((p)->frame = 0, (p)->last = rnn_ticks())
+#define PROFILE_RESUME(p) ((p)->last = rnn_ticks())
+#define PROFILE_LAP(p, stage) rnn_profile_lap(p, stage)
+#define PROFILE_ADD(p, stage, ticks) rnn_profile_add(p, stage, ticks)
+#define PROFILE_END(p) rnn_profile_end(p)
+#else
+#define PROFILE_BEGIN(p)
+#define PROFILE_RESUME(p)
+#define PROFILE_LAP(p, stage)
+#define PROFILE_ADD(p, stage, ticks)
+#define PROFILE_END(p)
+#endif
+
+/**
+ * Summarize one stage's histogram. Returns 0 on success, -1 if the stage is out of range
+ * or the counters were compiled out.
+ */
+int rnn_profile_stats(const RNNProfile *p, int stage, RNNProfileStats *stats);
+
+/**
+ * Short lowercase name of a stage ("analysis", "pitch_search", ...), or NULL if out of range.
+ */
+const char *rnn_profile_stage_name(int stage);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PROFILE_H */
@@ -1,19 +1,111 @@
+#include <stdlib.h> // malloc, free
+
 #include "nnet.h"
 
-int FULL_DENOISE = 1;
+void compute_rnn(const RNNoise *model, RNNState *rnn, float *gains, float *vad, const float *input, int full_denoise)
+{
+  RNNScratch *scratch = &rnn->scratch;
+  float *tmp = scratch->conv1_out;
+  float *cat = scratch->cat;
+  const int C2 = RNN_CONV2_SIZE(model), G = RNN_GRU_SIZE(model);
+  compute_generic_conv1d(&model->conv1, tmp, rnn->conv1_state, input, CONV1_IN_SIZE, ACTIVATION_TANH, full_denoise, scratch);
+  compute_generic_conv1d(&model->conv2, cat, rnn->conv2_state, tmp, RNN_CONV1_SIZE(model), ACTIVATION_TANH, full_denoise, scratch);
+  compute_generic_gru(&model->gru1_input, &model->gru1_recurrent, rnn->gru1_state, cat, full_denoise, scratch);
+  compute_generic_gru(&model->gru2_input, &model->gru2_recurrent, rnn->gru2_state, rnn->gru1_state, full_denoise, scratch);
+  compute_generic_gru(&model->gru3_input, &model->gru3_recurrent, rnn->gru3_state, rnn->gru2_state, full_denoise, scratch);
+  RNN_COPY(&cat[C2], rnn->gru1_state, G);
+  RNN_COPY(&cat[C2 + G], rnn->gru2_state, G);
+  RNN_COPY(&cat[C2 + G + G], rnn->gru3_state, G);
+  compute_generic_dense(&model->dense_out, gains, cat, ACTIVATION_SIGMOID, full_denoise, scratch);
+  compute_generic_dense(&model->vad_dense, vad, cat, ACTIVATION_SIGMOID, full_denoise, scratch);
+}
+
+void compute_rnn_silence(const RNNoise *model, RNNState *rnn)
+{
+  const int C1 = RNN_CONV1_SIZE(model);
+  RNN_MOVE(rnn->conv1_state, &rnn->conv1_state[CONV1_IN_SIZE], CONV1_STATE_SIZE - CONV1_IN_SIZE);
+  RNN_CLEAR(&rnn->conv1_state[CONV1_STATE_SIZE - CONV1_IN_SIZE], CONV1_IN_SIZE);
+  RNN_MOVE(rnn->conv2_state, &rnn->conv2_state[C1], C1);
+  RNN_CLEAR(&rnn->conv2_state[C1], C1);
+  for (int i = 0; i < RNN_GRU_SIZE(model); i++)
+  {
+    rnn->gru1_state[i] *= RNN_SILENCE_DECAY;
+    rnn->gru2_state[i] *= RNN_SILENCE_DECAY;
+    rnn->gru3_state[i] *= RNN_SILENCE_DECAY;
+  }
+}
+
+void compute_rnn_batch(const RNNoise *model, RNNState *const *rnn, float *const *gains, float *const *vad, const float *const *input, int K, int full_denoise)
+{
+  RNNScratch *scratch[RNN_MAX_BATCH];
+  float *tmp[RNN_MAX_BATCH], *cat[RNN_MAX_BATCH];
+  float *conv1_state[RNN_MAX_BATCH], *conv2_state[RNN_MAX_BATCH];
+  float *gru1_state[RNN_MAX_BATCH], *gru2_state[RNN_MAX_BATCH], *gru3_state[RNN_MAX_BATCH];
+  const int C2 = RNN_CONV2_SIZE(model), G = RNN_GRU_SIZE(model);
+  if (K < 1 || K > RNN_MAX_BATCH)
+    return;
+  if (K == 1)
+  {
+    // Nothing to share, and the matrix-vector kernels keep everything in registers
+    compute_rnn(model, rnn[0], gains[0], vad[0], input[0], full_denoise);
+    return;
+  }
+  for (int k = 0; k < K; k++)
+  {
+    scratch[k] = &rnn[k]->scratch;
+    tmp[k] = scratch[k]->conv1_out;
+    cat[k] = scratch[k]->cat;
+    conv1_state[k] = rnn[k]->conv1_state;
+    conv2_state[k] = rnn[k]->conv2_state;
+    gru1_state[k] = rnn[k]->gru1_state;
+    gru2_state[k] = rnn[k]->gru2_state;
+    gru3_state[k] = rnn[k]->gru3_state;
+  }
+  compute_generic_conv1d_batch(&model->conv1, tmp, conv1_state, input, CONV1_IN_SIZE, ACTIVATION_TANH, full_denoise, scratch, K);
+  compute_generic_conv1d_batch(&model->conv2, cat, conv2_state, (const float *const *)tmp, RNN_CONV1_SIZE(model), ACTIVATION_TANH, full_denoise, scratch, K);
+  compute_generic_gru_batch(&model->gru1_input, &model->gru1_recurrent, gru1_state, (const float *const *)cat, full_denoise, scratch, K);
+  compute_generic_gru_batch(&model->gru2_input, &model->gru2_recurrent, gru2_state, (const float *const *)gru1_state, full_denoise, scratch, K);
+  compute_generic_gru_batch(&model->gru3_input, &model->gru3_recurrent, gru3_state, (const float *const *)gru2_state, full_denoise, scratch, K);
+  for (int k = 0; k < K; k++)
+  {
+    RNN_COPY(&cat[k][C2], gru1_state[k], G);
+    RNN_COPY(&cat[k][C2 + G], gru2_state[k], G);
+    RNN_COPY(&cat[k][C2 + G + G], gru3_state[k], G);
+  }
+  compute_generic_dense_batch(&model->dense_out, gains, (const float *const *)cat, ACTIVATION_SIGMOID, full_denoise, scratch, K);
+  compute_generic_dense_batch(&model->vad_dense, vad, (const float *const *)cat, ACTIVATION_SIGMOID, full_denoise, scratch, K);
+}
+
+LinearLayer *rnnoise_layer(RNNoise *model, int i)
+{
+  LinearLayer *layers[] = {
+      &model->conv1, &model->conv2,
+      &model->gru1_input, &model->gru1_recurrent,
+      &model->gru2_input, &model->gru2_recurrent,
+      &model->gru3_input, &model->gru3_recurrent,
+      &model->dense_out, &model->vad_dense};
+  return i < (int)(sizeof(layers) / sizeof(layers[0])) ? layers[i] : NULL;
+}
+
+int rnnoise_repack(RNNoise *model)
+{
+  size_t size = 0;
+  LinearLayer *layer;
+  for (int i = 0; (layer = rnnoise_layer(model, i)) != NULL; i++)
+    size += linear_repack_size(layer);
+
+  char *raw = (char *)malloc(size + 64);
+  if (!raw)
+    return 1;
+  char *arena = (char *)(((uintptr_t)raw + 63) & ~(uintptr_t)63);
+  for (int i = 0; (layer = rnnoise_layer(model, i)) != NULL; i++)
+    linear_repack(layer, &arena);
+  model->arena = raw;
+  return 0;
+}
 
-void compute_rnn(const RNNoise *model, RNNState *rnn, float *gains, float *vad, const float *input)
+void rnnoise_free_packed(RNNoise *model)
 {
-  float tmp[MAX_NEURONS];
-  float cat[GRU_STATE_SIZE + GRU_STATE_SIZE + GRU_STATE_SIZE + GRU_STATE_SIZE];
-  compute_generic_conv1d(&model->conv1, tmp, rnn->conv1_state, input, CONV1_IN_SIZE, ACTIVATION_TANH);
-  compute_generic_conv1d(&model->conv2, cat, rnn->conv2_state, tmp, CONV2_IN_SIZE, ACTIVATION_TANH);
-  compute_generic_gru(&model->gru1_input, &model->gru1_recurrent, rnn->gru1_state, cat);
-  compute_generic_gru(&model->gru2_input, &model->gru2_recurrent, rnn->gru2_state, rnn->gru1_state);
-  compute_generic_gru(&model->gru3_input, &model->gru3_recurrent, rnn->gru3_state, rnn->gru2_state);
-  RNN_COPY(&cat[GRU_STATE_SIZE], rnn->gru1_state, GRU_STATE_SIZE);
-  RNN_COPY(&cat[GRU_STATE_SIZE + GRU_STATE_SIZE], rnn->gru2_state, GRU_STATE_SIZE);
-  RNN_COPY(&cat[GRU_STATE_SIZE + GRU_STATE_SIZE + GRU_STATE_SIZE], rnn->gru3_state, GRU_STATE_SIZE);
-  compute_generic_dense(&model->dense_out, gains, cat, ACTIVATION_SIGMOID);
-  compute_generic_dense(&model->vad_dense, vad, cat, ACTIVATION_SIGMOID);
+  free(model->arena);
+  model->arena = NULL;
 }
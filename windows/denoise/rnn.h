@@ -4,8 +4,6 @@
 #include <string.h> // memcpy, memmove, memset
 #include <stdint.h> // int16_t, int32_t, uint32_t
 
-extern int FULL_DENOISE;
-
 typedef int16_t opus_int16;
 typedef int32_t opus_int32;
 typedef uint32_t opus_uint32;
@@ -34,10 +32,16 @@ typedef float float_t;
 #define CONV1_IN_SIZE 65
 #define CONV1_STATE_SIZE (CONV1_IN_SIZE * (2))
 
+// Layer sizes of the built-in model
 #define GRU_STATE_SIZE 384
 #define CONV2_IN_SIZE 128
 #define CONV2_STATE_SIZE (CONV2_IN_SIZE * (2))
 
+// Largest layers a model file may use (model.h); RNNState is sized for them
+#define RNN_MAX_CONV_SIZE 512 // conv1 and conv2 outputs
+#define RNN_MAX_GRU_SIZE 512
+#define RNN_MAX_CAT_SIZE (RNN_MAX_CONV_SIZE + 3 * RNN_MAX_GRU_SIZE) // conv2 output + the three GRU states
+
 #define ACTIVATION_SIGMOID 1
 #define ACTIVATION_TANH 2
 
@@ -47,6 +51,7 @@ typedef float float_t;
 
 // nnet.c
 #define MAX_INPUTS (2048)
+#define RNN_MAX_BATCH 16 // streams per compute_rnn_batch() call
 #define fmadd(a, b, c) ((a) * (b) + (c))
 
 #define VAL(name, x, value) (x)
@@ -73,13 +78,26 @@ typedef struct
   const void *data;
 } WeightArray;
 
+/* Per-state working memory for compute_rnn(), so the audio thread never builds
+   the layer buffers on its own stack. Nothing in it survives from one frame to the next. */
+typedef struct
+{
+  float conv_in[3 * RNN_MAX_CONV_SIZE]; /* conv history + new input, conv1 fits too */
+  float conv1_out[RNN_MAX_CONV_SIZE];
+  float cat[RNN_MAX_CAT_SIZE];
+  float gru_out[RNN_MAX_GRU_SIZE];
+  opus_int8 in_q[RNN_MAX_CAT_SIZE];
+  opus_int8 state_q[RNN_MAX_GRU_SIZE];
+} RNNScratch;
+
 typedef struct
 {
   float conv1_state[CONV1_STATE_SIZE];
-  float conv2_state[CONV2_STATE_SIZE];
-  float gru1_state[GRU_STATE_SIZE];
-  float gru2_state[GRU_STATE_SIZE];
-  float gru3_state[GRU_STATE_SIZE];
+  float conv2_state[2 * RNN_MAX_CONV_SIZE];
+  float gru1_state[RNN_MAX_GRU_SIZE];
+  float gru2_state[RNN_MAX_GRU_SIZE];
+  float gru3_state[RNN_MAX_GRU_SIZE];
+  RNNScratch scratch;
 } RNNState;
 
 /* Generic sparse affine transformation. */
@@ -91,8 +109,10 @@ typedef struct
   const int *weights_idx;
   const float *diag;
   const float *scale;
+  const int *group_blocks; /* Repacked sparse layers: first block of each 8-row group */
   int nb_inputs;
   int nb_outputs;
+  int panel_rows; /* Repacked dense float layers: rows per panel, 0 for the exported layout */
 } LinearLayer;
 
 typedef struct
@@ -107,8 +127,51 @@ typedef struct
   LinearLayer gru3_recurrent;
   LinearLayer dense_out;
   LinearLayer vad_dense;
+  void *arena; /* Owns the repacked weights, see rnnoise_repack() */
 } RNNoise;
 
-void compute_rnn(const RNNoise *model, RNNState *rnn, float *gains, float *vad, const float *input);
+/* Layer sizes are taken from the model, so a model file can be smaller or larger than the
+   built-in one (up to RNN_MAX_CONV_SIZE / RNN_MAX_GRU_SIZE). */
+#define RNN_CONV1_SIZE(model) ((model)->conv1.nb_outputs)
+#define RNN_CONV2_SIZE(model) ((model)->conv2.nb_outputs)
+#define RNN_GRU_SIZE(model) ((model)->gru1_recurrent.nb_inputs)
+
+/**
+ * Run the network on one feature frame. full_denoise selects the int8 block order
+ * (row-major for FULL, column-major for SOFT) for this stream only.
+ */
+void compute_rnn(const RNNoise *model, RNNState *rnn, float *gains, float *vad, const float *input, int full_denoise);
+
+/**
+ * Stand-in for compute_rnn() on a silent frame: the convolution histories shift in zeros and
+ * the GRU states decay by RNN_SILENCE_DECAY, so after a pause the network restarts close to
+ * its initial state instead of from the last speech it heard.
+ */
+#define RNN_SILENCE_DECAY .5f
+void compute_rnn_silence(const RNNoise *model, RNNState *rnn);
+
+/**
+ * compute_rnn() for 1 <= K <= RNN_MAX_BATCH independent streams sharing one model and setting
+ * (any other K computes nothing).
+ * The layers run as matrix-matrix products, so each weight is fetched once per batch
+ * instead of once per stream. Stream k gets the same result as compute_rnn() alone.
+ */
+void compute_rnn_batch(const RNNoise *model, RNNState *const *rnn, float *const *gains, float *const *vad, const float *const *input, int K, int full_denoise);
+
+/**
+ * Layer i of the model in struct order (conv1 first, vad_dense last), NULL past the last one.
+ */
+LinearLayer *rnnoise_layer(RNNoise *model, int i);
+
+/**
+ * Copy every layer's weights into one 64-byte aligned arena laid out in kernel access order.
+ * Returns 0 on success; the model keeps pointing at the static arrays on failure.
+ */
+int rnnoise_repack(RNNoise *model);
+
+/**
+ * Free the arena allocated by rnnoise_repack(). The layers must be re-initialized before reuse.
+ */
+void rnnoise_free_packed(RNNoise *model);
 
 #endif /* RNN_H */
@@ -0,0 +1,1715 @@
+// Generated by tools/gen_tables.c, do not edit.
+
+#include "denoise.h"
+#include "spectral.h"
+
+static const kiss_fft_cpx fft_twiddles[960] = {
+    {1.0f, -0.0f}, {0.999978602f, -0.00654493878f}, {0.999914348f, -0.0130895972f},
+    {0.999807239f, -0.0196336936f}, {0.999657333f, -0.0261769518f}, {0.999464571f, -0.0327190831f},
+    {0.999229014f, -0.0392598175f}, {0.99895066f, -0.0457988679f}, {0.99862951f, -0.0523359627f},
+    {0.998265624f, -0.0588708073f}, {0.997858942f, -0.0654031336f}, {0.997409463f, -0.0719326586f},
+    {0.996917307f, -0.0784590989f}, {0.996382475f, -0.0849821791f}, {0.995804906f, -0.0915016234f},
+    {0.99518472f, -0.0980171412f}, {0.994521916f, -0.104528472f}, {0.993816435f, -0.11103531f},
+    {0.993068457f, -0.117537409f}, {0.99227792f, -0.124034457f}, {0.991444886f, -0.1305262f},
+    {0.990569353f, -0.137012333f}, {0.989651382f, -0.143492624f}, {0.988691032f, -0.149966747f},
+    {0.987688363f, -0.156434476f}, {0.986643314f, -0.162895471f}, {0.985556066f, -0.169349506f},
+    {0.984426558f, -0.175796285f}, {0.98325491f, -0.182235524f}, {0.982041121f, -0.18866697f},
+    {0.980785251f, -0.195090324f}, {0.979487419f, -0.201505318f}, {0.978147626f, -0.207911715f},
+    {0.976765871f, -0.214309171f}, {0.975342333f, -0.220697448f}, {0.973876953f, -0.227076262f},
+    {0.972369909f, -0.233445391f}, {0.970821202f, -0.239804476f}, {0.96923089f, -0.246153295f},
+    {0.967599094f, -0.252491564f}, {0.965925813f, -0.258819044f}, {0.964211166f, -0.265135437f},
+    {0.962455213f, -0.271440446f}, {0.960658073f, -0.277733833f}, {0.958819747f, -0.284015357f},
+    {0.956940353f, -0.290284693f}, {0.955019951f, -0.296541572f}, {0.95305866f, -0.302785784f},
+    {0.95105654f, -0.309017003f}, {0.94901365f, -0.315234989f}, {0.94693011f, -0.321439475f},
+    {0.944806039f, -0.327630192f}, {0.942641497f, -0.333806872f}, {0.940436542f, -0.339969248f},
+    {0.938191354f, -0.346117049f}, {0.935905933f, -0.352250069f}, {0.933580399f, -0.35836795f},
+    {0.931214929f, -0.364470512f}, {0.928809583f, -0.370557427f}, {0.926364362f, -0.376628518f},
+    {0.923879504f, -0.382683456f}, {0.921355128f, -0.388721973f}, {0.918791234f, -0.39474386f},
+    {0.916187942f, -0.400748819f}, {0.91354543f, -0.406736672f}, {0.910863817f, -0.412707061f},
+    {0.908143163f, -0.418659776f}, {0.905383587f, -0.424594522f}, {0.902585268f, -0.430511117f},
+    {0.899748266f, -0.436409235f}, {0.896872759f, -0.442288697f}, {0.893958807f, -0.448149174f},
+    {0.891006529f, -0.453990549f}, {0.888016105f, -0.459812403f}, {0.884987652f, -0.465614557f},
+    {0.881921232f, -0.471396744f}, {0.878817081f, -0.477158785f}, {0.875675321f, -0.482900351f},
+    {0.872496009f, -0.488621205f}, {0.869279325f, -0.494321257f}, {0.866025388f, -0.5f},
+    {0.862734377f, -0.505657375f}, {0.859406412f, -0.511293113f}, {0.85604161f, -0.516906917f},
+    {0.852640152f, -0.522498548f}, {0.849202156f, -0.528067827f}, {0.845727861f, -0.533614516f},
+    {0.842217207f, -0.539138377f}, {0.838670552f, -0.544639051f}, {0.835087955f, -0.55011642f},
+    {0.831469595f, -0.555570245f}, {0.827815592f, -0.561000288f}, {0.824126184f, -0.56640625f},
+    {0.82040143f, -0.571787953f}, {0.81664151f, -0.577145219f}, {0.812846661f, -0.582477748f},
+    {0.809017003f, -0.587785244f}, {0.805152655f, -0.593067646f}, {0.801253796f, -0.598324597f},
+    {0.797320664f, -0.603555977f}, {0.793353319f, -0.60876143f}, {0.789352059f, -0.613940835f},
+    {0.785316885f, -0.619093955f}, {0.781248152f, -0.62422061f}, {0.777145922f, -0.629320383f},
+    {0.773010433f, -0.634393334f}, {0.768841803f, -0.639438987f}, {0.764640272f, -0.64445734f},
+    {0.760405958f, -0.649448037f}, {0.7561391f, -0.654410958f}, {0.751839757f, -0.659345865f},
+    {0.747508287f, -0.66425246f}, {0.74314481f, -0.669130623f}, {0.738749444f, -0.673980117f},
+    {0.734322488f, -0.678800762f}, {0.729864061f, -0.683592319f}, {0.725374401f, -0.688354552f},
+    {0.720853567f, -0.693087399f}, {0.716301918f, -0.697790504f}, {0.711719632f, -0.702463686f},
+    {0.707106769f, -0.707106769f}, {0.702463627f, -0.711719632f}, {0.697790444f, -0.716301978f},
+    {0.693087339f, -0.720853627f}, {0.688354611f, -0.725374341f}, {0.683592319f, -0.729864061f},
+    {0.678800762f, -0.734322488f}, {0.673980117f, -0.738749504f}, {0.669130564f, -0.74314487f},
+    {0.6642524f, -0.747508347f}, {0.659345746f, -0.751839876f}, {0.654410899f, -0.7561391f},
+    {0.649448037f, -0.760406017f}, {0.64445734f, -0.764640272f}, {0.639438987f, -0.768841863f},
+    {0.634393275f, -0.773010433f}, {0.629320383f, -0.777145982f}, {0.62422055f, -0.781248152f},
+    {0.619093955f, -0.785316944f}, {0.613940835f, -0.789352f}, {0.60876143f, -0.793353319f},
+    {0.603555977f, -0.797320604f}, {0.598324597f, -0.801253796f}, {0.593067586f, -0.805152714f},
+    {0.587785184f, -0.809017062f}, {0.582477629f, -0.81284672f}, {0.577145159f, -0.816641569f},
+    {0.571787953f, -0.82040149f}, {0.56640619f, -0.824126244f}, {0.561000228f, -0.827815652f},
+    {0.555570185f, -0.831469655f}, {0.55011642f, -0.835087955f}, {0.544638991f, -0.838670611f},
+    {0.539138258f, -0.842217267f}, {0.533614516f, -0.845727801f}, {0.528067887f, -0.849202156f},
+    {0.522498608f, -0.852640152f}, {0.516906857f, -0.85604161f}, {0.511292994f, -0.859406471f},
+    {0.505657315f, -0.862734437f}, {0.49999997f, -0.866025448f}, {0.494321108f, -0.869279385f},
+    {0.488621175f, -0.872496068f}, {0.482900321f, -0.875675321f}, {0.477158755f, -0.878817141f},
+    {0.471396655f, -0.881921291f}, {0.465614468f, -0.884987652f}, {0.459812343f, -0.888016105f},
+    {0.453990519f, -0.891006529f}, {0.448149145f, -0.893958807f}, {0.442288667f, -0.896872759f},
+    {0.436409265f, -0.899748266f}, {0.430511147f, -0.902585268f}, {0.424594492f, -0.905383646f},
+    {0.418659627f, -0.908143222f}, {0.412706971f, -0.910863876f}, {0.406736612f, -0.913545489f},
+    {0.400748849f, -0.916187942f}, {0.3947438f, -0.918791234f}, {0.388721943f, -0.921355128f},
+    {0.382683426f, -0.923879504f}, {0.376628429f, -0.926364422f}, {0.370557398f, -0.928809583f},
+    {0.364470482f, -0.931214929f}, {0.35836798f, -0.933580399f}, {0.35225001f, -0.935905933f},
+    {0.346117049f, -0.938191354f}, {0.339969248f, -0.940436542f}, {0.333806813f, -0.942641497f},
+    {0.327630162f, -0.944806039f}, {0.321439356f, -0.94693017f}, {0.3152349f, -0.94901365f},
+    {0.309016973f, -0.95105654f}, {0.302785784f, -0.95305866f}, {0.296541512f, -0.955019951f},
+    {0.290284634f, -0.956940353f}, {0.284015328f, -0.958819747f}, {0.277733862f, -0.960658073f},
+    {0.271440417f, -0.962455273f}, {0.265135407f, -0.964211166f}, {0.258819073f, -0.965925813f},
+    {0.252491623f, -0.967599094f}, {0.24615328f, -0.96923089f}, {0.239804357f, -0.970821261f},
+    {0.233445302f, -0.972369909f}, {0.227076232f, -0.973877013f}, {0.220697328f, -0.975342333f},
+    {0.214309081f, -0.976765871f}, {0.207911655f, -0.978147626f}, {0.201505318f, -0.979487419f},
+    {0.195090234f, -0.98078531f}, {0.188666925f, -0.982041121f}, {0.182235524f, -0.98325491f},
+    {0.175796315f, -0.984426558f}, {0.169349447f, -0.985556066f}, {0.162895456f, -0.986643314f},
+    {0.156434491f, -0.987688363f}, {0.149966806f, -0.988691032f}, {0.143492594f, -0.989651382f},
+    {0.137012243f, -0.990569353f}, {0.130526125f, -0.991444886f}, {0.12403442f, -0.99227792f},
+    {0.117537282f, -0.993068457f}, {0.111035228f, -0.993816495f}, {0.10452842f, -0.994521916f},
+    {0.0980171338f, -0.99518472f}, {0.091501534f, -0.995804906f}, {0.084982127f, -0.996382475f},
+    {0.078459084f, -0.996917307f}, {0.0719326809f, -0.997409463f}, {0.065403074f, -0.997858942f},
+    {0.0588707849f, -0.998265624f}, {0.0523359738f, -0.99862951f}, {0.0457988009f, -0.99895066f},
+    {0.0392597876f, -0.999229014f}, {0.0327189714f, -0.999464571f}, {0.0261768755f, -0.999657333f},
+    {0.0196336564f, -0.999807239f}, {0.0130895972f, -0.999914348f}, {0.00654485729f, -0.999978602f},
+    {-4.37113883e-08f, -1.0f}, {-0.00654506404f, -0.999978602f}, {-0.0130896848f, -0.999914348f},
+    {-0.0196338631f, -0.999807239f}, {-0.026176963f, -0.999657333f}, {-0.03271918f, -0.999464571f},
+    {-0.0392598771f, -0.999229014f}, {-0.0457990095f, -0.99895066f}, {-0.0523359403f, -0.99862951f},
+    {-0.0588708706f, -0.998265624f}, {-0.0654031634f, -0.997858942f}, {-0.0719327629f, -0.997409463f},
+    {-0.0784590542f, -0.996917307f}, {-0.0849822164f, -0.996382475f}, {-0.0915016234f, -0.995804906f},
+    {-0.0980172232f, -0.99518472f}, {-0.104528628f, -0.994521856f}, {-0.111035317f, -0.993816435f},
+    {-0.117537491f, -0.993068457f}, {-0.124034509f, -0.99227792f}, {-0.130526334f, -0.991444826f},
+    {-0.137012318f, -0.990569353f}, {-0.143492684f, -0.989651382f}, {-0.149966776f, -0.988691032f},
+    {-0.156434566f, -0.987688303f}, {-0.162895426f, -0.986643314f}, {-0.169349536f, -0.985556066f},
+    {-0.17579627f, -0.984426558f}, {-0.182235599f, -0.98325491f}, {-0.188666895f, -0.982041121f},
+    {-0.195090324f, -0.980785251f}, {-0.201505408f, -0.979487419f}, {-0.207911745f, -0.978147566f},
+    {-0.214309275f, -0.976765871f}, {-0.220697418f, -0.975342333f}, {-0.227076322f, -0.973876953f},
+    {-0.233445391f, -0.972369909f}, {-0.239804566f, -0.970821202f}, {-0.246153235f, -0.96923095f},
+    {-0.252491713f, -0.967599034f}, {-0.258819044f, -0.965925813f}, {-0.265135497f, -0.964211166f},
+    {-0.271440357f, -0.962455273f}, {-0.277733952f, -0.960658014f}, {-0.284015298f, -0.958819747f},
+    {-0.290284723f, -0.956940293f}, {-0.296541691f, -0.955019891f}, {-0.302785844f, -0.9530586f},
+    {-0.309017152f, -0.95105648f}, {-0.315234989f, -0.94901365f}, {-0.321439564f, -0.94693011f},
+    {-0.327630252f, -0.944806039f}, {-0.333806992f, -0.942641437f}, {-0.339969218f, -0.940436542f},
+    {-0.346117109f, -0.938191295f}, {-0.352250069f, -0.935905933f}, {-0.358368069f, -0.933580399f},
+    {-0.364470452f, -0.931214929f}, {-0.370557487f, -0.928809524f}, {-0.376628518f, -0.926364362f},
+    {-0.382683516f, -0.923879504f}, {-0.388722122f, -0.921355069f}, {-0.39474386f, -0.918791234f},
+    {-0.400748909f, -0.916187942f}, {-0.406736702f, -0.91354543f}, {-0.41270715f, -0.910863757f},
+    {-0.418659836f, -0.908143103f}, {-0.424594671f, -0.905383527f}, {-0.430511117f, -0.902585268f},
+    {-0.436409324f, -0.899748266f}, {-0.442288637f, -0.896872759f}, {-0.448149234f, -0.893958747f},
+    {-0.4539904f, -0.891006589f}, {-0.459812313f, -0.888016105f}, {-0.465614557f, -0.884987593f},
+    {-0.471396834f, -0.881921232f}, {-0.477158934f, -0.878817022f}, {-0.482900381f, -0.875675321f},
+    {-0.488621354f, -0.872495949f}, {-0.494321197f, -0.869279325f}, {-0.50000006f, -0.866025388f},
+    {-0.505657315f, -0.862734437f}, {-0.511293292f, -0.859406292f}, {-0.516906977f, -0.85604161f},
+    {-0.522498667f, -0.852640092f}, {-0.528067827f, -0.849202156f}, {-0.533614576f, -0.845727801f},
+    {-0.539138258f, -0.842217267f}, {-0.544639051f, -0.838670552f}, {-0.550116479f, -0.835087955f},
+    {-0.555570364f, -0.831469536f}, {-0.561000466f, -0.827815473f}, {-0.56640631f, -0.824126124f},
+    {-0.571788073f, -0.820401371f}, {-0.577145219f, -0.816641569f}, {-0.582477748f, -0.812846601f},
+    {-0.587785184f, -0.809017003f}, {-0.593067646f, -0.805152655f}, {-0.598324656f, -0.801253736f},
+    {-0.603556097f, -0.797320545f}, {-0.60876143f, -0.793353319f}, {-0.613940954f, -0.789352f},
+    {-0.619093895f, -0.785316944f}, {-0.62422055f, -0.781248152f}, {-0.629320323f, -0.777146041f},
+    {-0.634393275f, -0.773010492f}, {-0.639439046f, -0.768841803f}, {-0.644457459f, -0.764640212f},
+    {-0.649448216f, -0.760405838f}, {-0.654411018f, -0.75613904f}, {-0.659345925f, -0.751839697f},
+    {-0.6642524f, -0.747508347f}, {-0.669130683f, -0.74314481f}, {-0.673980057f, -0.738749564f},
+    {-0.678800762f, -0.734322488f}, {-0.683592379f, -0.729864001f}, {-0.688354671f, -0.725374281f},
+    {-0.693087339f, -0.720853627f}, {-0.697790504f, -0.716301858f}, {-0.702463627f, -0.711719632f},
+    {-0.707106769f, -0.707106769f}, {-0.711719692f, -0.702463627f}, {-0.716302037f, -0.697790325f},
+    {-0.720853746f, -0.693087161f}, {-0.72537446f, -0.688354492f}, {-0.72986418f, -0.6835922f},
+    {-0.734322548f, -0.678800702f}, {-0.738749564f, -0.673980057f}, {-0.74314481f, -0.669130623f},
+    {-0.747508347f, -0.6642524f}, {-0.751839876f, -0.659345746f}, {-0.756139219f, -0.654410779f},
+    {-0.760406017f, -0.649448037f}, {-0.764640331f, -0.644457221f}, {-0.768841803f, -0.639439046f},
+    {-0.773010492f, -0.634393275f}, {-0.777146041f, -0.629320264f}, {-0.781248152f, -0.62422055f},
+    {-0.785316944f, -0.619093895f}, {-0.789352119f, -0.613940716f}, {-0.793353498f, -0.608761251f},
+    {-0.797320664f, -0.603555918f}, {-0.801253915f, -0.598324478f}, {-0.805152655f, -0.593067646f},
+    {-0.809017062f, -0.587785184f}, {-0.812846661f, -0.582477748f}, {-0.816641569f, -0.577145219f},
+    {-0.82040149f, -0.571787894f}, {-0.824126303f, -0.566406131f}, {-0.827815652f, -0.561000228f},
+    {-0.831469655f, -0.555570185f}, {-0.835088074f, -0.550116301f}, {-0.838670552f, -0.544639051f},
+    {-0.842217267f, -0.539138258f}, {-0.845727801f, -0.533614576f}, {-0.849202216f, -0.528067827f},
+    {-0.852640212f, -0.522498488f}, {-0.856041729f, -0.516906738f}, {-0.859406412f, -0.511293054f},
+    {-0.862734437f, -0.505657256f}, {-0.866025388f, -0.50000006f}, {-0.869279325f, -0.494321167f},
+    {-0.872495949f, -0.488621354f}, {-0.87567544f, -0.482900172f}, {-0.878817141f, -0.477158725f},
+    {-0.881921351f, -0.471396625f}, {-0.884987712f, -0.465614349f}, {-0.888016105f, -0.459812313f},
+    {-0.891006589f, -0.45399037f}, {-0.893958747f, -0.448149204f}, {-0.896872759f, -0.442288637f},
+    {-0.899748325f, -0.436409116f}, {-0.902585387f, -0.430510908f}, {-0.905383646f, -0.424594462f},
+    {-0.908143222f, -0.418659598f}, {-0.910863817f, -0.412707031f}, {-0.913545489f, -0.406736583f},
+    {-0.916187942f, -0.400748909f}, {-0.918791234f, -0.39474386f}, {-0.921355128f, -0.388721883f},
+    {-0.923879623f, -0.382683277f}, {-0.926364481f, -0.37662828f}, {-0.928809583f, -0.370557338f},
+    {-0.931214988f, -0.364470333f}, {-0.933580458f, -0.35836792f}, {-0.935905933f, -0.35224995f},
+    {-0.938191295f, -0.346117109f}, {-0.940436542f, -0.339969218f}, {-0.942641556f, -0.333806753f},
+    {-0.944806099f, -0.327630013f}, {-0.94693017f, -0.321439445f}, {-0.94901371f, -0.31523487f},
+    {-0.95105648f, -0.309017032f}, {-0.95305866f, -0.302785724f}, {-0.955019891f, -0.296541691f},
+    {-0.956940353f, -0.290284723f}, {-0.958819747f, -0.284015298f}, {-0.960658073f, -0.277733713f},
+    {-0.962455273f, -0.271440238f}, {-0.964211226f, -0.265135378f}, {-0.965925872f, -0.258818924f},
+    {-0.967599094f, -0.252491593f}, {-0.96923095f, -0.246153235f}, {-0.970821261f, -0.239804327f},
+    {-0.972369969f, -0.233445138f}, {-0.973877013f, -0.227076188f}, {-0.975342333f, -0.220697284f},
+    {-0.976765871f, -0.214309156f}, {-0.978147626f, -0.207911611f}, {-0.979487419f, -0.201505393f},
+    {-0.98078531f, -0.195090309f}, {-0.982041121f, -0.18866688f}, {-0.98325491f, -0.18223536f},
+    {-0.984426618f, -0.175796032f}, {-0.985556066f, -0.169349402f}, {-0.986643374f, -0.162895292f},
+    {-0.987688363f, -0.156434447f}, {-0.988691032f, -0.149966657f}, {-0.989651382f, -0.143492669f},
+    {-0.990569353f, -0.137012318f}, {-0.991444886f, -0.130526081f}, {-0.99227792f, -0.124034256f},
+    {-0.993068457f, -0.117537357f}, {-0.993816495f, -0.111035191f}, {-0.994521916f, -0.104528494f},
+    {-0.99518472f, -0.0980170965f}, {-0.995804965f, -0.0915014893f}, {-0.996382475f, -0.0849822015f},
+    {-0.996917367f, -0.0784590393f}, {-0.997409523f, -0.071932517f}, {-0.997858942f, -0.0654029101f},
+    {-0.998265624f, -0.0588707402f}, {-0.99862957f, -0.0523358099f}, {-0.99895066f, -0.0457988791f},
+    {-0.999229014f, -0.0392597429f}, {-0.999464571f, -0.0327191688f}, {-0.999657333f, -0.0261769518f},
+    {-0.999807239f, -0.0196336135f}, {-0.999914348f, -0.0130894342f}, {-0.999978602f, -0.00654493272f},
+    {-1.0f, 8.74227766e-08f}, {-0.999978602f, 0.00654486893f}, {-0.999914348f, 0.0130898468f},
+    {-0.999807239f, 0.0196337886f}, {-0.999657333f, 0.0261771251f}, {-0.999464571f, 0.0327191055f},
+    {-0.999229014f, 0.0392601565f}, {-0.99895066f, 0.0457990505f}, {-0.99862951f, 0.052335985f},
+    {-0.998265624f, 0.0588706769f}, {-0.997858882f, 0.0654033199f}, {-0.997409463f, 0.0719326884f},
+    {-0.996917307f, 0.0784592181f}, {-0.996382475f, 0.0849821419f}, {-0.995804906f, 0.0915018991f},
+    {-0.99518472f, 0.0980172679f}, {-0.994521916f, 0.104528435f}, {-0.993816435f, 0.1110356f},
+    {-0.993068457f, 0.117537536f}, {-0.99227792f, 0.124034435f}, {-0.991444826f, 0.13052626f},
+    {-0.990569293f, 0.137012482f}, {-0.989651382f, 0.143492848f}, {-0.988691032f, 0.149966821f},
+    {-0.987688363f, 0.156434372f}, {-0.986643314f, 0.162895709f}, {-0.985556066f, 0.169349581f},
+    {-0.984426558f, 0.175796196f}, {-0.98325491f, 0.182235524f}, {-0.982041121f, 0.188667044f},
+    {-0.980785251f, 0.195090488f}, {-0.979487419f, 0.201505333f}, {-0.978147507f, 0.207912013f},
+    {-0.976765871f, 0.21430932f}, {-0.975342333f, 0.220697448f}, {-0.973877013f, 0.227076128f},
+    {-0.97236985f, 0.23344554f}, {-0.970821202f, 0.239804491f}, {-0.96923089f, 0.246153399f},
+    {-0.967599094f, 0.252491534f}, {-0.965925753f, 0.258819312f}, {-0.964211166f, 0.265135527f},
+    {-0.962455273f, 0.271440417f}, {-0.960658133f, 0.277733654f}, {-0.958819687f, 0.284015477f},
+    {-0.956940293f, 0.290284872f}, {-0.955019951f, 0.296541631f}, {-0.953058541f, 0.302786112f},
+    {-0.951056421f, 0.309017211f}, {-0.94901365f, 0.315235049f}, {-0.94693017f, 0.321439385f},
+    {-0.94480598f, 0.327630401f}, {-0.942641497f, 0.333806932f}, {-0.940436482f, 0.339969367f},
+    {-0.938191354f, 0.346117049f}, {-0.935905814f, 0.352250338f}, {-0.933580399f, 0.358368099f},
+    {-0.931214929f, 0.364470512f}, {-0.928809583f, 0.370557308f}, {-0.926364303f, 0.376628667f},
+    {-0.923879504f, 0.382683426f}, {-0.921355069f, 0.388722062f}, {-0.918791115f, 0.394744009f},
+    {-0.916187882f, 0.400749058f}, {-0.91354543f, 0.406736732f}, {-0.910863876f, 0.412706971f},
+    {-0.908143044f, 0.418659985f}, {-0.905383587f, 0.424594611f}, {-0.902585328f, 0.430511057f},
+    {-0.899748266f, 0.436409265f}, {-0.896872699f, 0.442288786f}, {-0.893958688f, 0.448149383f},
+    {-0.891006529f, 0.453990549f}, {-0.888016164f, 0.459812254f}, {-0.884987533f, 0.465614706f},
+    {-0.881921232f, 0.471396774f}, {-0.878817141f, 0.477158666f}, {-0.875675201f, 0.48290053f},
+    {-0.87249589f, 0.488621503f}, {-0.869279265f, 0.494321316f}, {-0.866025388f, 0.49999997f},
+    {-0.862734258f, 0.505657613f}, {-0.859406352f, 0.511293232f}, {-0.85604161f, 0.516906857f},
+    {-0.852640271f, 0.522498429f}, {-0.849202096f, 0.528068006f}, {-0.845727682f, 0.533614695f},
+    {-0.842217207f, 0.539138377f}, {-0.838670611f, 0.544638991f}, {-0.835087836f, 0.550116599f},
+    {-0.831469536f, 0.555570304f}, {-0.827815652f, 0.561000168f}, {-0.824126065f, 0.566406429f},
+    {-0.820401371f, 0.571788013f}, {-0.81664145f, 0.577145338f}, {-0.812846661f, 0.582477689f},
+    {-0.809016764f, 0.587785542f}, {-0.805152535f, 0.593067765f}, {-0.801253796f, 0.598324597f},
+    {-0.797320724f, 0.603555858f}, {-0.7933532f, 0.608761609f}, {-0.789352f, 0.613940895f},
+    {-0.785316885f, 0.619094074f}, {-0.781248212f, 0.62422049f}, {-0.777145803f, 0.629320621f},
+    {-0.773010373f, 0.634393394f}, {-0.768841863f, 0.639438987f}, {-0.764640093f, 0.644457579f},
+    {-0.760405898f, 0.649448156f}, {-0.7561391f, 0.654410958f}, {-0.751839757f, 0.659345865f},
+    {-0.747508228f, 0.66425252f}, {-0.743144691f, 0.669130802f}, {-0.738749444f, 0.673980176f},
+    {-0.734322548f, 0.678800702f}, {-0.729863942f, 0.683592498f}, {-0.725374341f, 0.688354611f},
+    {-0.720853627f, 0.69308728f}, {-0.716301918f, 0.697790444f}, {-0.711719394f, 0.702463925f},
+    {-0.70710665f, 0.707106888f}, {-0.702463627f, 0.711719632f}, {-0.697790205f, 0.716302156f},
+    {-0.69308722f, 0.720853746f}, {-0.688354552f, 0.725374401f}, {-0.6835922f, 0.72986412f},
+    {-0.678800583f, 0.734322608f}, {-0.673979938f, 0.738749683f}, {-0.669130504f, 0.74314487f},
+    {-0.66425246f, 0.747508287f}, {-0.659345627f, 0.751839995f}, {-0.654410839f, 0.756139159f},
+    {-0.649447918f, 0.760406077f}, {-0.644457459f, 0.764640152f}, {-0.639438748f, 0.768842041f},
+    {-0.634393334f, 0.773010433f}, {-0.629320323f, 0.777145982f}, {-0.624220431f, 0.781248271f},
+    {-0.619093776f, 0.785317063f}, {-0.613940597f, 0.789352238f}, {-0.608761489f, 0.79335326f},
+    {-0.60355556f, 0.797320962f}, {-0.598324537f, 0.801253855f}, {-0.593067527f, 0.805152714f},
+    {-0.587785423f, 0.809016824f}, {-0.58247745f, 0.812846839f}, {-0.577145278f, 0.81664151f},
+    {-0.571787953f, 0.82040143f}, {-0.56640619f, 0.824126244f}, {-0.561000109f, 0.827815711f},
+    {-0.555570006f, 0.831469774f}, {-0.550116539f, 0.835087895f}, {-0.544638693f, 0.83867079f},
+    {-0.539138317f, 0.842217267f}, {-0.533614457f, 0.845727861f}, {-0.528067708f, 0.849202275f},
+    {-0.52249831f, 0.852640331f}, {-0.516906619f, 0.856041789f}, {-0.511293113f, 0.859406412f},
+    {-0.505657315f, 0.862734377f}, {-0.499999911f, 0.866025448f}, {-0.494321048f, 0.869279444f},
+    {-0.488621414f, 0.87249589f}, {-0.482900441f, 0.875675261f}, {-0.477158368f, 0.87881732f},
+    {-0.471396685f, 0.881921291f}, {-0.465614408f, 0.884987712f}, {-0.459812164f, 0.888016224f},
+    {-0.453990221f, 0.891006649f}, {-0.448149294f, 0.893958747f}, {-0.442288697f, 0.896872759f},
+    {-0.436409175f, 0.899748325f}, {-0.430510968f, 0.902585328f}, {-0.424594313f, 0.905383706f},
+    {-0.418659896f, 0.908143103f}, {-0.412706673f, 0.910863996f}, {-0.406736642f, 0.91354543f},
+    {-0.40074876f, 0.916188002f}, {-0.394743711f, 0.918791294f}, {-0.388721734f, 0.921355188f},
+    {-0.382683128f, 0.923879683f}, {-0.376628578f, 0.926364362f}, {-0.37055698f, 0.928809762f},
+    {-0.364470422f, 0.931214988f}, {-0.358367771f, 0.933580518f}, {-0.352250248f, 0.935905874f},
+    {-0.346116722f, 0.938191473f}, {-0.339969277f, 0.940436542f}, {-0.333806843f, 0.942641497f},
+    {-0.327630073f, 0.944806099f}, {-0.321439266f, 0.94693017f}, {-0.315234721f, 0.94901371f},
+    {-0.309017092f, 0.95105648f}, {-0.302785814f, 0.95305866f}, {-0.296541542f, 0.955019951f},
+    {-0.290284544f, 0.956940353f}, {-0.284015149f, 0.958819807f}, {-0.277733564f, 0.960658133f},
+    {-0.271440089f, 0.962455332f}, {-0.265135437f, 0.964211166f}, {-0.258818984f, 0.965925872f},
+    {-0.252491444f, 0.967599154f}, {-0.246153072f, 0.96923095f}, {-0.239804164f, 0.970821261f},
+    {-0.233445451f, 0.972369909f}, {-0.2270758f, 0.973877072f}, {-0.220697358f, 0.975342333f},
+    {-0.214308992f, 0.976765931f}, {-0.207911924f, 0.978147566f}, {-0.201505005f, 0.979487479f},
+    {-0.195090383f, 0.980785251f}, {-0.188666955f, 0.982041121f}, {-0.182235435f, 0.98325491f},
+    {-0.175796106f, 0.984426618f}, {-0.169349253f, 0.985556126f}, {-0.162895605f, 0.986643314f},
+    {-0.156434044f, 0.987688422f}, {-0.149966732f, 0.988691032f}, {-0.143492505f, 0.989651382f},
+    {-0.137012154f, 0.990569353f}, {-0.130525917f, 0.991444886f}, {-0.124034099f, 0.99227798f},
+    {-0.117537431f, 0.993068457f}, {-0.111035265f, 0.993816495f}, {-0.104528338f, 0.994521916f},
+    {-0.0980169326f, 0.99518472f}, {-0.0915018022f, 0.995804906f}, {-0.0849818066f, 0.996382475f},
+    {-0.0784591138f, 0.996917307f}, {-0.0719325915f, 0.997409523f}, {-0.0654029846f, 0.997858942f},
+    {-0.0588705763f, 0.998265624f}, {-0.0523356497f, 0.99862957f}, {-0.0457989536f, 0.99895066f},
+    {-0.0392598212f, 0.999229014f}, {-0.0327190049f, 0.999464571f}, {-0.0261767879f, 0.999657333f},
+    {-0.0196334496f, 0.999807239f}, {-0.0130897481f, 0.999914348f}, {-0.00654453132f, 0.999978602f},
+    {1.19248806e-08f, 1.0f}, {0.00654503191f, 0.999978602f}, {0.0130897714f, 0.999914348f},
+    {0.0196339507f, 0.999807239f}, {0.026177289f, 0.999657333f}, {0.0327190273f, 0.999464571f},
+    {0.0392603204f, 0.999229014f}, {0.045798976f, 0.99895066f}, {0.0523361489f, 0.99862951f},
+    {0.0588706024f, 0.998265624f}, {0.0654034838f, 0.997858882f}, {0.0719326138f, 0.997409523f},
+    {0.0784591362f, 0.996917307f}, {0.0849823058f, 0.996382475f}, {0.0915018246f, 0.995804906f},
+    {0.0980174318f, 0.99518472f}, {0.10452836f, 0.994521916f}, {0.111035757f, 0.993816435f},
+    {0.117537454f, 0.993068457f}, {0.124034591f, 0.99227792f}, {0.130526409f, 0.991444826f},
+    {0.137012646f, 0.990569293f}, {0.143493012f, 0.989651322f}, {0.149966747f, 0.988691032f},
+    {0.156434536f, 0.987688303f}, {0.162895635f, 0.986643314f}, {0.169349745f, 0.985556006f},
+    {0.175796121f, 0.984426618f}, {0.18223545f, 0.98325491f}, {0.18866697f, 0.982041121f},
+    {0.195090413f, 0.980785251f}, {0.201505497f, 0.97948736f}, {0.207911938f, 0.978147566f},
+    {0.214309484f, 0.976765811f}, {0.220697388f, 0.975342333f}, {0.227076292f, 0.973876953f},
+    {0.233445466f, 0.972369909f}, {0.239804655f, 0.970821142f}, {0.246153563f, 0.969230831f},
+    {0.252491474f, 0.967599094f}, {0.258819461f, 0.965925694f}, {0.265135467f, 0.964211166f},
+    {0.271440566f, 0.962455213f}, {0.277733594f, 0.960658133f}, {0.284015626f, 0.958819628f},
+    {0.290285021f, 0.956940234f}, {0.296541542f, 0.955019951f}, {0.302786291f, 0.953058481f},
+    {0.309017122f, 0.95105648f}, {0.315235198f, 0.949013591f}, {0.321439296f, 0.94693017f},
+    {0.32763055f, 0.94480592f}, {0.333806843f, 0.942641497f}, {0.339969307f, 0.940436542f},
+    {0.346117198f, 0.938191295f}, {0.352250278f, 0.935905814f}, {0.358368248f, 0.933580339f},
+    {0.364470422f, 0.931214988f}, {0.370557457f, 0.928809524f}, {0.376628578f, 0.926364362f},
+    {0.382683605f, 0.923879445f}, {0.388722211f, 0.921355009f}, {0.394744158f, 0.918791056f},
+    {0.400749207f, 0.916187763f}, {0.406736672f, 0.91354543f}, {0.41270712f, 0.910863757f},
+    {0.418659896f, 0.908143103f}, {0.42459476f, 0.905383527f}, {0.430510998f, 0.902585328f},
+    {0.436409205f, 0.899748325f}, {0.442288727f, 0.896872699f}, {0.448149294f, 0.893958747f},
+    {0.453990668f, 0.89100641f}, {0.459812194f, 0.888016164f}, {0.465614855f, 0.884987473f},
+    {0.471396714f, 0.881921291f}, {0.477158815f, 0.878817081f}, {0.48290047f, 0.875675261f},
+    {0.488621444f, 0.87249589f}, {0.494321465f, 0.869279146f}, {0.499999911f, 0.866025448f},
+    {0.505657792f, 0.862734139f}, {0.511293173f, 0.859406352f}, {0.516907036f, 0.856041551f},
+    {0.522498369f, 0.852640271f}, {0.528068125f, 0.849202037f}, {0.533614874f, 0.845727623f},
+    {0.539138317f, 0.842217207f}, {0.544639111f, 0.838670492f}, {0.550116539f, 0.835087895f},
+    {0.555570424f, 0.831469476f}, {0.561000109f, 0.827815711f}, {0.566406608f, 0.824125946f},
+    {0.571787953f, 0.82040143f}, {0.577145278f, 0.81664151f}, {0.582477868f, 0.812846601f},
+    {0.587785482f, 0.809016824f}, {0.593067884f, 0.805152416f}, {0.598324537f, 0.801253855f},
+    {0.603555977f, 0.797320604f}, {0.608761549f, 0.79335326f}, {0.613941014f, 0.78935194f},
+    {0.619094193f, 0.785316765f}, {0.624220431f, 0.781248271f}, {0.629320741f, 0.777145684f},
+    {0.634393334f, 0.773010433f}, {0.639439106f, 0.768841743f}, {0.644457519f, 0.764640152f},
+    {0.649448276f, 0.760405779f}, {0.654410899f, 0.756139159f}, {0.659345806f, 0.751839817f},
+    {0.66425252f, 0.747508287f}, {0.669130743f, 0.743144751f}, {0.673980296f, 0.738749325f},
+    {0.678800642f, 0.734322608f}, {0.683592618f, 0.729863822f}, {0.688354552f, 0.725374341f},
+    {0.693087399f, 0.720853567f}, {0.697790563f, 0.716301799f}, {0.702463865f, 0.711719453f},
+    {0.707107008f, 0.707106531f}, {0.711719573f, 0.702463686f}, {0.716302276f, 0.697790086f},
+    {0.720853686f, 0.69308728f}, {0.72537452f, 0.688354433f}, {0.72986424f, 0.683592081f},
+    {0.734322727f, 0.678800464f}, {0.738749802f, 0.673979819f}, {0.74314487f, 0.669130564f},
+    {0.747508407f, 0.664252341f}, {0.751839936f, 0.659345686f}, {0.756139278f, 0.65441072f},
+    {0.760405898f, 0.649448156f}, {0.764640272f, 0.64445734f}, {0.768841863f, 0.639438987f},
+    {0.773010552f, 0.634393156f}, {0.777146101f, 0.629320204f}, {0.781248391f, 0.624220312f},
+    {0.785317183f, 0.619093657f}, {0.789352059f, 0.613940835f}, {0.793353379f, 0.60876137f},
+    {0.797320724f, 0.603555799f}, {0.801253974f, 0.598324418f}, {0.805152833f, 0.593067348f},
+    {0.809016943f, 0.587785304f}, {0.812846959f, 0.582477331f}, {0.816641629f, 0.5771451f},
+    {0.820401549f, 0.571787834f}, {0.824126065f, 0.566406429f}, {0.827815831f, 0.56099999f},
+    {0.831469595f, 0.555570304f}, {0.835088015f, 0.55011642f}, {0.838670611f, 0.544638932f},
+    {0.842217326f, 0.539138198f}, {0.84572798f, 0.533614278f}, {0.849202096f, 0.528067946f},
+    {0.85264039f, 0.52249819f}, {0.85604161f, 0.516906857f}, {0.859406471f, 0.511292994f},
+    {0.862734497f, 0.505657196f}, {0.866025567f, 0.499999762f}, {0.869279504f, 0.494320899f},
+    {0.872496009f, 0.488621265f}, {0.875675321f, 0.482900292f}, {0.878817201f, 0.477158636f},
+    {0.881921351f, 0.471396536f}, {0.884987772f, 0.465614259f}, {0.888016284f, 0.459812015f},
+    {0.891006708f, 0.453990102f}, {0.893958807f, 0.448149145f}, {0.896872818f, 0.442288548f},
+    {0.899748385f, 0.436409026f}, {0.902585447f, 0.430510819f}, {0.905383587f, 0.424594581f},
+    {0.908143163f, 0.418659747f}, {0.910863876f, 0.412706941f}, {0.913545549f, 0.406736493f},
+    {0.916188061f, 0.40074861f}, {0.918791175f, 0.394743979f}, {0.921355247f, 0.388721585f},
+    {0.923879564f, 0.382683426f}, {0.926364422f, 0.376628399f}, {0.928809643f, 0.370557278f},
+    {0.931215048f, 0.364470243f}, {0.933580577f, 0.358367622f}, {0.935905933f, 0.352250099f},
+    {0.938191533f, 0.346116573f}, {0.940436602f, 0.339969128f}, {0.942641556f, 0.333806664f},
+    {0.94480598f, 0.327630371f}, {0.94693023f, 0.321439117f}, {0.94901365f, 0.315235019f},
+    {0.95105654f, 0.309016943f}, {0.95305866f, 0.302785635f}, {0.95502001f, 0.296541363f},
+    {0.956940413f, 0.290284395f}, {0.958819687f, 0.284015447f}, {0.960658193f, 0.277733415f},
+    {0.962455273f, 0.271440387f}, {0.964211226f, 0.265135288f}, {0.965925872f, 0.258818835f},
+    {0.967599154f, 0.252491266f}, {0.969231009f, 0.246152908f}, {0.970821202f, 0.239804462f},
+    {0.972369909f, 0.233445287f}, {0.973877013f, 0.227076113f}, {0.975342393f, 0.220697194f},
+    {0.976765931f, 0.214308843f}, {0.978147566f, 0.20791176f}, {0.979487538f, 0.201504841f},
+    {0.98078531f, 0.195090234f}, {0.98204118f, 0.188666791f}, {0.983254969f, 0.182235271f},
+    {0.984426618f, 0.175795943f}, {0.985556066f, 0.169349551f}, {0.986643314f, 0.162895441f},
+    {0.987688363f, 0.156434357f}, {0.988691092f, 0.149966568f}, {0.989651442f, 0.143492356f},
+    {0.990569353f, 0.137012467f}, {0.991444945f, 0.130525753f}, {0.99227792f, 0.124034405f},
+    {0.993068457f, 0.117537275f}, {0.993816495f, 0.111035101f}, {0.994521916f, 0.104528174f},
+    {0.995184779f, 0.0980167687f}, {0.995804906f, 0.0915016383f}, {0.996382535f, 0.0849816427f},
+    {0.996917367f, 0.0784589499f}, {0.997409523f, 0.0719324276f}, {0.997858942f, 0.0654032975f},
+    {0.998265624f, 0.0588704161f}, {0.99862951f, 0.0523359627f}, {0.99895066f, 0.0457987897f},
+    {0.999229014f, 0.0392596573f}, {0.999464571f, 0.032718841f}, {0.999657333f, 0.0261766259f},
+    {0.999807239f, 0.0196337644f}, {0.999914348f, 0.0130895851f}, {0.999978602f, 0.00654484518f},
+};
+
+static const opus_int32 fft_bitrev960[960] = {
+    0, 192, 384, 576, 768, 64, 256, 448, 640, 832, 128, 320,
+    512, 704, 896, 16, 208, 400, 592, 784, 80, 272, 464, 656,
+    848, 144, 336, 528, 720, 912, 32, 224, 416, 608, 800, 96,
+    288, 480, 672, 864, 160, 352, 544, 736, 928, 48, 240, 432,
+    624, 816, 112, 304, 496, 688, 880, 176, 368, 560, 752, 944,
+    4, 196, 388, 580, 772, 68, 260, 452, 644, 836, 132, 324,
+    516, 708, 900, 20, 212, 404, 596, 788, 84, 276, 468, 660,
+    852, 148, 340, 532, 724, 916, 36, 228, 420, 612, 804, 100,
+    292, 484, 676, 868, 164, 356, 548, 740, 932, 52, 244, 436,
+    628, 820, 116, 308, 500, 692, 884, 180, 372, 564, 756, 948,
+    8, 200, 392, 584, 776, 72, 264, 456, 648, 840, 136, 328,
+    520, 712, 904, 24, 216, 408, 600, 792, 88, 280, 472, 664,
+    856, 152, 344, 536, 728, 920, 40, 232, 424, 616, 808, 104,
+    296, 488, 680, 872, 168, 360, 552, 744, 936, 56, 248, 440,
+    632, 824, 120, 312, 504, 696, 888, 184, 376, 568, 760, 952,
+    12, 204, 396, 588, 780, 76, 268, 460, 652, 844, 140, 332,
+    524, 716, 908, 28, 220, 412, 604, 796, 92, 284, 476, 668,
+    860, 156, 348, 540, 732, 924, 44, 236, 428, 620, 812, 108,
+    300, 492, 684, 876, 172, 364, 556, 748, 940, 60, 252, 444,
+    636, 828, 124, 316, 508, 700, 892, 188, 380, 572, 764, 956,
+    1, 193, 385, 577, 769, 65, 257, 449, 641, 833, 129, 321,
+    513, 705, 897, 17, 209, 401, 593, 785, 81, 273, 465, 657,
+    849, 145, 337, 529, 721, 913, 33, 225, 417, 609, 801, 97,
+    289, 481, 673, 865, 161, 353, 545, 737, 929, 49, 241, 433,
+    625, 817, 113, 305, 497, 689, 881, 177, 369, 561, 753, 945,
+    5, 197, 389, 581, 773, 69, 261, 453, 645, 837, 133, 325,
+    517, 709, 901, 21, 213, 405, 597, 789, 85, 277, 469, 661,
+    853, 149, 341, 533, 725, 917, 37, 229, 421, 613, 805, 101,
+    293, 485, 677, 869, 165, 357, 549, 741, 933, 53, 245, 437,
+    629, 821, 117, 309, 501, 693, 885, 181, 373, 565, 757, 949,
+    9, 201, 393, 585, 777, 73, 265, 457, 649, 841, 137, 329,
+    521, 713, 905, 25, 217, 409, 601, 793, 89, 281, 473, 665,
+    857, 153, 345, 537, 729, 921, 41, 233, 425, 617, 809, 105,
+    297, 489, 681, 873, 169, 361, 553, 745, 937, 57, 249, 441,
+    633, 825, 121, 313, 505, 697, 889, 185, 377, 569, 761, 953,
+    13, 205, 397, 589, 781, 77, 269, 461, 653, 845, 141, 333,
+    525, 717, 909, 29, 221, 413, 605, 797, 93, 285, 477, 669,
+    861, 157, 349, 541, 733, 925, 45, 237, 429, 621, 813, 109,
+    301, 493, 685, 877, 173, 365, 557, 749, 941, 61, 253, 445,
+    637, 829, 125, 317, 509, 701, 893, 189, 381, 573, 765, 957,
+    2, 194, 386, 578, 770, 66, 258, 450, 642, 834, 130, 322,
+    514, 706, 898, 18, 210, 402, 594, 786, 82, 274, 466, 658,
+    850, 146, 338, 530, 722, 914, 34, 226, 418, 610, 802, 98,
+    290, 482, 674, 866, 162, 354, 546, 738, 930, 50, 242, 434,
+    626, 818, 114, 306, 498, 690, 882, 178, 370, 562, 754, 946,
+    6, 198, 390, 582, 774, 70, 262, 454, 646, 838, 134, 326,
+    518, 710, 902, 22, 214, 406, 598, 790, 86, 278, 470, 662,
+    854, 150, 342, 534, 726, 918, 38, 230, 422, 614, 806, 102,
+    294, 486, 678, 870, 166, 358, 550, 742, 934, 54, 246, 438,
+    630, 822, 118, 310, 502, 694, 886, 182, 374, 566, 758, 950,
+    10, 202, 394, 586, 778, 74, 266, 458, 650, 842, 138, 330,
+    522, 714, 906, 26, 218, 410, 602, 794, 90, 282, 474, 666,
+    858, 154, 346, 538, 730, 922, 42, 234, 426, 618, 810, 106,
+    298, 490, 682, 874, 170, 362, 554, 746, 938, 58, 250, 442,
+    634, 826, 122, 314, 506, 698, 890, 186, 378, 570, 762, 954,
+    14, 206, 398, 590, 782, 78, 270, 462, 654, 846, 142, 334,
+    526, 718, 910, 30, 222, 414, 606, 798, 94, 286, 478, 670,
+    862, 158, 350, 542, 734, 926, 46, 238, 430, 622, 814, 110,
+    302, 494, 686, 878, 174, 366, 558, 750, 942, 62, 254, 446,
+    638, 830, 126, 318, 510, 702, 894, 190, 382, 574, 766, 958,
+    3, 195, 387, 579, 771, 67, 259, 451, 643, 835, 131, 323,
+    515, 707, 899, 19, 211, 403, 595, 787, 83, 275, 467, 659,
+    851, 147, 339, 531, 723, 915, 35, 227, 419, 611, 803, 99,
+    291, 483, 675, 867, 163, 355, 547, 739, 931, 51, 243, 435,
+    627, 819, 115, 307, 499, 691, 883, 179, 371, 563, 755, 947,
+    7, 199, 391, 583, 775, 71, 263, 455, 647, 839, 135, 327,
+    519, 711, 903, 23, 215, 407, 599, 791, 87, 279, 471, 663,
+    855, 151, 343, 535, 727, 919, 39, 231, 423, 615, 807, 103,
+    295, 487, 679, 871, 167, 359, 551, 743, 935, 55, 247, 439,
+    631, 823, 119, 311, 503, 695, 887, 183, 375, 567, 759, 951,
+    11, 203, 395, 587, 779, 75, 267, 459, 651, 843, 139, 331,
+    523, 715, 907, 27, 219, 411, 603, 795, 91, 283, 475, 667,
+    859, 155, 347, 539, 731, 923, 43, 235, 427, 619, 811, 107,
+    299, 491, 683, 875, 171, 363, 555, 747, 939, 59, 251, 443,
+    635, 827, 123, 315, 507, 699, 891, 187, 379, 571, 763, 955,
+    15, 207, 399, 591, 783, 79, 271, 463, 655, 847, 143, 335,
+    527, 719, 911, 31, 223, 415, 607, 799, 95, 287, 479, 671,
+    863, 159, 351, 543, 735, 927, 47, 239, 431, 623, 815, 111,
+    303, 495, 687, 879, 175, 367, 559, 751, 943, 63, 255, 447,
+    639, 831, 127, 319, 511, 703, 895, 191, 383, 575, 767, 959,
+};
+
+static const opus_int32 fft_bitrev480[480] = {
+    0, 96, 192, 288, 384, 32, 128, 224, 320, 416, 64, 160,
+    256, 352, 448, 8, 104, 200, 296, 392, 40, 136, 232, 328,
+    424, 72, 168, 264, 360, 456, 16, 112, 208, 304, 400, 48,
+    144, 240, 336, 432, 80, 176, 272, 368, 464, 24, 120, 216,
+    312, 408, 56, 152, 248, 344, 440, 88, 184, 280, 376, 472,
+    4, 100, 196, 292, 388, 36, 132, 228, 324, 420, 68, 164,
+    260, 356, 452, 12, 108, 204, 300, 396, 44, 140, 236, 332,
+    428, 76, 172, 268, 364, 460, 20, 116, 212, 308, 404, 52,
+    148, 244, 340, 436, 84, 180, 276, 372, 468, 28, 124, 220,
+    316, 412, 60, 156, 252, 348, 444, 92, 188, 284, 380, 476,
+    1, 97, 193, 289, 385, 33, 129, 225, 321, 417, 65, 161,
+    257, 353, 449, 9, 105, 201, 297, 393, 41, 137, 233, 329,
+    425, 73, 169, 265, 361, 457, 17, 113, 209, 305, 401, 49,
+    145, 241, 337, 433, 81, 177, 273, 369, 465, 25, 121, 217,
+    313, 409, 57, 153, 249, 345, 441, 89, 185, 281, 377, 473,
+    5, 101, 197, 293, 389, 37, 133, 229, 325, 421, 69, 165,
+    261, 357, 453, 13, 109, 205, 301, 397, 45, 141, 237, 333,
+    429, 77, 173, 269, 365, 461, 21, 117, 213, 309, 405, 53,
+    149, 245, 341, 437, 85, 181, 277, 373, 469, 29, 125, 221,
+    317, 413, 61, 157, 253, 349, 445, 93, 189, 285, 381, 477,
+    2, 98, 194, 290, 386, 34, 130, 226, 322, 418, 66, 162,
+    258, 354, 450, 10, 106, 202, 298, 394, 42, 138, 234, 330,
+    426, 74, 170, 266, 362, 458, 18, 114, 210, 306, 402, 50,
+    146, 242, 338, 434, 82, 178, 274, 370, 466, 26, 122, 218,
+    314, 410, 58, 154, 250, 346, 442, 90, 186, 282, 378, 474,
+    6, 102, 198, 294, 390, 38, 134, 230, 326, 422, 70, 166,
+    262, 358, 454, 14, 110, 206, 302, 398, 46, 142, 238, 334,
+    430, 78, 174, 270, 366, 462, 22, 118, 214, 310, 406, 54,
+    150, 246, 342, 438, 86, 182, 278, 374, 470, 30, 126, 222,
+    318, 414, 62, 158, 254, 350, 446, 94, 190, 286, 382, 478,
+    3, 99, 195, 291, 387, 35, 131, 227, 323, 419, 67, 163,
+    259, 355, 451, 11, 107, 203, 299, 395, 43, 139, 235, 331,
+    427, 75, 171, 267, 363, 459, 19, 115, 211, 307, 403, 51,
+    147, 243, 339, 435, 83, 179, 275, 371, 467, 27, 123, 219,
+    315, 411, 59, 155, 251, 347, 443, 91, 187, 283, 379, 475,
+    7, 103, 199, 295, 391, 39, 135, 231, 327, 423, 71, 167,
+    263, 359, 455, 15, 111, 207, 303, 399, 47, 143, 239, 335,
+    431, 79, 175, 271, 367, 463, 23, 119, 215, 311, 407, 55,
+    151, 247, 343, 439, 87, 183, 279, 375, 471, 31, 127, 223,
+    319, 415, 63, 159, 255, 351, 447, 95, 191, 287, 383, 479,
+};
+
+static const float fft_split960[3824] = {
+    1.0f, 1.0f, 0.999978602f, 0.999978602f, 0.999914348f, 0.999914348f,
+    0.999807239f, 0.999807239f, 0.999657333f, 0.999657333f, 0.999464571f, 0.999464571f,
+    0.999229014f, 0.999229014f, 0.99895066f, 0.99895066f, 0.99862951f, 0.99862951f,
+    0.998265624f, 0.998265624f, 0.997858942f, 0.997858942f, 0.997409463f, 0.997409463f,
+    0.996917307f, 0.996917307f, 0.996382475f, 0.996382475f, 0.995804906f, 0.995804906f,
+    0.99518472f, 0.99518472f, 0.994521916f, 0.994521916f, 0.993816435f, 0.993816435f,
+    0.993068457f, 0.993068457f, 0.99227792f, 0.99227792f, 0.991444886f, 0.991444886f,
+    0.990569353f, 0.990569353f, 0.989651382f, 0.989651382f, 0.988691032f, 0.988691032f,
+    0.987688363f, 0.987688363f, 0.986643314f, 0.986643314f, 0.985556066f, 0.985556066f,
+    0.984426558f, 0.984426558f, 0.98325491f, 0.98325491f, 0.982041121f, 0.982041121f,
+    0.980785251f, 0.980785251f, 0.979487419f, 0.979487419f, 0.978147626f, 0.978147626f,
+    0.976765871f, 0.976765871f, 0.975342333f, 0.975342333f, 0.973876953f, 0.973876953f,
+    0.972369909f, 0.972369909f, 0.970821202f, 0.970821202f, 0.96923089f, 0.96923089f,
+    0.967599094f, 0.967599094f, 0.965925813f, 0.965925813f, 0.964211166f, 0.964211166f,
+    0.962455213f, 0.962455213f, 0.960658073f, 0.960658073f, 0.958819747f, 0.958819747f,
+    0.956940353f, 0.956940353f, 0.955019951f, 0.955019951f, 0.95305866f, 0.95305866f,
+    0.95105654f, 0.95105654f, 0.94901365f, 0.94901365f, 0.94693011f, 0.94693011f,
+    0.944806039f, 0.944806039f, 0.942641497f, 0.942641497f, 0.940436542f, 0.940436542f,
+    0.938191354f, 0.938191354f, 0.935905933f, 0.935905933f, 0.933580399f, 0.933580399f,
+    0.931214929f, 0.931214929f, 0.928809583f, 0.928809583f, 0.926364362f, 0.926364362f,
+    0.923879504f, 0.923879504f, 0.921355128f, 0.921355128f, 0.918791234f, 0.918791234f,
+    0.916187942f, 0.916187942f, 0.91354543f, 0.91354543f, 0.910863817f, 0.910863817f,
+    0.908143163f, 0.908143163f, 0.905383587f, 0.905383587f, 0.902585268f, 0.902585268f,
+    0.899748266f, 0.899748266f, 0.896872759f, 0.896872759f, 0.893958807f, 0.893958807f,
+    0.891006529f, 0.891006529f, 0.888016105f, 0.888016105f, 0.884987652f, 0.884987652f,
+    0.881921232f, 0.881921232f, 0.878817081f, 0.878817081f, 0.875675321f, 0.875675321f,
+    0.872496009f, 0.872496009f, 0.869279325f, 0.869279325f, 0.866025388f, 0.866025388f,
+    0.862734377f, 0.862734377f, 0.859406412f, 0.859406412f, 0.85604161f, 0.85604161f,
+    0.852640152f, 0.852640152f, 0.849202156f, 0.849202156f, 0.845727861f, 0.845727861f,
+    0.842217207f, 0.842217207f, 0.838670552f, 0.838670552f, 0.835087955f, 0.835087955f,
+    0.831469595f, 0.831469595f, 0.827815592f, 0.827815592f, 0.824126184f, 0.824126184f,
+    0.82040143f, 0.82040143f, 0.81664151f, 0.81664151f, 0.812846661f, 0.812846661f,
+    0.809017003f, 0.809017003f, 0.805152655f, 0.805152655f, 0.801253796f, 0.801253796f,
+    0.797320664f, 0.797320664f, 0.793353319f, 0.793353319f, 0.789352059f, 0.789352059f,
+    0.785316885f, 0.785316885f, 0.781248152f, 0.781248152f, 0.777145922f, 0.777145922f,
+    0.773010433f, 0.773010433f, 0.768841803f, 0.768841803f, 0.764640272f, 0.764640272f,
+    0.760405958f, 0.760405958f, 0.7561391f, 0.7561391f, 0.751839757f, 0.751839757f,
+    0.747508287f, 0.747508287f, 0.74314481f, 0.74314481f, 0.738749444f, 0.738749444f,
+    0.734322488f, 0.734322488f, 0.729864061f, 0.729864061f, 0.725374401f, 0.725374401f,
+    0.720853567f, 0.720853567f, 0.716301918f, 0.716301918f, 0.711719632f, 0.711719632f,
+    0.707106769f, 0.707106769f, 0.702463627f, 0.702463627f, 0.697790444f, 0.697790444f,
+    0.693087339f, 0.693087339f, 0.688354611f, 0.688354611f, 0.683592319f, 0.683592319f,
+    0.678800762f, 0.678800762f, 0.673980117f, 0.673980117f, 0.669130564f, 0.669130564f,
+    0.6642524f, 0.6642524f, 0.659345746f, 0.659345746f, 0.654410899f, 0.654410899f,
+    0.649448037f, 0.649448037f, 0.64445734f, 0.64445734f, 0.639438987f, 0.639438987f,
+    0.634393275f, 0.634393275f, 0.629320383f, 0.629320383f, 0.62422055f, 0.62422055f,
+    0.619093955f, 0.619093955f, 0.613940835f, 0.613940835f, 0.60876143f, 0.60876143f,
+    0.603555977f, 0.603555977f, 0.598324597f, 0.598324597f, 0.593067586f, 0.593067586f,
+    0.587785184f, 0.587785184f, 0.582477629f, 0.582477629f, 0.577145159f, 0.577145159f,
+    0.571787953f, 0.571787953f, 0.56640619f, 0.56640619f, 0.561000228f, 0.561000228f,
+    0.555570185f, 0.555570185f, 0.55011642f, 0.55011642f, 0.544638991f, 0.544638991f,
+    0.539138258f, 0.539138258f, 0.533614516f, 0.533614516f, 0.528067887f, 0.528067887f,
+    0.522498608f, 0.522498608f, 0.516906857f, 0.516906857f, 0.511292994f, 0.511292994f,
+    0.505657315f, 0.505657315f, 0.49999997f, 0.49999997f, 0.494321108f, 0.494321108f,
+    0.488621175f, 0.488621175f, 0.482900321f, 0.482900321f, 0.477158755f, 0.477158755f,
+    0.471396655f, 0.471396655f, 0.465614468f, 0.465614468f, 0.459812343f, 0.459812343f,
+    0.453990519f, 0.453990519f, 0.448149145f, 0.448149145f, 0.442288667f, 0.442288667f,
+    0.436409265f, 0.436409265f, 0.430511147f, 0.430511147f, 0.424594492f, 0.424594492f,
+    0.418659627f, 0.418659627f, 0.412706971f, 0.412706971f, 0.406736612f, 0.406736612f,
+    0.400748849f, 0.400748849f, 0.3947438f, 0.3947438f, 0.388721943f, 0.388721943f,
+    0.382683426f, 0.382683426f, 0.376628429f, 0.376628429f, 0.370557398f, 0.370557398f,
+    0.364470482f, 0.364470482f, 0.35836798f, 0.35836798f, 0.35225001f, 0.35225001f,
+    0.346117049f, 0.346117049f, 0.339969248f, 0.339969248f, 0.333806813f, 0.333806813f,
+    0.327630162f, 0.327630162f, 0.321439356f, 0.321439356f, 0.3152349f, 0.3152349f,
+    -0.0f, -0.0f, -0.00654493878f, -0.00654493878f, -0.0130895972f, -0.0130895972f,
+    -0.0196336936f, -0.0196336936f, -0.0261769518f, -0.0261769518f, -0.0327190831f, -0.0327190831f,
+    -0.0392598175f, -0.0392598175f, -0.0457988679f, -0.0457988679f, -0.0523359627f, -0.0523359627f,
+    -0.0588708073f, -0.0588708073f, -0.0654031336f, -0.0654031336f, -0.0719326586f, -0.0719326586f,
+    -0.0784590989f, -0.0784590989f, -0.0849821791f, -0.0849821791f, -0.0915016234f, -0.0915016234f,
+    -0.0980171412f, -0.0980171412f, -0.104528472f, -0.104528472f, -0.11103531f, -0.11103531f,
+    -0.117537409f, -0.117537409f, -0.124034457f, -0.124034457f, -0.1305262f, -0.1305262f,
+    -0.137012333f, -0.137012333f, -0.143492624f, -0.143492624f, -0.149966747f, -0.149966747f,
+    -0.156434476f, -0.156434476f, -0.162895471f, -0.162895471f, -0.169349506f, -0.169349506f,
+    -0.175796285f, -0.175796285f, -0.182235524f, -0.182235524f, -0.18866697f, -0.18866697f,
+    -0.195090324f, -0.195090324f, -0.201505318f, -0.201505318f, -0.207911715f, -0.207911715f,
+    -0.214309171f, -0.214309171f, -0.220697448f, -0.220697448f, -0.227076262f, -0.227076262f,
+    -0.233445391f, -0.233445391f, -0.239804476f, -0.239804476f, -0.246153295f, -0.246153295f,
+    -0.252491564f, -0.252491564f, -0.258819044f, -0.258819044f, -0.265135437f, -0.265135437f,
+    -0.271440446f, -0.271440446f, -0.277733833f, -0.277733833f, -0.284015357f, -0.284015357f,
+    -0.290284693f, -0.290284693f, -0.296541572f, -0.296541572f, -0.302785784f, -0.302785784f,
+    -0.309017003f, -0.309017003f, -0.315234989f, -0.315234989f, -0.321439475f, -0.321439475f,
+    -0.327630192f, -0.327630192f, -0.333806872f, -0.333806872f, -0.339969248f, -0.339969248f,
+    -0.346117049f, -0.346117049f, -0.352250069f, -0.352250069f, -0.35836795f, -0.35836795f,
+    -0.364470512f, -0.364470512f, -0.370557427f, -0.370557427f, -0.376628518f, -0.376628518f,
+    -0.382683456f, -0.382683456f, -0.388721973f, -0.388721973f, -0.39474386f, -0.39474386f,
+    -0.400748819f, -0.400748819f, -0.406736672f, -0.406736672f, -0.412707061f, -0.412707061f,
+    -0.418659776f, -0.418659776f, -0.424594522f, -0.424594522f, -0.430511117f, -0.430511117f,
+    -0.436409235f, -0.436409235f, -0.442288697f, -0.442288697f, -0.448149174f, -0.448149174f,
+    -0.453990549f, -0.453990549f, -0.459812403f, -0.459812403f, -0.465614557f, -0.465614557f,
+    -0.471396744f, -0.471396744f, -0.477158785f, -0.477158785f, -0.482900351f, -0.482900351f,
+    -0.488621205f, -0.488621205f, -0.494321257f, -0.494321257f, -0.5f, -0.5f,
+    -0.505657375f, -0.505657375f, -0.511293113f, -0.511293113f, -0.516906917f, -0.516906917f,
+    -0.522498548f, -0.522498548f, -0.528067827f, -0.528067827f, -0.533614516f, -0.533614516f,
+    -0.539138377f, -0.539138377f, -0.544639051f, -0.544639051f, -0.55011642f, -0.55011642f,
+    -0.555570245f, -0.555570245f, -0.561000288f, -0.561000288f, -0.56640625f, -0.56640625f,
+    -0.571787953f, -0.571787953f, -0.577145219f, -0.577145219f, -0.582477748f, -0.582477748f,
+    -0.587785244f, -0.587785244f, -0.593067646f, -0.593067646f, -0.598324597f, -0.598324597f,
+    -0.603555977f, -0.603555977f, -0.60876143f, -0.60876143f, -0.613940835f, -0.613940835f,
+    -0.619093955f, -0.619093955f, -0.62422061f, -0.62422061f, -0.629320383f, -0.629320383f,
+    -0.634393334f, -0.634393334f, -0.639438987f, -0.639438987f, -0.64445734f, -0.64445734f,
+    -0.649448037f, -0.649448037f, -0.654410958f, -0.654410958f, -0.659345865f, -0.659345865f,
+    -0.66425246f, -0.66425246f, -0.669130623f, -0.669130623f, -0.673980117f, -0.673980117f,
+    -0.678800762f, -0.678800762f, -0.683592319f, -0.683592319f, -0.688354552f, -0.688354552f,
+    -0.693087399f, -0.693087399f, -0.697790504f, -0.697790504f, -0.702463686f, -0.702463686f,
+    -0.707106769f, -0.707106769f, -0.711719632f, -0.711719632f, -0.716301978f, -0.716301978f,
+    -0.720853627f, -0.720853627f, -0.725374341f, -0.725374341f, -0.729864061f, -0.729864061f,
+    -0.734322488f, -0.734322488f, -0.738749504f, -0.738749504f, -0.74314487f, -0.74314487f,
+    -0.747508347f, -0.747508347f, -0.751839876f, -0.751839876f, -0.7561391f, -0.7561391f,
+    -0.760406017f, -0.760406017f, -0.764640272f, -0.764640272f, -0.768841863f, -0.768841863f,
+    -0.773010433f, -0.773010433f, -0.777145982f, -0.777145982f, -0.781248152f, -0.781248152f,
+    -0.785316944f, -0.785316944f, -0.789352f, -0.789352f, -0.793353319f, -0.793353319f,
+    -0.797320604f, -0.797320604f, -0.801253796f, -0.801253796f, -0.805152714f, -0.805152714f,
+    -0.809017062f, -0.809017062f, -0.81284672f, -0.81284672f, -0.816641569f, -0.816641569f,
+    -0.82040149f, -0.82040149f, -0.824126244f, -0.824126244f, -0.827815652f, -0.827815652f,
+    -0.831469655f, -0.831469655f, -0.835087955f, -0.835087955f, -0.838670611f, -0.838670611f,
+    -0.842217267f, -0.842217267f, -0.845727801f, -0.845727801f, -0.849202156f, -0.849202156f,
+    -0.852640152f, -0.852640152f, -0.85604161f, -0.85604161f, -0.859406471f, -0.859406471f,
+    -0.862734437f, -0.862734437f, -0.866025448f, -0.866025448f, -0.869279385f, -0.869279385f,
+    -0.872496068f, -0.872496068f, -0.875675321f, -0.875675321f, -0.878817141f, -0.878817141f,
+    -0.881921291f, -0.881921291f, -0.884987652f, -0.884987652f, -0.888016105f, -0.888016105f,
+    -0.891006529f, -0.891006529f, -0.893958807f, -0.893958807f, -0.896872759f, -0.896872759f,
+    -0.899748266f, -0.899748266f, -0.902585268f, -0.902585268f, -0.905383646f, -0.905383646f,
+    -0.908143222f, -0.908143222f, -0.910863876f, -0.910863876f, -0.913545489f, -0.913545489f,
+    -0.916187942f, -0.916187942f, -0.918791234f, -0.918791234f, -0.921355128f, -0.921355128f,
+    -0.923879504f, -0.923879504f, -0.926364422f, -0.926364422f, -0.928809583f, -0.928809583f,
+    -0.931214929f, -0.931214929f, -0.933580399f, -0.933580399f, -0.935905933f, -0.935905933f,
+    -0.938191354f, -0.938191354f, -0.940436542f, -0.940436542f, -0.942641497f, -0.942641497f,
+    -0.944806039f, -0.944806039f, -0.94693017f, -0.94693017f, -0.94901365f, -0.94901365f,
+    1.0f, 1.0f, 0.999914348f, 0.999914348f, 0.999657333f, 0.999657333f,
+    0.999229014f, 0.999229014f, 0.99862951f, 0.99862951f, 0.997858942f, 0.997858942f,
+    0.996917307f, 0.996917307f, 0.995804906f, 0.995804906f, 0.994521916f, 0.994521916f,
+    0.993068457f, 0.993068457f, 0.991444886f, 0.991444886f, 0.989651382f, 0.989651382f,
+    0.987688363f, 0.987688363f, 0.985556066f, 0.985556066f, 0.98325491f, 0.98325491f,
+    0.980785251f, 0.980785251f, 0.978147626f, 0.978147626f, 0.975342333f, 0.975342333f,
+    0.972369909f, 0.972369909f, 0.96923089f, 0.96923089f, 0.965925813f, 0.965925813f,
+    0.962455213f, 0.962455213f, 0.958819747f, 0.958819747f, 0.955019951f, 0.955019951f,
+    0.95105654f, 0.95105654f, 0.94693011f, 0.94693011f, 0.942641497f, 0.942641497f,
+    0.938191354f, 0.938191354f, 0.933580399f, 0.933580399f, 0.928809583f, 0.928809583f,
+    0.923879504f, 0.923879504f, 0.918791234f, 0.918791234f, 0.91354543f, 0.91354543f,
+    0.908143163f, 0.908143163f, 0.902585268f, 0.902585268f, 0.896872759f, 0.896872759f,
+    0.891006529f, 0.891006529f, 0.884987652f, 0.884987652f, 0.878817081f, 0.878817081f,
+    0.872496009f, 0.872496009f, 0.866025388f, 0.866025388f, 0.859406412f, 0.859406412f,
+    0.852640152f, 0.852640152f, 0.845727861f, 0.845727861f, 0.838670552f, 0.838670552f,
+    0.831469595f, 0.831469595f, 0.824126184f, 0.824126184f, 0.81664151f, 0.81664151f,
+    0.809017003f, 0.809017003f, 0.801253796f, 0.801253796f, 0.793353319f, 0.793353319f,
+    0.785316885f, 0.785316885f, 0.777145922f, 0.777145922f, 0.768841803f, 0.768841803f,
+    0.760405958f, 0.760405958f, 0.751839757f, 0.751839757f, 0.74314481f, 0.74314481f,
+    0.734322488f, 0.734322488f, 0.725374401f, 0.725374401f, 0.716301918f, 0.716301918f,
+    0.707106769f, 0.707106769f, 0.697790444f, 0.697790444f, 0.688354611f, 0.688354611f,
+    0.678800762f, 0.678800762f, 0.669130564f, 0.669130564f, 0.659345746f, 0.659345746f,
+    0.649448037f, 0.649448037f, 0.639438987f, 0.639438987f, 0.629320383f, 0.629320383f,
+    0.619093955f, 0.619093955f, 0.60876143f, 0.60876143f, 0.598324597f, 0.598324597f,
+    0.587785184f, 0.587785184f, 0.577145159f, 0.577145159f, 0.56640619f, 0.56640619f,
+    0.555570185f, 0.555570185f, 0.544638991f, 0.544638991f, 0.533614516f, 0.533614516f,
+    0.522498608f, 0.522498608f, 0.511292994f, 0.511292994f, 0.49999997f, 0.49999997f,
+    0.488621175f, 0.488621175f, 0.477158755f, 0.477158755f, 0.465614468f, 0.465614468f,
+    0.453990519f, 0.453990519f, 0.442288667f, 0.442288667f, 0.430511147f, 0.430511147f,
+    0.418659627f, 0.418659627f, 0.406736612f, 0.406736612f, 0.3947438f, 0.3947438f,
+    0.382683426f, 0.382683426f, 0.370557398f, 0.370557398f, 0.35836798f, 0.35836798f,
+    0.346117049f, 0.346117049f, 0.333806813f, 0.333806813f, 0.321439356f, 0.321439356f,
+    0.309016973f, 0.309016973f, 0.296541512f, 0.296541512f, 0.284015328f, 0.284015328f,
+    0.271440417f, 0.271440417f, 0.258819073f, 0.258819073f, 0.24615328f, 0.24615328f,
+    0.233445302f, 0.233445302f, 0.220697328f, 0.220697328f, 0.207911655f, 0.207911655f,
+    0.195090234f, 0.195090234f, 0.182235524f, 0.182235524f, 0.169349447f, 0.169349447f,
+    0.156434491f, 0.156434491f, 0.143492594f, 0.143492594f, 0.130526125f, 0.130526125f,
+    0.117537282f, 0.117537282f, 0.10452842f, 0.10452842f, 0.091501534f, 0.091501534f,
+    0.078459084f, 0.078459084f, 0.065403074f, 0.065403074f, 0.0523359738f, 0.0523359738f,
+    0.0392597876f, 0.0392597876f, 0.0261768755f, 0.0261768755f, 0.0130895972f, 0.0130895972f,
+    -4.37113883e-08f, -4.37113883e-08f, -0.0130896848f, -0.0130896848f, -0.026176963f, -0.026176963f,
+    -0.0392598771f, -0.0392598771f, -0.0523359403f, -0.0523359403f, -0.0654031634f, -0.0654031634f,
+    -0.0784590542f, -0.0784590542f, -0.0915016234f, -0.0915016234f, -0.104528628f, -0.104528628f,
+    -0.117537491f, -0.117537491f, -0.130526334f, -0.130526334f, -0.143492684f, -0.143492684f,
+    -0.156434566f, -0.156434566f, -0.169349536f, -0.169349536f, -0.182235599f, -0.182235599f,
+    -0.195090324f, -0.195090324f, -0.207911745f, -0.207911745f, -0.220697418f, -0.220697418f,
+    -0.233445391f, -0.233445391f, -0.246153235f, -0.246153235f, -0.258819044f, -0.258819044f,
+    -0.271440357f, -0.271440357f, -0.284015298f, -0.284015298f, -0.296541691f, -0.296541691f,
+    -0.309017152f, -0.309017152f, -0.321439564f, -0.321439564f, -0.333806992f, -0.333806992f,
+    -0.346117109f, -0.346117109f, -0.358368069f, -0.358368069f, -0.370557487f, -0.370557487f,
+    -0.382683516f, -0.382683516f, -0.39474386f, -0.39474386f, -0.406736702f, -0.406736702f,
+    -0.418659836f, -0.418659836f, -0.430511117f, -0.430511117f, -0.442288637f, -0.442288637f,
+    -0.4539904f, -0.4539904f, -0.465614557f, -0.465614557f, -0.477158934f, -0.477158934f,
+    -0.488621354f, -0.488621354f, -0.50000006f, -0.50000006f, -0.511293292f, -0.511293292f,
+    -0.522498667f, -0.522498667f, -0.533614576f, -0.533614576f, -0.544639051f, -0.544639051f,
+    -0.555570364f, -0.555570364f, -0.56640631f, -0.56640631f, -0.577145219f, -0.577145219f,
+    -0.587785184f, -0.587785184f, -0.598324656f, -0.598324656f, -0.60876143f, -0.60876143f,
+    -0.619093895f, -0.619093895f, -0.629320323f, -0.629320323f, -0.639439046f, -0.639439046f,
+    -0.649448216f, -0.649448216f, -0.659345925f, -0.659345925f, -0.669130683f, -0.669130683f,
+    -0.678800762f, -0.678800762f, -0.688354671f, -0.688354671f, -0.697790504f, -0.697790504f,
+    -0.707106769f, -0.707106769f, -0.716302037f, -0.716302037f, -0.72537446f, -0.72537446f,
+    -0.734322548f, -0.734322548f, -0.74314481f, -0.74314481f, -0.751839876f, -0.751839876f,
+    -0.760406017f, -0.760406017f, -0.768841803f, -0.768841803f, -0.777146041f, -0.777146041f,
+    -0.785316944f, -0.785316944f, -0.793353498f, -0.793353498f, -0.801253915f, -0.801253915f,
+    -0.0f, -0.0f, -0.0130895972f, -0.0130895972f, -0.0261769518f, -0.0261769518f,
+    -0.0392598175f, -0.0392598175f, -0.0523359627f, -0.0523359627f, -0.0654031336f, -0.0654031336f,
+    -0.0784590989f, -0.0784590989f, -0.0915016234f, -0.0915016234f, -0.104528472f, -0.104528472f,
+    -0.117537409f, -0.117537409f, -0.1305262f, -0.1305262f, -0.143492624f, -0.143492624f,
+    -0.156434476f, -0.156434476f, -0.169349506f, -0.169349506f, -0.182235524f, -0.182235524f,
+    -0.195090324f, -0.195090324f, -0.207911715f, -0.207911715f, -0.220697448f, -0.220697448f,
+    -0.233445391f, -0.233445391f, -0.246153295f, -0.246153295f, -0.258819044f, -0.258819044f,
+    -0.271440446f, -0.271440446f, -0.284015357f, -0.284015357f, -0.296541572f, -0.296541572f,
+    -0.309017003f, -0.309017003f, -0.321439475f, -0.321439475f, -0.333806872f, -0.333806872f,
+    -0.346117049f, -0.346117049f, -0.35836795f, -0.35836795f, -0.370557427f, -0.370557427f,
+    -0.382683456f, -0.382683456f, -0.39474386f, -0.39474386f, -0.406736672f, -0.406736672f,
+    -0.418659776f, -0.418659776f, -0.430511117f, -0.430511117f, -0.442288697f, -0.442288697f,
+    -0.453990549f, -0.453990549f, -0.465614557f, -0.465614557f, -0.477158785f, -0.477158785f,
+    -0.488621205f, -0.488621205f, -0.5f, -0.5f, -0.511293113f, -0.511293113f,
+    -0.522498548f, -0.522498548f, -0.533614516f, -0.533614516f, -0.544639051f, -0.544639051f,
+    -0.555570245f, -0.555570245f, -0.56640625f, -0.56640625f, -0.577145219f, -0.577145219f,
+    -0.587785244f, -0.587785244f, -0.598324597f, -0.598324597f, -0.60876143f, -0.60876143f,
+    -0.619093955f, -0.619093955f, -0.629320383f, -0.629320383f, -0.639438987f, -0.639438987f,
+    -0.649448037f, -0.649448037f, -0.659345865f, -0.659345865f, -0.669130623f, -0.669130623f,
+    -0.678800762f, -0.678800762f, -0.688354552f, -0.688354552f, -0.697790504f, -0.697790504f,
+    -0.707106769f, -0.707106769f, -0.716301978f, -0.716301978f, -0.725374341f, -0.725374341f,
+    -0.734322488f, -0.734322488f, -0.74314487f, -0.74314487f, -0.751839876f, -0.751839876f,
+    -0.760406017f, -0.760406017f, -0.768841863f, -0.768841863f, -0.777145982f, -0.777145982f,
+    -0.785316944f, -0.785316944f, -0.793353319f, -0.793353319f, -0.801253796f, -0.801253796f,
+    -0.809017062f, -0.809017062f, -0.816641569f, -0.816641569f, -0.824126244f, -0.824126244f,
+    -0.831469655f, -0.831469655f, -0.838670611f, -0.838670611f, -0.845727801f, -0.845727801f,
+    -0.852640152f, -0.852640152f, -0.859406471f, -0.859406471f, -0.866025448f, -0.866025448f,
+    -0.872496068f, -0.872496068f, -0.878817141f, -0.878817141f, -0.884987652f, -0.884987652f,
+    -0.891006529f, -0.891006529f, -0.896872759f, -0.896872759f, -0.902585268f, -0.902585268f,
+    -0.908143222f, -0.908143222f, -0.913545489f, -0.913545489f, -0.918791234f, -0.918791234f,
+    -0.923879504f, -0.923879504f, -0.928809583f, -0.928809583f, -0.933580399f, -0.933580399f,
+    -0.938191354f, -0.938191354f, -0.942641497f, -0.942641497f, -0.94693017f, -0.94693017f,
+    -0.95105654f, -0.95105654f, -0.955019951f, -0.955019951f, -0.958819747f, -0.958819747f,
+    -0.962455273f, -0.962455273f, -0.965925813f, -0.965925813f, -0.96923089f, -0.96923089f,
+    -0.972369909f, -0.972369909f, -0.975342333f, -0.975342333f, -0.978147626f, -0.978147626f,
+    -0.98078531f, -0.98078531f, -0.98325491f, -0.98325491f, -0.985556066f, -0.985556066f,
+    -0.987688363f, -0.987688363f, -0.989651382f, -0.989651382f, -0.991444886f, -0.991444886f,
+    -0.993068457f, -0.993068457f, -0.994521916f, -0.994521916f, -0.995804906f, -0.995804906f,
+    -0.996917307f, -0.996917307f, -0.997858942f, -0.997858942f, -0.99862951f, -0.99862951f,
+    -0.999229014f, -0.999229014f, -0.999657333f, -0.999657333f, -0.999914348f, -0.999914348f,
+    -1.0f, -1.0f, -0.999914348f, -0.999914348f, -0.999657333f, -0.999657333f,
+    -0.999229014f, -0.999229014f, -0.99862951f, -0.99862951f, -0.997858942f, -0.997858942f,
+    -0.996917307f, -0.996917307f, -0.995804906f, -0.995804906f, -0.994521856f, -0.994521856f,
+    -0.993068457f, -0.993068457f, -0.991444826f, -0.991444826f, -0.989651382f, -0.989651382f,
+    -0.987688303f, -0.987688303f, -0.985556066f, -0.985556066f, -0.98325491f, -0.98325491f,
+    -0.980785251f, -0.980785251f, -0.978147566f, -0.978147566f, -0.975342333f, -0.975342333f,
+    -0.972369909f, -0.972369909f, -0.96923095f, -0.96923095f, -0.965925813f, -0.965925813f,
+    -0.962455273f, -0.962455273f, -0.958819747f, -0.958819747f, -0.955019891f, -0.955019891f,
+    -0.95105648f, -0.95105648f, -0.94693011f, -0.94693011f, -0.942641437f, -0.942641437f,
+    -0.938191295f, -0.938191295f, -0.933580399f, -0.933580399f, -0.928809524f, -0.928809524f,
+    -0.923879504f, -0.923879504f, -0.918791234f, -0.918791234f, -0.91354543f, -0.91354543f,
+    -0.908143103f, -0.908143103f, -0.902585268f, -0.902585268f, -0.896872759f, -0.896872759f,
+    -0.891006589f, -0.891006589f, -0.884987593f, -0.884987593f, -0.878817022f, -0.878817022f,
+    -0.872495949f, -0.872495949f, -0.866025388f, -0.866025388f, -0.859406292f, -0.859406292f,
+    -0.852640092f, -0.852640092f, -0.845727801f, -0.845727801f, -0.838670552f, -0.838670552f,
+    -0.831469536f, -0.831469536f, -0.824126124f, -0.824126124f, -0.816641569f, -0.816641569f,
+    -0.809017003f, -0.809017003f, -0.801253736f, -0.801253736f, -0.793353319f, -0.793353319f,
+    -0.785316944f, -0.785316944f, -0.777146041f, -0.777146041f, -0.768841803f, -0.768841803f,
+    -0.760405838f, -0.760405838f, -0.751839697f, -0.751839697f, -0.74314481f, -0.74314481f,
+    -0.734322488f, -0.734322488f, -0.725374281f, -0.725374281f, -0.716301858f, -0.716301858f,
+    -0.707106769f, -0.707106769f, -0.697790325f, -0.697790325f, -0.688354492f, -0.688354492f,
+    -0.678800702f, -0.678800702f, -0.669130623f, -0.669130623f, -0.659345746f, -0.659345746f,
+    -0.649448037f, -0.649448037f, -0.639439046f, -0.639439046f, -0.629320264f, -0.629320264f,
+    -0.619093895f, -0.619093895f, -0.608761251f, -0.608761251f, -0.598324478f, -0.598324478f,
+    1.0f, 1.0f, 0.999807239f, 0.999807239f, 0.999229014f, 0.999229014f,
+    0.998265624f, 0.998265624f, 0.996917307f, 0.996917307f, 0.99518472f, 0.99518472f,
+    0.993068457f, 0.993068457f, 0.990569353f, 0.990569353f, 0.987688363f, 0.987688363f,
+    0.984426558f, 0.984426558f, 0.980785251f, 0.980785251f, 0.976765871f, 0.976765871f,
+    0.972369909f, 0.972369909f, 0.967599094f, 0.967599094f, 0.962455213f, 0.962455213f,
+    0.956940353f, 0.956940353f, 0.95105654f, 0.95105654f, 0.944806039f, 0.944806039f,
+    0.938191354f, 0.938191354f, 0.931214929f, 0.931214929f, 0.923879504f, 0.923879504f,
+    0.916187942f, 0.916187942f, 0.908143163f, 0.908143163f, 0.899748266f, 0.899748266f,
+    0.891006529f, 0.891006529f, 0.881921232f, 0.881921232f, 0.872496009f, 0.872496009f,
+    0.862734377f, 0.862734377f, 0.852640152f, 0.852640152f, 0.842217207f, 0.842217207f,
+    0.831469595f, 0.831469595f, 0.82040143f, 0.82040143f, 0.809017003f, 0.809017003f,
+    0.797320664f, 0.797320664f, 0.785316885f, 0.785316885f, 0.773010433f, 0.773010433f,
+    0.760405958f, 0.760405958f, 0.747508287f, 0.747508287f, 0.734322488f, 0.734322488f,
+    0.720853567f, 0.720853567f, 0.707106769f, 0.707106769f, 0.693087339f, 0.693087339f,
+    0.678800762f, 0.678800762f, 0.6642524f, 0.6642524f, 0.649448037f, 0.649448037f,
+    0.634393275f, 0.634393275f, 0.619093955f, 0.619093955f, 0.603555977f, 0.603555977f,
+    0.587785184f, 0.587785184f, 0.571787953f, 0.571787953f, 0.555570185f, 0.555570185f,
+    0.539138258f, 0.539138258f, 0.522498608f, 0.522498608f, 0.505657315f, 0.505657315f,
+    0.488621175f, 0.488621175f, 0.471396655f, 0.471396655f, 0.453990519f, 0.453990519f,
+    0.436409265f, 0.436409265f, 0.418659627f, 0.418659627f, 0.400748849f, 0.400748849f,
+    0.382683426f, 0.382683426f, 0.364470482f, 0.364470482f, 0.346117049f, 0.346117049f,
+    0.327630162f, 0.327630162f, 0.309016973f, 0.309016973f, 0.290284634f, 0.290284634f,
+    0.271440417f, 0.271440417f, 0.252491623f, 0.252491623f, 0.233445302f, 0.233445302f,
+    0.214309081f, 0.214309081f, 0.195090234f, 0.195090234f, 0.175796315f, 0.175796315f,
+    0.156434491f, 0.156434491f, 0.137012243f, 0.137012243f, 0.117537282f, 0.117537282f,
+    0.0980171338f, 0.0980171338f, 0.078459084f, 0.078459084f, 0.0588707849f, 0.0588707849f,
+    0.0392597876f, 0.0392597876f, 0.0196336564f, 0.0196336564f, -4.37113883e-08f, -4.37113883e-08f,
+    -0.0196338631f, -0.0196338631f, -0.0392598771f, -0.0392598771f, -0.0588708706f, -0.0588708706f,
+    -0.0784590542f, -0.0784590542f, -0.0980172232f, -0.0980172232f, -0.117537491f, -0.117537491f,
+    -0.137012318f, -0.137012318f, -0.156434566f, -0.156434566f, -0.17579627f, -0.17579627f,
+    -0.195090324f, -0.195090324f, -0.214309275f, -0.214309275f, -0.233445391f, -0.233445391f,
+    -0.252491713f, -0.252491713f, -0.271440357f, -0.271440357f, -0.290284723f, -0.290284723f,
+    -0.309017152f, -0.309017152f, -0.327630252f, -0.327630252f, -0.346117109f, -0.346117109f,
+    -0.364470452f, -0.364470452f, -0.382683516f, -0.382683516f, -0.400748909f, -0.400748909f,
+    -0.418659836f, -0.418659836f, -0.436409324f, -0.436409324f, -0.4539904f, -0.4539904f,
+    -0.471396834f, -0.471396834f, -0.488621354f, -0.488621354f, -0.505657315f, -0.505657315f,
+    -0.522498667f, -0.522498667f, -0.539138258f, -0.539138258f, -0.555570364f, -0.555570364f,
+    -0.571788073f, -0.571788073f, -0.587785184f, -0.587785184f, -0.603556097f, -0.603556097f,
+    -0.619093895f, -0.619093895f, -0.634393275f, -0.634393275f, -0.649448216f, -0.649448216f,
+    -0.6642524f, -0.6642524f, -0.678800762f, -0.678800762f, -0.693087339f, -0.693087339f,
+    -0.707106769f, -0.707106769f, -0.720853746f, -0.720853746f, -0.734322548f, -0.734322548f,
+    -0.747508347f, -0.747508347f, -0.760406017f, -0.760406017f, -0.773010492f, -0.773010492f,
+    -0.785316944f, -0.785316944f, -0.797320664f, -0.797320664f, -0.809017062f, -0.809017062f,
+    -0.82040149f, -0.82040149f, -0.831469655f, -0.831469655f, -0.842217267f, -0.842217267f,
+    -0.852640212f, -0.852640212f, -0.862734437f, -0.862734437f, -0.872495949f, -0.872495949f,
+    -0.881921351f, -0.881921351f, -0.891006589f, -0.891006589f, -0.899748325f, -0.899748325f,
+    -0.908143222f, -0.908143222f, -0.916187942f, -0.916187942f, -0.923879623f, -0.923879623f,
+    -0.931214988f, -0.931214988f, -0.938191295f, -0.938191295f, -0.944806099f, -0.944806099f,
+    -0.95105648f, -0.95105648f, -0.956940353f, -0.956940353f, -0.962455273f, -0.962455273f,
+    -0.967599094f, -0.967599094f, -0.972369969f, -0.972369969f, -0.976765871f, -0.976765871f,
+    -0.98078531f, -0.98078531f, -0.984426618f, -0.984426618f, -0.987688363f, -0.987688363f,
+    -0.990569353f, -0.990569353f, -0.993068457f, -0.993068457f, -0.99518472f, -0.99518472f,
+    -0.996917367f, -0.996917367f, -0.998265624f, -0.998265624f, -0.999229014f, -0.999229014f,
+    -0.999807239f, -0.999807239f, -1.0f, -1.0f, -0.999807239f, -0.999807239f,
+    -0.999229014f, -0.999229014f, -0.998265624f, -0.998265624f, -0.996917307f, -0.996917307f,
+    -0.99518472f, -0.99518472f, -0.993068457f, -0.993068457f, -0.990569293f, -0.990569293f,
+    -0.987688363f, -0.987688363f, -0.984426558f, -0.984426558f, -0.980785251f, -0.980785251f,
+    -0.976765871f, -0.976765871f, -0.97236985f, -0.97236985f, -0.967599094f, -0.967599094f,
+    -0.962455273f, -0.962455273f, -0.956940293f, -0.956940293f, -0.951056421f, -0.951056421f,
+    -0.94480598f, -0.94480598f, -0.938191354f, -0.938191354f, -0.931214929f, -0.931214929f,
+    -0.923879504f, -0.923879504f, -0.916187882f, -0.916187882f, -0.908143044f, -0.908143044f,
+    -0.899748266f, -0.899748266f, -0.891006529f, -0.891006529f, -0.881921232f, -0.881921232f,
+    -0.87249589f, -0.87249589f, -0.862734258f, -0.862734258f, -0.852640271f, -0.852640271f,
+    -0.842217207f, -0.842217207f, -0.831469536f, -0.831469536f, -0.820401371f, -0.820401371f,
+    -0.0f, -0.0f, -0.0196336936f, -0.0196336936f, -0.0392598175f, -0.0392598175f,
+    -0.0588708073f, -0.0588708073f, -0.0784590989f, -0.0784590989f, -0.0980171412f, -0.0980171412f,
+    -0.117537409f, -0.117537409f, -0.137012333f, -0.137012333f, -0.156434476f, -0.156434476f,
+    -0.175796285f, -0.175796285f, -0.195090324f, -0.195090324f, -0.214309171f, -0.214309171f,
+    -0.233445391f, -0.233445391f, -0.252491564f, -0.252491564f, -0.271440446f, -0.271440446f,
+    -0.290284693f, -0.290284693f, -0.309017003f, -0.309017003f, -0.327630192f, -0.327630192f,
+    -0.346117049f, -0.346117049f, -0.364470512f, -0.364470512f, -0.382683456f, -0.382683456f,
+    -0.400748819f, -0.400748819f, -0.418659776f, -0.418659776f, -0.436409235f, -0.436409235f,
+    -0.453990549f, -0.453990549f, -0.471396744f, -0.471396744f, -0.488621205f, -0.488621205f,
+    -0.505657375f, -0.505657375f, -0.522498548f, -0.522498548f, -0.539138377f, -0.539138377f,
+    -0.555570245f, -0.555570245f, -0.571787953f, -0.571787953f, -0.587785244f, -0.587785244f,
+    -0.603555977f, -0.603555977f, -0.619093955f, -0.619093955f, -0.634393334f, -0.634393334f,
+    -0.649448037f, -0.649448037f, -0.66425246f, -0.66425246f, -0.678800762f, -0.678800762f,
+    -0.693087399f, -0.693087399f, -0.707106769f, -0.707106769f, -0.720853627f, -0.720853627f,
+    -0.734322488f, -0.734322488f, -0.747508347f, -0.747508347f, -0.760406017f, -0.760406017f,
+    -0.773010433f, -0.773010433f, -0.785316944f, -0.785316944f, -0.797320604f, -0.797320604f,
+    -0.809017062f, -0.809017062f, -0.82040149f, -0.82040149f, -0.831469655f, -0.831469655f,
+    -0.842217267f, -0.842217267f, -0.852640152f, -0.852640152f, -0.862734437f, -0.862734437f,
+    -0.872496068f, -0.872496068f, -0.881921291f, -0.881921291f, -0.891006529f, -0.891006529f,
+    -0.899748266f, -0.899748266f, -0.908143222f, -0.908143222f, -0.916187942f, -0.916187942f,
+    -0.923879504f, -0.923879504f, -0.931214929f, -0.931214929f, -0.938191354f, -0.938191354f,
+    -0.944806039f, -0.944806039f, -0.95105654f, -0.95105654f, -0.956940353f, -0.956940353f,
+    -0.962455273f, -0.962455273f, -0.967599094f, -0.967599094f, -0.972369909f, -0.972369909f,
+    -0.976765871f, -0.976765871f, -0.98078531f, -0.98078531f, -0.984426558f, -0.984426558f,
+    -0.987688363f, -0.987688363f, -0.990569353f, -0.990569353f, -0.993068457f, -0.993068457f,
+    -0.99518472f, -0.99518472f, -0.996917307f, -0.996917307f, -0.998265624f, -0.998265624f,
+    -0.999229014f, -0.999229014f, -0.999807239f, -0.999807239f, -1.0f, -1.0f,
+    -0.999807239f, -0.999807239f, -0.999229014f, -0.999229014f, -0.998265624f, -0.998265624f,
+    -0.996917307f, -0.996917307f, -0.99518472f, -0.99518472f, -0.993068457f, -0.993068457f,
+    -0.990569353f, -0.990569353f, -0.987688303f, -0.987688303f, -0.984426558f, -0.984426558f,
+    -0.980785251f, -0.980785251f, -0.976765871f, -0.976765871f, -0.972369909f, -0.972369909f,
+    -0.967599034f, -0.967599034f, -0.962455273f, -0.962455273f, -0.956940293f, -0.956940293f,
+    -0.95105648f, -0.95105648f, -0.944806039f, -0.944806039f, -0.938191295f, -0.938191295f,
+    -0.931214929f, -0.931214929f, -0.923879504f, -0.923879504f, -0.916187942f, -0.916187942f,
+    -0.908143103f, -0.908143103f, -0.899748266f, -0.899748266f, -0.891006589f, -0.891006589f,
+    -0.881921232f, -0.881921232f, -0.872495949f, -0.872495949f, -0.862734437f, -0.862734437f,
+    -0.852640092f, -0.852640092f, -0.842217267f, -0.842217267f, -0.831469536f, -0.831469536f,
+    -0.820401371f, -0.820401371f, -0.809017003f, -0.809017003f, -0.797320545f, -0.797320545f,
+    -0.785316944f, -0.785316944f, -0.773010492f, -0.773010492f, -0.760405838f, -0.760405838f,
+    -0.747508347f, -0.747508347f, -0.734322488f, -0.734322488f, -0.720853627f, -0.720853627f,
+    -0.707106769f, -0.707106769f, -0.693087161f, -0.693087161f, -0.678800702f, -0.678800702f,
+    -0.6642524f, -0.6642524f, -0.649448037f, -0.649448037f, -0.634393275f, -0.634393275f,
+    -0.619093895f, -0.619093895f, -0.603555918f, -0.603555918f, -0.587785184f, -0.587785184f,
+    -0.571787894f, -0.571787894f, -0.555570185f, -0.555570185f, -0.539138258f, -0.539138258f,
+    -0.522498488f, -0.522498488f, -0.505657256f, -0.505657256f, -0.488621354f, -0.488621354f,
+    -0.471396625f, -0.471396625f, -0.45399037f, -0.45399037f, -0.436409116f, -0.436409116f,
+    -0.418659598f, -0.418659598f, -0.400748909f, -0.400748909f, -0.382683277f, -0.382683277f,
+    -0.364470333f, -0.364470333f, -0.346117109f, -0.346117109f, -0.327630013f, -0.327630013f,
+    -0.309017032f, -0.309017032f, -0.290284723f, -0.290284723f, -0.271440238f, -0.271440238f,
+    -0.252491593f, -0.252491593f, -0.233445138f, -0.233445138f, -0.214309156f, -0.214309156f,
+    -0.195090309f, -0.195090309f, -0.175796032f, -0.175796032f, -0.156434447f, -0.156434447f,
+    -0.137012318f, -0.137012318f, -0.117537357f, -0.117537357f, -0.0980170965f, -0.0980170965f,
+    -0.0784590393f, -0.0784590393f, -0.0588707402f, -0.0588707402f, -0.0392597429f, -0.0392597429f,
+    -0.0196336135f, -0.0196336135f, 8.74227766e-08f, 8.74227766e-08f, 0.0196337886f, 0.0196337886f,
+    0.0392601565f, 0.0392601565f, 0.0588706769f, 0.0588706769f, 0.0784592181f, 0.0784592181f,
+    0.0980172679f, 0.0980172679f, 0.117537536f, 0.117537536f, 0.137012482f, 0.137012482f,
+    0.156434372f, 0.156434372f, 0.175796196f, 0.175796196f, 0.195090488f, 0.195090488f,
+    0.21430932f, 0.21430932f, 0.23344554f, 0.23344554f, 0.252491534f, 0.252491534f,
+    0.271440417f, 0.271440417f, 0.290284872f, 0.290284872f, 0.309017211f, 0.309017211f,
+    0.327630401f, 0.327630401f, 0.346117049f, 0.346117049f, 0.364470512f, 0.364470512f,
+    0.382683426f, 0.382683426f, 0.400749058f, 0.400749058f, 0.418659985f, 0.418659985f,
+    0.436409265f, 0.436409265f, 0.453990549f, 0.453990549f, 0.471396774f, 0.471396774f,
+    0.488621503f, 0.488621503f, 0.505657613f, 0.505657613f, 0.522498429f, 0.522498429f,
+    0.539138377f, 0.539138377f, 0.555570304f, 0.555570304f, 0.571788013f, 0.571788013f,
+    1.0f, 1.0f, 0.999657333f, 0.999657333f, 0.99862951f, 0.99862951f,
+    0.996917307f, 0.996917307f, 0.994521916f, 0.994521916f, 0.991444886f, 0.991444886f,
+    0.987688363f, 0.987688363f, 0.98325491f, 0.98325491f, 0.978147626f, 0.978147626f,
+    0.972369909f, 0.972369909f, 0.965925813f, 0.965925813f, 0.958819747f, 0.958819747f,
+    0.95105654f, 0.95105654f, 0.942641497f, 0.942641497f, 0.933580399f, 0.933580399f,
+    0.923879504f, 0.923879504f, 0.91354543f, 0.91354543f, 0.902585268f, 0.902585268f,
+    0.891006529f, 0.891006529f, 0.878817081f, 0.878817081f, 0.866025388f, 0.866025388f,
+    0.852640152f, 0.852640152f, 0.838670552f, 0.838670552f, 0.824126184f, 0.824126184f,
+    0.809017003f, 0.809017003f, 0.793353319f, 0.793353319f, 0.777145922f, 0.777145922f,
+    0.760405958f, 0.760405958f, 0.74314481f, 0.74314481f, 0.725374401f, 0.725374401f,
+    0.707106769f, 0.707106769f, 0.688354611f, 0.688354611f, 0.669130564f, 0.669130564f,
+    0.649448037f, 0.649448037f, 0.629320383f, 0.629320383f, 0.60876143f, 0.60876143f,
+    0.587785184f, 0.587785184f, 0.56640619f, 0.56640619f, 0.544638991f, 0.544638991f,
+    0.522498608f, 0.522498608f, 0.49999997f, 0.49999997f, 0.477158755f, 0.477158755f,
+    0.453990519f, 0.453990519f, 0.430511147f, 0.430511147f, 0.406736612f, 0.406736612f,
+    0.382683426f, 0.382683426f, 0.35836798f, 0.35836798f, 0.333806813f, 0.333806813f,
+    0.309016973f, 0.309016973f, 0.284015328f, 0.284015328f, 0.258819073f, 0.258819073f,
+    0.233445302f, 0.233445302f, 0.207911655f, 0.207911655f, 0.182235524f, 0.182235524f,
+    0.156434491f, 0.156434491f, 0.130526125f, 0.130526125f, 0.10452842f, 0.10452842f,
+    0.078459084f, 0.078459084f, 0.0523359738f, 0.0523359738f, 0.0261768755f, 0.0261768755f,
+    -4.37113883e-08f, -4.37113883e-08f, -0.026176963f, -0.026176963f, -0.0523359403f, -0.0523359403f,
+    -0.0784590542f, -0.0784590542f, -0.104528628f, -0.104528628f, -0.130526334f, -0.130526334f,
+    -0.156434566f, -0.156434566f, -0.182235599f, -0.182235599f, -0.207911745f, -0.207911745f,
+    -0.233445391f, -0.233445391f, -0.258819044f, -0.258819044f, -0.284015298f, -0.284015298f,
+    -0.309017152f, -0.309017152f, -0.333806992f, -0.333806992f, -0.358368069f, -0.358368069f,
+    -0.382683516f, -0.382683516f, -0.406736702f, -0.406736702f, -0.430511117f, -0.430511117f,
+    -0.4539904f, -0.4539904f, -0.477158934f, -0.477158934f, -0.50000006f, -0.50000006f,
+    -0.522498667f, -0.522498667f, -0.544639051f, -0.544639051f, -0.56640631f, -0.56640631f,
+    -0.587785184f, -0.587785184f, -0.60876143f, -0.60876143f, -0.629320323f, -0.629320323f,
+    -0.649448216f, -0.649448216f, -0.669130683f, -0.669130683f, -0.688354671f, -0.688354671f,
+    -0.707106769f, -0.707106769f, -0.72537446f, -0.72537446f, -0.74314481f, -0.74314481f,
+    -0.760406017f, -0.760406017f, -0.777146041f, -0.777146041f, -0.793353498f, -0.793353498f,
+    -0.809017062f, -0.809017062f, -0.824126303f, -0.824126303f, -0.838670552f, -0.838670552f,
+    -0.852640212f, -0.852640212f, -0.866025388f, -0.866025388f, -0.878817141f, -0.878817141f,
+    -0.891006589f, -0.891006589f, -0.902585387f, -0.902585387f, -0.913545489f, -0.913545489f,
+    -0.923879623f, -0.923879623f, -0.933580458f, -0.933580458f, -0.942641556f, -0.942641556f,
+    -0.95105648f, -0.95105648f, -0.958819747f, -0.958819747f, -0.965925872f, -0.965925872f,
+    -0.972369969f, -0.972369969f, -0.978147626f, -0.978147626f, -0.98325491f, -0.98325491f,
+    -0.987688363f, -0.987688363f, -0.991444886f, -0.991444886f, -0.994521916f, -0.994521916f,
+    -0.996917367f, -0.996917367f, -0.99862957f, -0.99862957f, -0.999657333f, -0.999657333f,
+    -1.0f, -1.0f, -0.999657333f, -0.999657333f, -0.99862951f, -0.99862951f,
+    -0.996917307f, -0.996917307f, -0.994521916f, -0.994521916f, -0.991444826f, -0.991444826f,
+    -0.987688363f, -0.987688363f, -0.98325491f, -0.98325491f, -0.978147507f, -0.978147507f,
+    -0.97236985f, -0.97236985f, -0.965925753f, -0.965925753f, -0.958819687f, -0.958819687f,
+    -0.951056421f, -0.951056421f, -0.942641497f, -0.942641497f, -0.933580399f, -0.933580399f,
+    -0.923879504f, -0.923879504f, -0.91354543f, -0.91354543f, -0.902585328f, -0.902585328f,
+    -0.891006529f, -0.891006529f, -0.878817141f, -0.878817141f, -0.866025388f, -0.866025388f,
+    -0.852640271f, -0.852640271f, -0.838670611f, -0.838670611f, -0.824126065f, -0.824126065f,
+    -0.809016764f, -0.809016764f, -0.7933532f, -0.7933532f, -0.777145803f, -0.777145803f,
+    -0.760405898f, -0.760405898f, -0.743144691f, -0.743144691f, -0.725374341f, -0.725374341f,
+    -0.70710665f, -0.70710665f, -0.688354552f, -0.688354552f, -0.669130504f, -0.669130504f,
+    -0.649447918f, -0.649447918f, -0.629320323f, -0.629320323f, -0.608761489f, -0.608761489f,
+    -0.587785423f, -0.587785423f, -0.56640619f, -0.56640619f, -0.544638693f, -0.544638693f,
+    -0.52249831f, -0.52249831f, -0.499999911f, -0.499999911f, -0.477158368f, -0.477158368f,
+    -0.453990221f, -0.453990221f, -0.430510968f, -0.430510968f, -0.406736642f, -0.406736642f,
+    -0.382683128f, -0.382683128f, -0.358367771f, -0.358367771f, -0.333806843f, -0.333806843f,
+    -0.309017092f, -0.309017092f, -0.284015149f, -0.284015149f, -0.258818984f, -0.258818984f,
+    -0.233445451f, -0.233445451f, -0.207911924f, -0.207911924f, -0.182235435f, -0.182235435f,
+    -0.156434044f, -0.156434044f, -0.130525917f, -0.130525917f, -0.104528338f, -0.104528338f,
+    -0.0784591138f, -0.0784591138f, -0.0523356497f, -0.0523356497f, -0.0261767879f, -0.0261767879f,
+    1.19248806e-08f, 1.19248806e-08f, 0.026177289f, 0.026177289f, 0.0523361489f, 0.0523361489f,
+    0.0784591362f, 0.0784591362f, 0.10452836f, 0.10452836f, 0.130526409f, 0.130526409f,
+    0.156434536f, 0.156434536f, 0.18223545f, 0.18223545f, 0.207911938f, 0.207911938f,
+    0.233445466f, 0.233445466f, 0.258819461f, 0.258819461f, 0.284015626f, 0.284015626f,
+    -0.0f, -0.0f, -0.0261769518f, -0.0261769518f, -0.0523359627f, -0.0523359627f,
+    -0.0784590989f, -0.0784590989f, -0.104528472f, -0.104528472f, -0.1305262f, -0.1305262f,
+    -0.156434476f, -0.156434476f, -0.182235524f, -0.182235524f, -0.207911715f, -0.207911715f,
+    -0.233445391f, -0.233445391f, -0.258819044f, -0.258819044f, -0.284015357f, -0.284015357f,
+    -0.309017003f, -0.309017003f, -0.333806872f, -0.333806872f, -0.35836795f, -0.35836795f,
+    -0.382683456f, -0.382683456f, -0.406736672f, -0.406736672f, -0.430511117f, -0.430511117f,
+    -0.453990549f, -0.453990549f, -0.477158785f, -0.477158785f, -0.5f, -0.5f,
+    -0.522498548f, -0.522498548f, -0.544639051f, -0.544639051f, -0.56640625f, -0.56640625f,
+    -0.587785244f, -0.587785244f, -0.60876143f, -0.60876143f, -0.629320383f, -0.629320383f,
+    -0.649448037f, -0.649448037f, -0.669130623f, -0.669130623f, -0.688354552f, -0.688354552f,
+    -0.707106769f, -0.707106769f, -0.725374341f, -0.725374341f, -0.74314487f, -0.74314487f,
+    -0.760406017f, -0.760406017f, -0.777145982f, -0.777145982f, -0.793353319f, -0.793353319f,
+    -0.809017062f, -0.809017062f, -0.824126244f, -0.824126244f, -0.838670611f, -0.838670611f,
+    -0.852640152f, -0.852640152f, -0.866025448f, -0.866025448f, -0.878817141f, -0.878817141f,
+    -0.891006529f, -0.891006529f, -0.902585268f, -0.902585268f, -0.913545489f, -0.913545489f,
+    -0.923879504f, -0.923879504f, -0.933580399f, -0.933580399f, -0.942641497f, -0.942641497f,
+    -0.95105654f, -0.95105654f, -0.958819747f, -0.958819747f, -0.965925813f, -0.965925813f,
+    -0.972369909f, -0.972369909f, -0.978147626f, -0.978147626f, -0.98325491f, -0.98325491f,
+    -0.987688363f, -0.987688363f, -0.991444886f, -0.991444886f, -0.994521916f, -0.994521916f,
+    -0.996917307f, -0.996917307f, -0.99862951f, -0.99862951f, -0.999657333f, -0.999657333f,
+    -1.0f, -1.0f, -0.999657333f, -0.999657333f, -0.99862951f, -0.99862951f,
+    -0.996917307f, -0.996917307f, -0.994521856f, -0.994521856f, -0.991444826f, -0.991444826f,
+    -0.987688303f, -0.987688303f, -0.98325491f, -0.98325491f, -0.978147566f, -0.978147566f,
+    -0.972369909f, -0.972369909f, -0.965925813f, -0.965925813f, -0.958819747f, -0.958819747f,
+    -0.95105648f, -0.95105648f, -0.942641437f, -0.942641437f, -0.933580399f, -0.933580399f,
+    -0.923879504f, -0.923879504f, -0.91354543f, -0.91354543f, -0.902585268f, -0.902585268f,
+    -0.891006589f, -0.891006589f, -0.878817022f, -0.878817022f, -0.866025388f, -0.866025388f,
+    -0.852640092f, -0.852640092f, -0.838670552f, -0.838670552f, -0.824126124f, -0.824126124f,
+    -0.809017003f, -0.809017003f, -0.793353319f, -0.793353319f, -0.777146041f, -0.777146041f,
+    -0.760405838f, -0.760405838f, -0.74314481f, -0.74314481f, -0.725374281f, -0.725374281f,
+    -0.707106769f, -0.707106769f, -0.688354492f, -0.688354492f, -0.669130623f, -0.669130623f,
+    -0.649448037f, -0.649448037f, -0.629320264f, -0.629320264f, -0.608761251f, -0.608761251f,
+    -0.587785184f, -0.587785184f, -0.566406131f, -0.566406131f, -0.544639051f, -0.544639051f,
+    -0.522498488f, -0.522498488f, -0.50000006f, -0.50000006f, -0.477158725f, -0.477158725f,
+    -0.45399037f, -0.45399037f, -0.430510908f, -0.430510908f, -0.406736583f, -0.406736583f,
+    -0.382683277f, -0.382683277f, -0.35836792f, -0.35836792f, -0.333806753f, -0.333806753f,
+    -0.309017032f, -0.309017032f, -0.284015298f, -0.284015298f, -0.258818924f, -0.258818924f,
+    -0.233445138f, -0.233445138f, -0.207911611f, -0.207911611f, -0.18223536f, -0.18223536f,
+    -0.156434447f, -0.156434447f, -0.130526081f, -0.130526081f, -0.104528494f, -0.104528494f,
+    -0.0784590393f, -0.0784590393f, -0.0523358099f, -0.0523358099f, -0.0261769518f, -0.0261769518f,
+    8.74227766e-08f, 8.74227766e-08f, 0.0261771251f, 0.0261771251f, 0.052335985f, 0.052335985f,
+    0.0784592181f, 0.0784592181f, 0.104528435f, 0.104528435f, 0.13052626f, 0.13052626f,
+    0.156434372f, 0.156434372f, 0.182235524f, 0.182235524f, 0.207912013f, 0.207912013f,
+    0.23344554f, 0.23344554f, 0.258819312f, 0.258819312f, 0.284015477f, 0.284015477f,
+    0.309017211f, 0.309017211f, 0.333806932f, 0.333806932f, 0.358368099f, 0.358368099f,
+    0.382683426f, 0.382683426f, 0.406736732f, 0.406736732f, 0.430511057f, 0.430511057f,
+    0.453990549f, 0.453990549f, 0.477158666f, 0.477158666f, 0.49999997f, 0.49999997f,
+    0.522498429f, 0.522498429f, 0.544638991f, 0.544638991f, 0.566406429f, 0.566406429f,
+    0.587785542f, 0.587785542f, 0.608761609f, 0.608761609f, 0.629320621f, 0.629320621f,
+    0.649448156f, 0.649448156f, 0.669130802f, 0.669130802f, 0.688354611f, 0.688354611f,
+    0.707106888f, 0.707106888f, 0.725374401f, 0.725374401f, 0.74314487f, 0.74314487f,
+    0.760406077f, 0.760406077f, 0.777145982f, 0.777145982f, 0.79335326f, 0.79335326f,
+    0.809016824f, 0.809016824f, 0.824126244f, 0.824126244f, 0.83867079f, 0.83867079f,
+    0.852640331f, 0.852640331f, 0.866025448f, 0.866025448f, 0.87881732f, 0.87881732f,
+    0.891006649f, 0.891006649f, 0.902585328f, 0.902585328f, 0.91354543f, 0.91354543f,
+    0.923879683f, 0.923879683f, 0.933580518f, 0.933580518f, 0.942641497f, 0.942641497f,
+    0.95105648f, 0.95105648f, 0.958819807f, 0.958819807f, 0.965925872f, 0.965925872f,
+    0.972369909f, 0.972369909f, 0.978147566f, 0.978147566f, 0.98325491f, 0.98325491f,
+    0.987688422f, 0.987688422f, 0.991444886f, 0.991444886f, 0.994521916f, 0.994521916f,
+    0.996917307f, 0.996917307f, 0.99862957f, 0.99862957f, 0.999657333f, 0.999657333f,
+    1.0f, 1.0f, 0.999657333f, 0.999657333f, 0.99862951f, 0.99862951f,
+    0.996917307f, 0.996917307f, 0.994521916f, 0.994521916f, 0.991444826f, 0.991444826f,
+    0.987688303f, 0.987688303f, 0.98325491f, 0.98325491f, 0.978147566f, 0.978147566f,
+    0.972369909f, 0.972369909f, 0.965925694f, 0.965925694f, 0.958819628f, 0.958819628f,
+    1.0f, 1.0f, 0.999464571f, 0.999464571f, 0.997858942f, 0.997858942f,
+    0.99518472f, 0.99518472f, 0.991444886f, 0.991444886f, 0.986643314f, 0.986643314f,
+    0.980785251f, 0.980785251f, 0.973876953f, 0.973876953f, 0.965925813f, 0.965925813f,
+    0.956940353f, 0.956940353f, 0.94693011f, 0.94693011f, 0.935905933f, 0.935905933f,
+    0.923879504f, 0.923879504f, 0.910863817f, 0.910863817f, 0.896872759f, 0.896872759f,
+    0.881921232f, 0.881921232f, 0.866025388f, 0.866025388f, 0.849202156f, 0.849202156f,
+    0.831469595f, 0.831469595f, 0.812846661f, 0.812846661f, 0.793353319f, 0.793353319f,
+    0.773010433f, 0.773010433f, 0.751839757f, 0.751839757f, 0.729864061f, 0.729864061f,
+    0.707106769f, 0.707106769f, 0.683592319f, 0.683592319f, 0.659345746f, 0.659345746f,
+    0.634393275f, 0.634393275f, 0.60876143f, 0.60876143f, 0.582477629f, 0.582477629f,
+    0.555570185f, 0.555570185f, 0.528067887f, 0.528067887f, 0.49999997f, 0.49999997f,
+    0.471396655f, 0.471396655f, 0.442288667f, 0.442288667f, 0.412706971f, 0.412706971f,
+    0.382683426f, 0.382683426f, 0.35225001f, 0.35225001f, 0.321439356f, 0.321439356f,
+    0.290284634f, 0.290284634f, 0.258819073f, 0.258819073f, 0.227076232f, 0.227076232f,
+    0.195090234f, 0.195090234f, 0.162895456f, 0.162895456f, 0.130526125f, 0.130526125f,
+    0.0980171338f, 0.0980171338f, 0.065403074f, 0.065403074f, 0.0327189714f, 0.0327189714f,
+    -4.37113883e-08f, -4.37113883e-08f, -0.03271918f, -0.03271918f, -0.0654031634f, -0.0654031634f,
+    -0.0980172232f, -0.0980172232f, -0.130526334f, -0.130526334f, -0.162895426f, -0.162895426f,
+    -0.195090324f, -0.195090324f, -0.227076322f, -0.227076322f, -0.258819044f, -0.258819044f,
+    -0.290284723f, -0.290284723f, -0.321439564f, -0.321439564f, -0.352250069f, -0.352250069f,
+    -0.382683516f, -0.382683516f, -0.41270715f, -0.41270715f, -0.442288637f, -0.442288637f,
+    -0.471396834f, -0.471396834f, -0.0f, -0.0f, -0.0327190831f, -0.0327190831f,
+    -0.0654031336f, -0.0654031336f, -0.0980171412f, -0.0980171412f, -0.1305262f, -0.1305262f,
+    -0.162895471f, -0.162895471f, -0.195090324f, -0.195090324f, -0.227076262f, -0.227076262f,
+    -0.258819044f, -0.258819044f, -0.290284693f, -0.290284693f, -0.321439475f, -0.321439475f,
+    -0.352250069f, -0.352250069f, -0.382683456f, -0.382683456f, -0.412707061f, -0.412707061f,
+    -0.442288697f, -0.442288697f, -0.471396744f, -0.471396744f, -0.5f, -0.5f,
+    -0.528067827f, -0.528067827f, -0.555570245f, -0.555570245f, -0.582477748f, -0.582477748f,
+    -0.60876143f, -0.60876143f, -0.634393334f, -0.634393334f, -0.659345865f, -0.659345865f,
+    -0.683592319f, -0.683592319f, -0.707106769f, -0.707106769f, -0.729864061f, -0.729864061f,
+    -0.751839876f, -0.751839876f, -0.773010433f, -0.773010433f, -0.793353319f, -0.793353319f,
+    -0.81284672f, -0.81284672f, -0.831469655f, -0.831469655f, -0.849202156f, -0.849202156f,
+    -0.866025448f, -0.866025448f, -0.881921291f, -0.881921291f, -0.896872759f, -0.896872759f,
+    -0.910863876f, -0.910863876f, -0.923879504f, -0.923879504f, -0.935905933f, -0.935905933f,
+    -0.94693017f, -0.94693017f, -0.956940353f, -0.956940353f, -0.965925813f, -0.965925813f,
+    -0.973877013f, -0.973877013f, -0.98078531f, -0.98078531f, -0.986643314f, -0.986643314f,
+    -0.991444886f, -0.991444886f, -0.99518472f, -0.99518472f, -0.997858942f, -0.997858942f,
+    -0.999464571f, -0.999464571f, -1.0f, -1.0f, -0.999464571f, -0.999464571f,
+    -0.997858942f, -0.997858942f, -0.99518472f, -0.99518472f, -0.991444826f, -0.991444826f,
+    -0.986643314f, -0.986643314f, -0.980785251f, -0.980785251f, -0.973876953f, -0.973876953f,
+    -0.965925813f, -0.965925813f, -0.956940293f, -0.956940293f, -0.94693011f, -0.94693011f,
+    -0.935905933f, -0.935905933f, -0.923879504f, -0.923879504f, -0.910863757f, -0.910863757f,
+    -0.896872759f, -0.896872759f, -0.881921232f, -0.881921232f, 1.0f, 1.0f,
+    0.997858942f, 0.997858942f, 0.991444886f, 0.991444886f, 0.980785251f, 0.980785251f,
+    0.965925813f, 0.965925813f, 0.94693011f, 0.94693011f, 0.923879504f, 0.923879504f,
+    0.896872759f, 0.896872759f, 0.866025388f, 0.866025388f, 0.831469595f, 0.831469595f,
+    0.793353319f, 0.793353319f, 0.751839757f, 0.751839757f, 0.707106769f, 0.707106769f,
+    0.659345746f, 0.659345746f, 0.60876143f, 0.60876143f, 0.555570185f, 0.555570185f,
+    0.49999997f, 0.49999997f, 0.442288667f, 0.442288667f, 0.382683426f, 0.382683426f,
+    0.321439356f, 0.321439356f, 0.258819073f, 0.258819073f, 0.195090234f, 0.195090234f,
+    0.130526125f, 0.130526125f, 0.065403074f, 0.065403074f, -4.37113883e-08f, -4.37113883e-08f,
+    -0.0654031634f, -0.0654031634f, -0.130526334f, -0.130526334f, -0.195090324f, -0.195090324f,
+    -0.258819044f, -0.258819044f, -0.321439564f, -0.321439564f, -0.382683516f, -0.382683516f,
+    -0.442288637f, -0.442288637f, -0.50000006f, -0.50000006f, -0.555570364f, -0.555570364f,
+    -0.60876143f, -0.60876143f, -0.659345925f, -0.659345925f, -0.707106769f, -0.707106769f,
+    -0.751839876f, -0.751839876f, -0.793353498f, -0.793353498f, -0.831469655f, -0.831469655f,
+    -0.866025388f, -0.866025388f, -0.896872759f, -0.896872759f, -0.923879623f, -0.923879623f,
+    -0.94693017f, -0.94693017f, -0.965925872f, -0.965925872f, -0.98078531f, -0.98078531f,
+    -0.991444886f, -0.991444886f, -0.997858942f, -0.997858942f, -1.0f, -1.0f,
+    -0.997858882f, -0.997858882f, -0.991444826f, -0.991444826f, -0.980785251f, -0.980785251f,
+    -0.965925753f, -0.965925753f, -0.94693017f, -0.94693017f, -0.923879504f, -0.923879504f,
+    -0.896872699f, -0.896872699f, -0.866025388f, -0.866025388f, -0.831469536f, -0.831469536f,
+    -0.7933532f, -0.7933532f, -0.751839757f, -0.751839757f, -0.70710665f, -0.70710665f,
+    -0.659345627f, -0.659345627f, -0.608761489f, -0.608761489f, -0.555570006f, -0.555570006f,
+    -0.0f, -0.0f, -0.0654031336f, -0.0654031336f, -0.1305262f, -0.1305262f,
+    -0.195090324f, -0.195090324f, -0.258819044f, -0.258819044f, -0.321439475f, -0.321439475f,
+    -0.382683456f, -0.382683456f, -0.442288697f, -0.442288697f, -0.5f, -0.5f,
+    -0.555570245f, -0.555570245f, -0.60876143f, -0.60876143f, -0.659345865f, -0.659345865f,
+    -0.707106769f, -0.707106769f, -0.751839876f, -0.751839876f, -0.793353319f, -0.793353319f,
+    -0.831469655f, -0.831469655f, -0.866025448f, -0.866025448f, -0.896872759f, -0.896872759f,
+    -0.923879504f, -0.923879504f, -0.94693017f, -0.94693017f, -0.965925813f, -0.965925813f,
+    -0.98078531f, -0.98078531f, -0.991444886f, -0.991444886f, -0.997858942f, -0.997858942f,
+    -1.0f, -1.0f, -0.997858942f, -0.997858942f, -0.991444826f, -0.991444826f,
+    -0.980785251f, -0.980785251f, -0.965925813f, -0.965925813f, -0.94693011f, -0.94693011f,
+    -0.923879504f, -0.923879504f, -0.896872759f, -0.896872759f, -0.866025388f, -0.866025388f,
+    -0.831469536f, -0.831469536f, -0.793353319f, -0.793353319f, -0.751839697f, -0.751839697f,
+    -0.707106769f, -0.707106769f, -0.659345746f, -0.659345746f, -0.608761251f, -0.608761251f,
+    -0.555570185f, -0.555570185f, -0.50000006f, -0.50000006f, -0.442288637f, -0.442288637f,
+    -0.382683277f, -0.382683277f, -0.321439445f, -0.321439445f, -0.258818924f, -0.258818924f,
+    -0.195090309f, -0.195090309f, -0.130526081f, -0.130526081f, -0.0654029101f, -0.0654029101f,
+    8.74227766e-08f, 8.74227766e-08f, 0.0654033199f, 0.0654033199f, 0.13052626f, 0.13052626f,
+    0.195090488f, 0.195090488f, 0.258819312f, 0.258819312f, 0.321439385f, 0.321439385f,
+    0.382683426f, 0.382683426f, 0.442288786f, 0.442288786f, 0.49999997f, 0.49999997f,
+    0.555570304f, 0.555570304f, 0.608761609f, 0.608761609f, 0.659345865f, 0.659345865f,
+    0.707106888f, 0.707106888f, 0.751839995f, 0.751839995f, 0.79335326f, 0.79335326f,
+    0.831469774f, 0.831469774f, 1.0f, 1.0f, 0.99518472f, 0.99518472f,
+    0.980785251f, 0.980785251f, 0.956940353f, 0.956940353f, 0.923879504f, 0.923879504f,
+    0.881921232f, 0.881921232f, 0.831469595f, 0.831469595f, 0.773010433f, 0.773010433f,
+    0.707106769f, 0.707106769f, 0.634393275f, 0.634393275f, 0.555570185f, 0.555570185f,
+    0.471396655f, 0.471396655f, 0.382683426f, 0.382683426f, 0.290284634f, 0.290284634f,
+    0.195090234f, 0.195090234f, 0.0980171338f, 0.0980171338f, -0.0f, -0.0f,
+    -0.0980171412f, -0.0980171412f, -0.195090324f, -0.195090324f, -0.290284693f, -0.290284693f,
+    -0.382683456f, -0.382683456f, -0.471396744f, -0.471396744f, -0.555570245f, -0.555570245f,
+    -0.634393334f, -0.634393334f, -0.707106769f, -0.707106769f, -0.773010433f, -0.773010433f,
+    -0.831469655f, -0.831469655f, -0.881921291f, -0.881921291f, -0.923879504f, -0.923879504f,
+    -0.956940353f, -0.956940353f, -0.98078531f, -0.98078531f, -0.99518472f, -0.99518472f,
+    1.0f, 1.0f, 0.980785251f, 0.980785251f, 0.923879504f, 0.923879504f,
+    0.831469595f, 0.831469595f, 0.707106769f, 0.707106769f, 0.555570185f, 0.555570185f,
+    0.382683426f, 0.382683426f, 0.195090234f, 0.195090234f, -4.37113883e-08f, -4.37113883e-08f,
+    -0.195090324f, -0.195090324f, -0.382683516f, -0.382683516f, -0.555570364f, -0.555570364f,
+    -0.707106769f, -0.707106769f, -0.831469655f, -0.831469655f, -0.923879623f, -0.923879623f,
+    -0.98078531f, -0.98078531f, -0.0f, -0.0f, -0.195090324f, -0.195090324f,
+    -0.382683456f, -0.382683456f, -0.555570245f, -0.555570245f, -0.707106769f, -0.707106769f,
+    -0.831469655f, -0.831469655f, -0.923879504f, -0.923879504f, -0.98078531f, -0.98078531f,
+    -1.0f, -1.0f, -0.980785251f, -0.980785251f, -0.923879504f, -0.923879504f,
+    -0.831469536f, -0.831469536f, -0.707106769f, -0.707106769f, -0.555570185f, -0.555570185f,
+    -0.382683277f, -0.382683277f, -0.195090309f, -0.195090309f, 1.0f, 1.0f,
+    0.956940353f, 0.956940353f, 0.831469595f, 0.831469595f, 0.634393275f, 0.634393275f,
+    0.382683426f, 0.382683426f, 0.0980171338f, 0.0980171338f, -0.195090324f, -0.195090324f,
+    -0.471396834f, -0.471396834f, -0.707106769f, -0.707106769f, -0.881921351f, -0.881921351f,
+    -0.98078531f, -0.98078531f, -0.99518472f, -0.99518472f, -0.923879504f, -0.923879504f,
+    -0.773010373f, -0.773010373f, -0.555570006f, -0.555570006f, -0.290284544f, -0.290284544f,
+    -0.0f, -0.0f, -0.290284693f, -0.290284693f, -0.555570245f, -0.555570245f,
+    -0.773010433f, -0.773010433f, -0.923879504f, -0.923879504f, -0.99518472f, -0.99518472f,
+    -0.980785251f, -0.980785251f, -0.881921232f, -0.881921232f, -0.707106769f, -0.707106769f,
+    -0.471396625f, -0.471396625f, -0.195090309f, -0.195090309f, 0.0980172679f, 0.0980172679f,
+    0.382683426f, 0.382683426f, 0.634393394f, 0.634393394f, 0.831469774f, 0.831469774f,
+    0.956940353f, 0.956940353f, 1.0f, 1.0f, 0.923879504f, 0.923879504f,
+    0.707106769f, 0.707106769f, 0.382683426f, 0.382683426f, -0.0f, -0.0f,
+    -0.382683456f, -0.382683456f, -0.707106769f, -0.707106769f, -0.923879504f, -0.923879504f,
+    1.0f, 1.0f, 0.707106769f, 0.707106769f, -4.37113883e-08f, -4.37113883e-08f,
+    -0.707106769f, -0.707106769f, -0.0f, -0.0f, -0.707106769f, -0.707106769f,
+    -1.0f, -1.0f, -0.707106769f, -0.707106769f, 1.0f, 1.0f,
+    0.382683426f, 0.382683426f, -0.707106769f, -0.707106769f, -0.923879504f, -0.923879504f,
+    -0.0f, -0.0f, -0.923879504f, -0.923879504f, -0.707106769f, -0.707106769f,
+    0.382683426f, 0.382683426f,
+};
+
+static const float fft_split480[1888] = {
+    1.0f, 1.0f, 0.999914348f, 0.999914348f, 0.999657333f, 0.999657333f,
+    0.999229014f, 0.999229014f, 0.99862951f, 0.99862951f, 0.997858942f, 0.997858942f,
+    0.996917307f, 0.996917307f, 0.995804906f, 0.995804906f, 0.994521916f, 0.994521916f,
+    0.993068457f, 0.993068457f, 0.991444886f, 0.991444886f, 0.989651382f, 0.989651382f,
+    0.987688363f, 0.987688363f, 0.985556066f, 0.985556066f, 0.98325491f, 0.98325491f,
+    0.980785251f, 0.980785251f, 0.978147626f, 0.978147626f, 0.975342333f, 0.975342333f,
+    0.972369909f, 0.972369909f, 0.96923089f, 0.96923089f, 0.965925813f, 0.965925813f,
+    0.962455213f, 0.962455213f, 0.958819747f, 0.958819747f, 0.955019951f, 0.955019951f,
+    0.95105654f, 0.95105654f, 0.94693011f, 0.94693011f, 0.942641497f, 0.942641497f,
+    0.938191354f, 0.938191354f, 0.933580399f, 0.933580399f, 0.928809583f, 0.928809583f,
+    0.923879504f, 0.923879504f, 0.918791234f, 0.918791234f, 0.91354543f, 0.91354543f,
+    0.908143163f, 0.908143163f, 0.902585268f, 0.902585268f, 0.896872759f, 0.896872759f,
+    0.891006529f, 0.891006529f, 0.884987652f, 0.884987652f, 0.878817081f, 0.878817081f,
+    0.872496009f, 0.872496009f, 0.866025388f, 0.866025388f, 0.859406412f, 0.859406412f,
+    0.852640152f, 0.852640152f, 0.845727861f, 0.845727861f, 0.838670552f, 0.838670552f,
+    0.831469595f, 0.831469595f, 0.824126184f, 0.824126184f, 0.81664151f, 0.81664151f,
+    0.809017003f, 0.809017003f, 0.801253796f, 0.801253796f, 0.793353319f, 0.793353319f,
+    0.785316885f, 0.785316885f, 0.777145922f, 0.777145922f, 0.768841803f, 0.768841803f,
+    0.760405958f, 0.760405958f, 0.751839757f, 0.751839757f, 0.74314481f, 0.74314481f,
+    0.734322488f, 0.734322488f, 0.725374401f, 0.725374401f, 0.716301918f, 0.716301918f,
+    0.707106769f, 0.707106769f, 0.697790444f, 0.697790444f, 0.688354611f, 0.688354611f,
+    0.678800762f, 0.678800762f, 0.669130564f, 0.669130564f, 0.659345746f, 0.659345746f,
+    0.649448037f, 0.649448037f, 0.639438987f, 0.639438987f, 0.629320383f, 0.629320383f,
+    0.619093955f, 0.619093955f, 0.60876143f, 0.60876143f, 0.598324597f, 0.598324597f,
+    0.587785184f, 0.587785184f, 0.577145159f, 0.577145159f, 0.56640619f, 0.56640619f,
+    0.555570185f, 0.555570185f, 0.544638991f, 0.544638991f, 0.533614516f, 0.533614516f,
+    0.522498608f, 0.522498608f, 0.511292994f, 0.511292994f, 0.49999997f, 0.49999997f,
+    0.488621175f, 0.488621175f, 0.477158755f, 0.477158755f, 0.465614468f, 0.465614468f,
+    0.453990519f, 0.453990519f, 0.442288667f, 0.442288667f, 0.430511147f, 0.430511147f,
+    0.418659627f, 0.418659627f, 0.406736612f, 0.406736612f, 0.3947438f, 0.3947438f,
+    0.382683426f, 0.382683426f, 0.370557398f, 0.370557398f, 0.35836798f, 0.35836798f,
+    0.346117049f, 0.346117049f, 0.333806813f, 0.333806813f, 0.321439356f, 0.321439356f,
+    -0.0f, -0.0f, -0.0130895972f, -0.0130895972f, -0.0261769518f, -0.0261769518f,
+    -0.0392598175f, -0.0392598175f, -0.0523359627f, -0.0523359627f, -0.0654031336f, -0.0654031336f,
+    -0.0784590989f, -0.0784590989f, -0.0915016234f, -0.0915016234f, -0.104528472f, -0.104528472f,
+    -0.117537409f, -0.117537409f, -0.1305262f, -0.1305262f, -0.143492624f, -0.143492624f,
+    -0.156434476f, -0.156434476f, -0.169349506f, -0.169349506f, -0.182235524f, -0.182235524f,
+    -0.195090324f, -0.195090324f, -0.207911715f, -0.207911715f, -0.220697448f, -0.220697448f,
+    -0.233445391f, -0.233445391f, -0.246153295f, -0.246153295f, -0.258819044f, -0.258819044f,
+    -0.271440446f, -0.271440446f, -0.284015357f, -0.284015357f, -0.296541572f, -0.296541572f,
+    -0.309017003f, -0.309017003f, -0.321439475f, -0.321439475f, -0.333806872f, -0.333806872f,
+    -0.346117049f, -0.346117049f, -0.35836795f, -0.35836795f, -0.370557427f, -0.370557427f,
+    -0.382683456f, -0.382683456f, -0.39474386f, -0.39474386f, -0.406736672f, -0.406736672f,
+    -0.418659776f, -0.418659776f, -0.430511117f, -0.430511117f, -0.442288697f, -0.442288697f,
+    -0.453990549f, -0.453990549f, -0.465614557f, -0.465614557f, -0.477158785f, -0.477158785f,
+    -0.488621205f, -0.488621205f, -0.5f, -0.5f, -0.511293113f, -0.511293113f,
+    -0.522498548f, -0.522498548f, -0.533614516f, -0.533614516f, -0.544639051f, -0.544639051f,
+    -0.555570245f, -0.555570245f, -0.56640625f, -0.56640625f, -0.577145219f, -0.577145219f,
+    -0.587785244f, -0.587785244f, -0.598324597f, -0.598324597f, -0.60876143f, -0.60876143f,
+    -0.619093955f, -0.619093955f, -0.629320383f, -0.629320383f, -0.639438987f, -0.639438987f,
+    -0.649448037f, -0.649448037f, -0.659345865f, -0.659345865f, -0.669130623f, -0.669130623f,
+    -0.678800762f, -0.678800762f, -0.688354552f, -0.688354552f, -0.697790504f, -0.697790504f,
+    -0.707106769f, -0.707106769f, -0.716301978f, -0.716301978f, -0.725374341f, -0.725374341f,
+    -0.734322488f, -0.734322488f, -0.74314487f, -0.74314487f, -0.751839876f, -0.751839876f,
+    -0.760406017f, -0.760406017f, -0.768841863f, -0.768841863f, -0.777145982f, -0.777145982f,
+    -0.785316944f, -0.785316944f, -0.793353319f, -0.793353319f, -0.801253796f, -0.801253796f,
+    -0.809017062f, -0.809017062f, -0.816641569f, -0.816641569f, -0.824126244f, -0.824126244f,
+    -0.831469655f, -0.831469655f, -0.838670611f, -0.838670611f, -0.845727801f, -0.845727801f,
+    -0.852640152f, -0.852640152f, -0.859406471f, -0.859406471f, -0.866025448f, -0.866025448f,
+    -0.872496068f, -0.872496068f, -0.878817141f, -0.878817141f, -0.884987652f, -0.884987652f,
+    -0.891006529f, -0.891006529f, -0.896872759f, -0.896872759f, -0.902585268f, -0.902585268f,
+    -0.908143222f, -0.908143222f, -0.913545489f, -0.913545489f, -0.918791234f, -0.918791234f,
+    -0.923879504f, -0.923879504f, -0.928809583f, -0.928809583f, -0.933580399f, -0.933580399f,
+    -0.938191354f, -0.938191354f, -0.942641497f, -0.942641497f, -0.94693017f, -0.94693017f,
+    1.0f, 1.0f, 0.999657333f, 0.999657333f, 0.99862951f, 0.99862951f,
+    0.996917307f, 0.996917307f, 0.994521916f, 0.994521916f, 0.991444886f, 0.991444886f,
+    0.987688363f, 0.987688363f, 0.98325491f, 0.98325491f, 0.978147626f, 0.978147626f,
+    0.972369909f, 0.972369909f, 0.965925813f, 0.965925813f, 0.958819747f, 0.958819747f,
+    0.95105654f, 0.95105654f, 0.942641497f, 0.942641497f, 0.933580399f, 0.933580399f,
+    0.923879504f, 0.923879504f, 0.91354543f, 0.91354543f, 0.902585268f, 0.902585268f,
+    0.891006529f, 0.891006529f, 0.878817081f, 0.878817081f, 0.866025388f, 0.866025388f,
+    0.852640152f, 0.852640152f, 0.838670552f, 0.838670552f, 0.824126184f, 0.824126184f,
+    0.809017003f, 0.809017003f, 0.793353319f, 0.793353319f, 0.777145922f, 0.777145922f,
+    0.760405958f, 0.760405958f, 0.74314481f, 0.74314481f, 0.725374401f, 0.725374401f,
+    0.707106769f, 0.707106769f, 0.688354611f, 0.688354611f, 0.669130564f, 0.669130564f,
+    0.649448037f, 0.649448037f, 0.629320383f, 0.629320383f, 0.60876143f, 0.60876143f,
+    0.587785184f, 0.587785184f, 0.56640619f, 0.56640619f, 0.544638991f, 0.544638991f,
+    0.522498608f, 0.522498608f, 0.49999997f, 0.49999997f, 0.477158755f, 0.477158755f,
+    0.453990519f, 0.453990519f, 0.430511147f, 0.430511147f, 0.406736612f, 0.406736612f,
+    0.382683426f, 0.382683426f, 0.35836798f, 0.35836798f, 0.333806813f, 0.333806813f,
+    0.309016973f, 0.309016973f, 0.284015328f, 0.284015328f, 0.258819073f, 0.258819073f,
+    0.233445302f, 0.233445302f, 0.207911655f, 0.207911655f, 0.182235524f, 0.182235524f,
+    0.156434491f, 0.156434491f, 0.130526125f, 0.130526125f, 0.10452842f, 0.10452842f,
+    0.078459084f, 0.078459084f, 0.0523359738f, 0.0523359738f, 0.0261768755f, 0.0261768755f,
+    -4.37113883e-08f, -4.37113883e-08f, -0.026176963f, -0.026176963f, -0.0523359403f, -0.0523359403f,
+    -0.0784590542f, -0.0784590542f, -0.104528628f, -0.104528628f, -0.130526334f, -0.130526334f,
+    -0.156434566f, -0.156434566f, -0.182235599f, -0.182235599f, -0.207911745f, -0.207911745f,
+    -0.233445391f, -0.233445391f, -0.258819044f, -0.258819044f, -0.284015298f, -0.284015298f,
+    -0.309017152f, -0.309017152f, -0.333806992f, -0.333806992f, -0.358368069f, -0.358368069f,
+    -0.382683516f, -0.382683516f, -0.406736702f, -0.406736702f, -0.430511117f, -0.430511117f,
+    -0.4539904f, -0.4539904f, -0.477158934f, -0.477158934f, -0.50000006f, -0.50000006f,
+    -0.522498667f, -0.522498667f, -0.544639051f, -0.544639051f, -0.56640631f, -0.56640631f,
+    -0.587785184f, -0.587785184f, -0.60876143f, -0.60876143f, -0.629320323f, -0.629320323f,
+    -0.649448216f, -0.649448216f, -0.669130683f, -0.669130683f, -0.688354671f, -0.688354671f,
+    -0.707106769f, -0.707106769f, -0.72537446f, -0.72537446f, -0.74314481f, -0.74314481f,
+    -0.760406017f, -0.760406017f, -0.777146041f, -0.777146041f, -0.793353498f, -0.793353498f,
+    -0.0f, -0.0f, -0.0261769518f, -0.0261769518f, -0.0523359627f, -0.0523359627f,
+    -0.0784590989f, -0.0784590989f, -0.104528472f, -0.104528472f, -0.1305262f, -0.1305262f,
+    -0.156434476f, -0.156434476f, -0.182235524f, -0.182235524f, -0.207911715f, -0.207911715f,
+    -0.233445391f, -0.233445391f, -0.258819044f, -0.258819044f, -0.284015357f, -0.284015357f,
+    -0.309017003f, -0.309017003f, -0.333806872f, -0.333806872f, -0.35836795f, -0.35836795f,
+    -0.382683456f, -0.382683456f, -0.406736672f, -0.406736672f, -0.430511117f, -0.430511117f,
+    -0.453990549f, -0.453990549f, -0.477158785f, -0.477158785f, -0.5f, -0.5f,
+    -0.522498548f, -0.522498548f, -0.544639051f, -0.544639051f, -0.56640625f, -0.56640625f,
+    -0.587785244f, -0.587785244f, -0.60876143f, -0.60876143f, -0.629320383f, -0.629320383f,
+    -0.649448037f, -0.649448037f, -0.669130623f, -0.669130623f, -0.688354552f, -0.688354552f,
+    -0.707106769f, -0.707106769f, -0.725374341f, -0.725374341f, -0.74314487f, -0.74314487f,
+    -0.760406017f, -0.760406017f, -0.777145982f, -0.777145982f, -0.793353319f, -0.793353319f,
+    -0.809017062f, -0.809017062f, -0.824126244f, -0.824126244f, -0.838670611f, -0.838670611f,
+    -0.852640152f, -0.852640152f, -0.866025448f, -0.866025448f, -0.878817141f, -0.878817141f,
+    -0.891006529f, -0.891006529f, -0.902585268f, -0.902585268f, -0.913545489f, -0.913545489f,
+    -0.923879504f, -0.923879504f, -0.933580399f, -0.933580399f, -0.942641497f, -0.942641497f,
+    -0.95105654f, -0.95105654f, -0.958819747f, -0.958819747f, -0.965925813f, -0.965925813f,
+    -0.972369909f, -0.972369909f, -0.978147626f, -0.978147626f, -0.98325491f, -0.98325491f,
+    -0.987688363f, -0.987688363f, -0.991444886f, -0.991444886f, -0.994521916f, -0.994521916f,
+    -0.996917307f, -0.996917307f, -0.99862951f, -0.99862951f, -0.999657333f, -0.999657333f,
+    -1.0f, -1.0f, -0.999657333f, -0.999657333f, -0.99862951f, -0.99862951f,
+    -0.996917307f, -0.996917307f, -0.994521856f, -0.994521856f, -0.991444826f, -0.991444826f,
+    -0.987688303f, -0.987688303f, -0.98325491f, -0.98325491f, -0.978147566f, -0.978147566f,
+    -0.972369909f, -0.972369909f, -0.965925813f, -0.965925813f, -0.958819747f, -0.958819747f,
+    -0.95105648f, -0.95105648f, -0.942641437f, -0.942641437f, -0.933580399f, -0.933580399f,
+    -0.923879504f, -0.923879504f, -0.91354543f, -0.91354543f, -0.902585268f, -0.902585268f,
+    -0.891006589f, -0.891006589f, -0.878817022f, -0.878817022f, -0.866025388f, -0.866025388f,
+    -0.852640092f, -0.852640092f, -0.838670552f, -0.838670552f, -0.824126124f, -0.824126124f,
+    -0.809017003f, -0.809017003f, -0.793353319f, -0.793353319f, -0.777146041f, -0.777146041f,
+    -0.760405838f, -0.760405838f, -0.74314481f, -0.74314481f, -0.725374281f, -0.725374281f,
+    -0.707106769f, -0.707106769f, -0.688354492f, -0.688354492f, -0.669130623f, -0.669130623f,
+    -0.649448037f, -0.649448037f, -0.629320264f, -0.629320264f, -0.608761251f, -0.608761251f,
+    1.0f, 1.0f, 0.999229014f, 0.999229014f, 0.996917307f, 0.996917307f,
+    0.993068457f, 0.993068457f, 0.987688363f, 0.987688363f, 0.980785251f, 0.980785251f,
+    0.972369909f, 0.972369909f, 0.962455213f, 0.962455213f, 0.95105654f, 0.95105654f,
+    0.938191354f, 0.938191354f, 0.923879504f, 0.923879504f, 0.908143163f, 0.908143163f,
+    0.891006529f, 0.891006529f, 0.872496009f, 0.872496009f, 0.852640152f, 0.852640152f,
+    0.831469595f, 0.831469595f, 0.809017003f, 0.809017003f, 0.785316885f, 0.785316885f,
+    0.760405958f, 0.760405958f, 0.734322488f, 0.734322488f, 0.707106769f, 0.707106769f,
+    0.678800762f, 0.678800762f, 0.649448037f, 0.649448037f, 0.619093955f, 0.619093955f,
+    0.587785184f, 0.587785184f, 0.555570185f, 0.555570185f, 0.522498608f, 0.522498608f,
+    0.488621175f, 0.488621175f, 0.453990519f, 0.453990519f, 0.418659627f, 0.418659627f,
+    0.382683426f, 0.382683426f, 0.346117049f, 0.346117049f, 0.309016973f, 0.309016973f,
+    0.271440417f, 0.271440417f, 0.233445302f, 0.233445302f, 0.195090234f, 0.195090234f,
+    0.156434491f, 0.156434491f, 0.117537282f, 0.117537282f, 0.078459084f, 0.078459084f,
+    0.0392597876f, 0.0392597876f, -4.37113883e-08f, -4.37113883e-08f, -0.0392598771f, -0.0392598771f,
+    -0.0784590542f, -0.0784590542f, -0.117537491f, -0.117537491f, -0.156434566f, -0.156434566f,
+    -0.195090324f, -0.195090324f, -0.233445391f, -0.233445391f, -0.271440357f, -0.271440357f,
+    -0.309017152f, -0.309017152f, -0.346117109f, -0.346117109f, -0.382683516f, -0.382683516f,
+    -0.418659836f, -0.418659836f, -0.4539904f, -0.4539904f, -0.488621354f, -0.488621354f,
+    -0.522498667f, -0.522498667f, -0.555570364f, -0.555570364f, -0.587785184f, -0.587785184f,
+    -0.619093895f, -0.619093895f, -0.649448216f, -0.649448216f, -0.678800762f, -0.678800762f,
+    -0.707106769f, -0.707106769f, -0.734322548f, -0.734322548f, -0.760406017f, -0.760406017f,
+    -0.785316944f, -0.785316944f, -0.809017062f, -0.809017062f, -0.831469655f, -0.831469655f,
+    -0.852640212f, -0.852640212f, -0.872495949f, -0.872495949f, -0.891006589f, -0.891006589f,
+    -0.908143222f, -0.908143222f, -0.923879623f, -0.923879623f, -0.938191295f, -0.938191295f,
+    -0.95105648f, -0.95105648f, -0.962455273f, -0.962455273f, -0.972369969f, -0.972369969f,
+    -0.98078531f, -0.98078531f, -0.987688363f, -0.987688363f, -0.993068457f, -0.993068457f,
+    -0.996917367f, -0.996917367f, -0.999229014f, -0.999229014f, -1.0f, -1.0f,
+    -0.999229014f, -0.999229014f, -0.996917307f, -0.996917307f, -0.993068457f, -0.993068457f,
+    -0.987688363f, -0.987688363f, -0.980785251f, -0.980785251f, -0.97236985f, -0.97236985f,
+    -0.962455273f, -0.962455273f, -0.951056421f, -0.951056421f, -0.938191354f, -0.938191354f,
+    -0.923879504f, -0.923879504f, -0.908143044f, -0.908143044f, -0.891006529f, -0.891006529f,
+    -0.87249589f, -0.87249589f, -0.852640271f, -0.852640271f, -0.831469536f, -0.831469536f,
+    -0.0f, -0.0f, -0.0392598175f, -0.0392598175f, -0.0784590989f, -0.0784590989f,
+    -0.117537409f, -0.117537409f, -0.156434476f, -0.156434476f, -0.195090324f, -0.195090324f,
+    -0.233445391f, -0.233445391f, -0.271440446f, -0.271440446f, -0.309017003f, -0.309017003f,
+    -0.346117049f, -0.346117049f, -0.382683456f, -0.382683456f, -0.418659776f, -0.418659776f,
+    -0.453990549f, -0.453990549f, -0.488621205f, -0.488621205f, -0.522498548f, -0.522498548f,
+    -0.555570245f, -0.555570245f, -0.587785244f, -0.587785244f, -0.619093955f, -0.619093955f,
+    -0.649448037f, -0.649448037f, -0.678800762f, -0.678800762f, -0.707106769f, -0.707106769f,
+    -0.734322488f, -0.734322488f, -0.760406017f, -0.760406017f, -0.785316944f, -0.785316944f,
+    -0.809017062f, -0.809017062f, -0.831469655f, -0.831469655f, -0.852640152f, -0.852640152f,
+    -0.872496068f, -0.872496068f, -0.891006529f, -0.891006529f, -0.908143222f, -0.908143222f,
+    -0.923879504f, -0.923879504f, -0.938191354f, -0.938191354f, -0.95105654f, -0.95105654f,
+    -0.962455273f, -0.962455273f, -0.972369909f, -0.972369909f, -0.98078531f, -0.98078531f,
+    -0.987688363f, -0.987688363f, -0.993068457f, -0.993068457f, -0.996917307f, -0.996917307f,
+    -0.999229014f, -0.999229014f, -1.0f, -1.0f, -0.999229014f, -0.999229014f,
+    -0.996917307f, -0.996917307f, -0.993068457f, -0.993068457f, -0.987688303f, -0.987688303f,
+    -0.980785251f, -0.980785251f, -0.972369909f, -0.972369909f, -0.962455273f, -0.962455273f,
+    -0.95105648f, -0.95105648f, -0.938191295f, -0.938191295f, -0.923879504f, -0.923879504f,
+    -0.908143103f, -0.908143103f, -0.891006589f, -0.891006589f, -0.872495949f, -0.872495949f,
+    -0.852640092f, -0.852640092f, -0.831469536f, -0.831469536f, -0.809017003f, -0.809017003f,
+    -0.785316944f, -0.785316944f, -0.760405838f, -0.760405838f, -0.734322488f, -0.734322488f,
+    -0.707106769f, -0.707106769f, -0.678800702f, -0.678800702f, -0.649448037f, -0.649448037f,
+    -0.619093895f, -0.619093895f, -0.587785184f, -0.587785184f, -0.555570185f, -0.555570185f,
+    -0.522498488f, -0.522498488f, -0.488621354f, -0.488621354f, -0.45399037f, -0.45399037f,
+    -0.418659598f, -0.418659598f, -0.382683277f, -0.382683277f, -0.346117109f, -0.346117109f,
+    -0.309017032f, -0.309017032f, -0.271440238f, -0.271440238f, -0.233445138f, -0.233445138f,
+    -0.195090309f, -0.195090309f, -0.156434447f, -0.156434447f, -0.117537357f, -0.117537357f,
+    -0.0784590393f, -0.0784590393f, -0.0392597429f, -0.0392597429f, 8.74227766e-08f, 8.74227766e-08f,
+    0.0392601565f, 0.0392601565f, 0.0784592181f, 0.0784592181f, 0.117537536f, 0.117537536f,
+    0.156434372f, 0.156434372f, 0.195090488f, 0.195090488f, 0.23344554f, 0.23344554f,
+    0.271440417f, 0.271440417f, 0.309017211f, 0.309017211f, 0.346117049f, 0.346117049f,
+    0.382683426f, 0.382683426f, 0.418659985f, 0.418659985f, 0.453990549f, 0.453990549f,
+    0.488621503f, 0.488621503f, 0.522498429f, 0.522498429f, 0.555570304f, 0.555570304f,
+    1.0f, 1.0f, 0.99862951f, 0.99862951f, 0.994521916f, 0.994521916f,
+    0.987688363f, 0.987688363f, 0.978147626f, 0.978147626f, 0.965925813f, 0.965925813f,
+    0.95105654f, 0.95105654f, 0.933580399f, 0.933580399f, 0.91354543f, 0.91354543f,
+    0.891006529f, 0.891006529f, 0.866025388f, 0.866025388f, 0.838670552f, 0.838670552f,
+    0.809017003f, 0.809017003f, 0.777145922f, 0.777145922f, 0.74314481f, 0.74314481f,
+    0.707106769f, 0.707106769f, 0.669130564f, 0.669130564f, 0.629320383f, 0.629320383f,
+    0.587785184f, 0.587785184f, 0.544638991f, 0.544638991f, 0.49999997f, 0.49999997f,
+    0.453990519f, 0.453990519f, 0.406736612f, 0.406736612f, 0.35836798f, 0.35836798f,
+    0.309016973f, 0.309016973f, 0.258819073f, 0.258819073f, 0.207911655f, 0.207911655f,
+    0.156434491f, 0.156434491f, 0.10452842f, 0.10452842f, 0.0523359738f, 0.0523359738f,
+    -4.37113883e-08f, -4.37113883e-08f, -0.0523359403f, -0.0523359403f, -0.104528628f, -0.104528628f,
+    -0.156434566f, -0.156434566f, -0.207911745f, -0.207911745f, -0.258819044f, -0.258819044f,
+    -0.309017152f, -0.309017152f, -0.358368069f, -0.358368069f, -0.406736702f, -0.406736702f,
+    -0.4539904f, -0.4539904f, -0.50000006f, -0.50000006f, -0.544639051f, -0.544639051f,
+    -0.587785184f, -0.587785184f, -0.629320323f, -0.629320323f, -0.669130683f, -0.669130683f,
+    -0.707106769f, -0.707106769f, -0.74314481f, -0.74314481f, -0.777146041f, -0.777146041f,
+    -0.809017062f, -0.809017062f, -0.838670552f, -0.838670552f, -0.866025388f, -0.866025388f,
+    -0.891006589f, -0.891006589f, -0.913545489f, -0.913545489f, -0.933580458f, -0.933580458f,
+    -0.95105648f, -0.95105648f, -0.965925872f, -0.965925872f, -0.978147626f, -0.978147626f,
+    -0.987688363f, -0.987688363f, -0.994521916f, -0.994521916f, -0.99862957f, -0.99862957f,
+    -1.0f, -1.0f, -0.99862951f, -0.99862951f, -0.994521916f, -0.994521916f,
+    -0.987688363f, -0.987688363f, -0.978147507f, -0.978147507f, -0.965925753f, -0.965925753f,
+    -0.951056421f, -0.951056421f, -0.933580399f, -0.933580399f, -0.91354543f, -0.91354543f,
+    -0.891006529f, -0.891006529f, -0.866025388f, -0.866025388f, -0.838670611f, -0.838670611f,
+    -0.809016764f, -0.809016764f, -0.777145803f, -0.777145803f, -0.743144691f, -0.743144691f,
+    -0.70710665f, -0.70710665f, -0.669130504f, -0.669130504f, -0.629320323f, -0.629320323f,
+    -0.587785423f, -0.587785423f, -0.544638693f, -0.544638693f, -0.499999911f, -0.499999911f,
+    -0.453990221f, -0.453990221f, -0.406736642f, -0.406736642f, -0.358367771f, -0.358367771f,
+    -0.309017092f, -0.309017092f, -0.258818984f, -0.258818984f, -0.207911924f, -0.207911924f,
+    -0.156434044f, -0.156434044f, -0.104528338f, -0.104528338f, -0.0523356497f, -0.0523356497f,
+    1.19248806e-08f, 1.19248806e-08f, 0.0523361489f, 0.0523361489f, 0.10452836f, 0.10452836f,
+    0.156434536f, 0.156434536f, 0.207911938f, 0.207911938f, 0.258819461f, 0.258819461f,
+    -0.0f, -0.0f, -0.0523359627f, -0.0523359627f, -0.104528472f, -0.104528472f,
+    -0.156434476f, -0.156434476f, -0.207911715f, -0.207911715f, -0.258819044f, -0.258819044f,
+    -0.309017003f, -0.309017003f, -0.35836795f, -0.35836795f, -0.406736672f, -0.406736672f,
+    -0.453990549f, -0.453990549f, -0.5f, -0.5f, -0.544639051f, -0.544639051f,
+    -0.587785244f, -0.587785244f, -0.629320383f, -0.629320383f, -0.669130623f, -0.669130623f,
+    -0.707106769f, -0.707106769f, -0.74314487f, -0.74314487f, -0.777145982f, -0.777145982f,
+    -0.809017062f, -0.809017062f, -0.838670611f, -0.838670611f, -0.866025448f, -0.866025448f,
+    -0.891006529f, -0.891006529f, -0.913545489f, -0.913545489f, -0.933580399f, -0.933580399f,
+    -0.95105654f, -0.95105654f, -0.965925813f, -0.965925813f, -0.978147626f, -0.978147626f,
+    -0.987688363f, -0.987688363f, -0.994521916f, -0.994521916f, -0.99862951f, -0.99862951f,
+    -1.0f, -1.0f, -0.99862951f, -0.99862951f, -0.994521856f, -0.994521856f,
+    -0.987688303f, -0.987688303f, -0.978147566f, -0.978147566f, -0.965925813f, -0.965925813f,
+    -0.95105648f, -0.95105648f, -0.933580399f, -0.933580399f, -0.91354543f, -0.91354543f,
+    -0.891006589f, -0.891006589f, -0.866025388f, -0.866025388f, -0.838670552f, -0.838670552f,
+    -0.809017003f, -0.809017003f, -0.777146041f, -0.777146041f, -0.74314481f, -0.74314481f,
+    -0.707106769f, -0.707106769f, -0.669130623f, -0.669130623f, -0.629320264f, -0.629320264f,
+    -0.587785184f, -0.587785184f, -0.544639051f, -0.544639051f, -0.50000006f, -0.50000006f,
+    -0.45399037f, -0.45399037f, -0.406736583f, -0.406736583f, -0.35836792f, -0.35836792f,
+    -0.309017032f, -0.309017032f, -0.258818924f, -0.258818924f, -0.207911611f, -0.207911611f,
+    -0.156434447f, -0.156434447f, -0.104528494f, -0.104528494f, -0.0523358099f, -0.0523358099f,
+    8.74227766e-08f, 8.74227766e-08f, 0.052335985f, 0.052335985f, 0.104528435f, 0.104528435f,
+    0.156434372f, 0.156434372f, 0.207912013f, 0.207912013f, 0.258819312f, 0.258819312f,
+    0.309017211f, 0.309017211f, 0.358368099f, 0.358368099f, 0.406736732f, 0.406736732f,
+    0.453990549f, 0.453990549f, 0.49999997f, 0.49999997f, 0.544638991f, 0.544638991f,
+    0.587785542f, 0.587785542f, 0.629320621f, 0.629320621f, 0.669130802f, 0.669130802f,
+    0.707106888f, 0.707106888f, 0.74314487f, 0.74314487f, 0.777145982f, 0.777145982f,
+    0.809016824f, 0.809016824f, 0.83867079f, 0.83867079f, 0.866025448f, 0.866025448f,
+    0.891006649f, 0.891006649f, 0.91354543f, 0.91354543f, 0.933580518f, 0.933580518f,
+    0.95105648f, 0.95105648f, 0.965925872f, 0.965925872f, 0.978147566f, 0.978147566f,
+    0.987688422f, 0.987688422f, 0.994521916f, 0.994521916f, 0.99862957f, 0.99862957f,
+    1.0f, 1.0f, 0.99862951f, 0.99862951f, 0.994521916f, 0.994521916f,
+    0.987688303f, 0.987688303f, 0.978147566f, 0.978147566f, 0.965925694f, 0.965925694f,
+    1.0f, 1.0f, 0.997858942f, 0.997858942f, 0.991444886f, 0.991444886f,
+    0.980785251f, 0.980785251f, 0.965925813f, 0.965925813f, 0.94693011f, 0.94693011f,
+    0.923879504f, 0.923879504f, 0.896872759f, 0.896872759f, 0.866025388f, 0.866025388f,
+    0.831469595f, 0.831469595f, 0.793353319f, 0.793353319f, 0.751839757f, 0.751839757f,
+    0.707106769f, 0.707106769f, 0.659345746f, 0.659345746f, 0.60876143f, 0.60876143f,
+    0.555570185f, 0.555570185f, 0.49999997f, 0.49999997f, 0.442288667f, 0.442288667f,
+    0.382683426f, 0.382683426f, 0.321439356f, 0.321439356f, 0.258819073f, 0.258819073f,
+    0.195090234f, 0.195090234f, 0.130526125f, 0.130526125f, 0.065403074f, 0.065403074f,
+    -4.37113883e-08f, -4.37113883e-08f, -0.0654031634f, -0.0654031634f, -0.130526334f, -0.130526334f,
+    -0.195090324f, -0.195090324f, -0.258819044f, -0.258819044f, -0.321439564f, -0.321439564f,
+    -0.382683516f, -0.382683516f, -0.442288637f, -0.442288637f, -0.0f, -0.0f,
+    -0.0654031336f, -0.0654031336f, -0.1305262f, -0.1305262f, -0.195090324f, -0.195090324f,
+    -0.258819044f, -0.258819044f, -0.321439475f, -0.321439475f, -0.382683456f, -0.382683456f,
+    -0.442288697f, -0.442288697f, -0.5f, -0.5f, -0.555570245f, -0.555570245f,
+    -0.60876143f, -0.60876143f, -0.659345865f, -0.659345865f, -0.707106769f, -0.707106769f,
+    -0.751839876f, -0.751839876f, -0.793353319f, -0.793353319f, -0.831469655f, -0.831469655f,
+    -0.866025448f, -0.866025448f, -0.896872759f, -0.896872759f, -0.923879504f, -0.923879504f,
+    -0.94693017f, -0.94693017f, -0.965925813f, -0.965925813f, -0.98078531f, -0.98078531f,
+    -0.991444886f, -0.991444886f, -0.997858942f, -0.997858942f, -1.0f, -1.0f,
+    -0.997858942f, -0.997858942f, -0.991444826f, -0.991444826f, -0.980785251f, -0.980785251f,
+    -0.965925813f, -0.965925813f, -0.94693011f, -0.94693011f, -0.923879504f, -0.923879504f,
+    -0.896872759f, -0.896872759f, 1.0f, 1.0f, 0.991444886f, 0.991444886f,
+    0.965925813f, 0.965925813f, 0.923879504f, 0.923879504f, 0.866025388f, 0.866025388f,
+    0.793353319f, 0.793353319f, 0.707106769f, 0.707106769f, 0.60876143f, 0.60876143f,
+    0.49999997f, 0.49999997f, 0.382683426f, 0.382683426f, 0.258819073f, 0.258819073f,
+    0.130526125f, 0.130526125f, -4.37113883e-08f, -4.37113883e-08f, -0.130526334f, -0.130526334f,
+    -0.258819044f, -0.258819044f, -0.382683516f, -0.382683516f, -0.50000006f, -0.50000006f,
+    -0.60876143f, -0.60876143f, -0.707106769f, -0.707106769f, -0.793353498f, -0.793353498f,
+    -0.866025388f, -0.866025388f, -0.923879623f, -0.923879623f, -0.965925872f, -0.965925872f,
+    -0.991444886f, -0.991444886f, -1.0f, -1.0f, -0.991444826f, -0.991444826f,
+    -0.965925753f, -0.965925753f, -0.923879504f, -0.923879504f, -0.866025388f, -0.866025388f,
+    -0.7933532f, -0.7933532f, -0.70710665f, -0.70710665f, -0.608761489f, -0.608761489f,
+    -0.0f, -0.0f, -0.1305262f, -0.1305262f, -0.258819044f, -0.258819044f,
+    -0.382683456f, -0.382683456f, -0.5f, -0.5f, -0.60876143f, -0.60876143f,
+    -0.707106769f, -0.707106769f, -0.793353319f, -0.793353319f, -0.866025448f, -0.866025448f,
+    -0.923879504f, -0.923879504f, -0.965925813f, -0.965925813f, -0.991444886f, -0.991444886f,
+    -1.0f, -1.0f, -0.991444826f, -0.991444826f, -0.965925813f, -0.965925813f,
+    -0.923879504f, -0.923879504f, -0.866025388f, -0.866025388f, -0.793353319f, -0.793353319f,
+    -0.707106769f, -0.707106769f, -0.608761251f, -0.608761251f, -0.50000006f, -0.50000006f,
+    -0.382683277f, -0.382683277f, -0.258818924f, -0.258818924f, -0.130526081f, -0.130526081f,
+    8.74227766e-08f, 8.74227766e-08f, 0.13052626f, 0.13052626f, 0.258819312f, 0.258819312f,
+    0.382683426f, 0.382683426f, 0.49999997f, 0.49999997f, 0.608761609f, 0.608761609f,
+    0.707106888f, 0.707106888f, 0.79335326f, 0.79335326f, 1.0f, 1.0f,
+    0.980785251f, 0.980785251f, 0.923879504f, 0.923879504f, 0.831469595f, 0.831469595f,
+    0.707106769f, 0.707106769f, 0.555570185f, 0.555570185f, 0.382683426f, 0.382683426f,
+    0.195090234f, 0.195090234f, -0.0f, -0.0f, -0.195090324f, -0.195090324f,
+    -0.382683456f, -0.382683456f, -0.555570245f, -0.555570245f, -0.707106769f, -0.707106769f,
+    -0.831469655f, -0.831469655f, -0.923879504f, -0.923879504f, -0.98078531f, -0.98078531f,
+    1.0f, 1.0f, 0.923879504f, 0.923879504f, 0.707106769f, 0.707106769f,
+    0.382683426f, 0.382683426f, -4.37113883e-08f, -4.37113883e-08f, -0.382683516f, -0.382683516f,
+    -0.707106769f, -0.707106769f, -0.923879623f, -0.923879623f, -0.0f, -0.0f,
+    -0.382683456f, -0.382683456f, -0.707106769f, -0.707106769f, -0.923879504f, -0.923879504f,
+    -1.0f, -1.0f, -0.923879504f, -0.923879504f, -0.707106769f, -0.707106769f,
+    -0.382683277f, -0.382683277f, 1.0f, 1.0f, 0.831469595f, 0.831469595f,
+    0.382683426f, 0.382683426f, -0.195090324f, -0.195090324f, -0.707106769f, -0.707106769f,
+    -0.98078531f, -0.98078531f, -0.923879504f, -0.923879504f, -0.555570006f, -0.555570006f,
+    -0.0f, -0.0f, -0.555570245f, -0.555570245f, -0.923879504f, -0.923879504f,
+    -0.980785251f, -0.980785251f, -0.707106769f, -0.707106769f, -0.195090309f, -0.195090309f,
+    0.382683426f, 0.382683426f, 0.831469774f, 0.831469774f,
+};
+
+static const kiss_fft_cpx fft_twiddles320[320] = {
+    {1.0f, -0.0f}, {0.999807239f, -0.0196336936f}, {0.999229014f, -0.0392598175f},
+    {0.998265624f, -0.0588708073f}, {0.996917307f, -0.0784590989f}, {0.99518472f, -0.0980171412f},
+    {0.993068457f, -0.117537409f}, {0.990569353f, -0.137012333f}, {0.987688363f, -0.156434476f},
+    {0.984426558f, -0.175796285f}, {0.980785251f, -0.195090324f}, {0.976765871f, -0.214309171f},
+    {0.972369909f, -0.233445391f}, {0.967599094f, -0.252491564f}, {0.962455213f, -0.271440446f},
+    {0.956940353f, -0.290284693f}, {0.95105654f, -0.309017003f}, {0.944806039f, -0.327630192f},
+    {0.938191354f, -0.346117049f}, {0.931214929f, -0.364470512f}, {0.923879504f, -0.382683456f},
+    {0.916187942f, -0.400748819f}, {0.908143163f, -0.418659776f}, {0.899748266f, -0.436409235f},
+    {0.891006529f, -0.453990549f}, {0.881921232f, -0.471396744f}, {0.872496009f, -0.488621205f},
+    {0.862734377f, -0.505657375f}, {0.852640152f, -0.522498548f}, {0.842217207f, -0.539138377f},
+    {0.831469595f, -0.555570245f}, {0.82040143f, -0.571787953f}, {0.809017003f, -0.587785244f},
+    {0.797320664f, -0.603555977f}, {0.785316885f, -0.619093955f}, {0.773010433f, -0.634393334f},
+    {0.760405958f, -0.649448037f}, {0.747508287f, -0.66425246f}, {0.734322488f, -0.678800762f},
+    {0.720853567f, -0.693087399f}, {0.707106769f, -0.707106769f}, {0.693087339f, -0.720853627f},
+    {0.678800762f, -0.734322488f}, {0.6642524f, -0.747508347f}, {0.649448037f, -0.760406017f},
+    {0.634393275f, -0.773010433f}, {0.619093955f, -0.785316944f}, {0.603555977f, -0.797320604f},
+    {0.587785184f, -0.809017062f}, {0.571787953f, -0.82040149f}, {0.555570185f, -0.831469655f},
+    {0.539138258f, -0.842217267f}, {0.522498608f, -0.852640152f}, {0.505657315f, -0.862734437f},
+    {0.488621175f, -0.872496068f}, {0.471396655f, -0.881921291f}, {0.453990519f, -0.891006529f},
+    {0.436409265f, -0.899748266f}, {0.418659627f, -0.908143222f}, {0.400748849f, -0.916187942f},
+    {0.382683426f, -0.923879504f}, {0.364470482f, -0.931214929f}, {0.346117049f, -0.938191354f},
+    {0.327630162f, -0.944806039f}, {0.309016973f, -0.95105654f}, {0.290284634f, -0.956940353f},
+    {0.271440417f, -0.962455273f}, {0.252491623f, -0.967599094f}, {0.233445302f, -0.972369909f},
+    {0.214309081f, -0.976765871f}, {0.195090234f, -0.98078531f}, {0.175796315f, -0.984426558f},
+    {0.156434491f, -0.987688363f}, {0.137012243f, -0.990569353f}, {0.117537282f, -0.993068457f},
+    {0.0980171338f, -0.99518472f}, {0.078459084f, -0.996917307f}, {0.0588707849f, -0.998265624f},
+    {0.0392597876f, -0.999229014f}, {0.0196336564f, -0.999807239f}, {-4.37113883e-08f, -1.0f},
+    {-0.0196338631f, -0.999807239f}, {-0.0392598771f, -0.999229014f}, {-0.0588708706f, -0.998265624f},
+    {-0.0784590542f, -0.996917307f}, {-0.0980172232f, -0.99518472f}, {-0.117537491f, -0.993068457f},
+    {-0.137012318f, -0.990569353f}, {-0.156434566f, -0.987688303f}, {-0.17579627f, -0.984426558f},
+    {-0.195090324f, -0.980785251f}, {-0.214309275f, -0.976765871f}, {-0.233445391f, -0.972369909f},
+    {-0.252491713f, -0.967599034f}, {-0.271440357f, -0.962455273f}, {-0.290284723f, -0.956940293f},
+    {-0.309017152f, -0.95105648f}, {-0.327630252f, -0.944806039f}, {-0.346117109f, -0.938191295f},
+    {-0.364470452f, -0.931214929f}, {-0.382683516f, -0.923879504f}, {-0.400748909f, -0.916187942f},
+    {-0.418659836f, -0.908143103f}, {-0.436409324f, -0.899748266f}, {-0.4539904f, -0.891006589f},
+    {-0.471396834f, -0.881921232f}, {-0.488621354f, -0.872495949f}, {-0.505657315f, -0.862734437f},
+    {-0.522498667f, -0.852640092f}, {-0.539138258f, -0.842217267f}, {-0.555570364f, -0.831469536f},
+    {-0.571788073f, -0.820401371f}, {-0.587785184f, -0.809017003f}, {-0.603556097f, -0.797320545f},
+    {-0.619093895f, -0.785316944f}, {-0.634393275f, -0.773010492f}, {-0.649448216f, -0.760405838f},
+    {-0.6642524f, -0.747508347f}, {-0.678800762f, -0.734322488f}, {-0.693087339f, -0.720853627f},
+    {-0.707106769f, -0.707106769f}, {-0.720853746f, -0.693087161f}, {-0.734322548f, -0.678800702f},
+    {-0.747508347f, -0.6642524f}, {-0.760406017f, -0.649448037f}, {-0.773010492f, -0.634393275f},
+    {-0.785316944f, -0.619093895f}, {-0.797320664f, -0.603555918f}, {-0.809017062f, -0.587785184f},
+    {-0.82040149f, -0.571787894f}, {-0.831469655f, -0.555570185f}, {-0.842217267f, -0.539138258f},
+    {-0.852640212f, -0.522498488f}, {-0.862734437f, -0.505657256f}, {-0.872495949f, -0.488621354f},
+    {-0.881921351f, -0.471396625f}, {-0.891006589f, -0.45399037f}, {-0.899748325f, -0.436409116f},
+    {-0.908143222f, -0.418659598f}, {-0.916187942f, -0.400748909f}, {-0.923879623f, -0.382683277f},
+    {-0.931214988f, -0.364470333f}, {-0.938191295f, -0.346117109f}, {-0.944806099f, -0.327630013f},
+    {-0.95105648f, -0.309017032f}, {-0.956940353f, -0.290284723f}, {-0.962455273f, -0.271440238f},
+    {-0.967599094f, -0.252491593f}, {-0.972369969f, -0.233445138f}, {-0.976765871f, -0.214309156f},
+    {-0.98078531f, -0.195090309f}, {-0.984426618f, -0.175796032f}, {-0.987688363f, -0.156434447f},
+    {-0.990569353f, -0.137012318f}, {-0.993068457f, -0.117537357f}, {-0.99518472f, -0.0980170965f},
+    {-0.996917367f, -0.0784590393f}, {-0.998265624f, -0.0588707402f}, {-0.999229014f, -0.0392597429f},
+    {-0.999807239f, -0.0196336135f}, {-1.0f, 8.74227766e-08f}, {-0.999807239f, 0.0196337886f},
+    {-0.999229014f, 0.0392601565f}, {-0.998265624f, 0.0588706769f}, {-0.996917307f, 0.0784592181f},
+    {-0.99518472f, 0.0980172679f}, {-0.993068457f, 0.117537536f}, {-0.990569293f, 0.137012482f},
+    {-0.987688363f, 0.156434372f}, {-0.984426558f, 0.175796196f}, {-0.980785251f, 0.195090488f},
+    {-0.976765871f, 0.21430932f}, {-0.97236985f, 0.23344554f}, {-0.967599094f, 0.252491534f},
+    {-0.962455273f, 0.271440417f}, {-0.956940293f, 0.290284872f}, {-0.951056421f, 0.309017211f},
+    {-0.94480598f, 0.327630401f}, {-0.938191354f, 0.346117049f}, {-0.931214929f, 0.364470512f},
+    {-0.923879504f, 0.382683426f}, {-0.916187882f, 0.400749058f}, {-0.908143044f, 0.418659985f},
+    {-0.899748266f, 0.436409265f}, {-0.891006529f, 0.453990549f}, {-0.881921232f, 0.471396774f},
+    {-0.87249589f, 0.488621503f}, {-0.862734258f, 0.505657613f}, {-0.852640271f, 0.522498429f},
+    {-0.842217207f, 0.539138377f}, {-0.831469536f, 0.555570304f}, {-0.820401371f, 0.571788013f},
+    {-0.809016764f, 0.587785542f}, {-0.797320724f, 0.603555858f}, {-0.785316885f, 0.619094074f},
+    {-0.773010373f, 0.634393394f}, {-0.760405898f, 0.649448156f}, {-0.747508228f, 0.66425252f},
+    {-0.734322548f, 0.678800702f}, {-0.720853627f, 0.69308728f}, {-0.70710665f, 0.707106888f},
+    {-0.69308722f, 0.720853746f}, {-0.678800583f, 0.734322608f}, {-0.66425246f, 0.747508287f},
+    {-0.649447918f, 0.760406077f}, {-0.634393334f, 0.773010433f}, {-0.619093776f, 0.785317063f},
+    {-0.60355556f, 0.797320962f}, {-0.587785423f, 0.809016824f}, {-0.571787953f, 0.82040143f},
+    {-0.555570006f, 0.831469774f}, {-0.539138317f, 0.842217267f}, {-0.52249831f, 0.852640331f},
+    {-0.505657315f, 0.862734377f}, {-0.488621414f, 0.87249589f}, {-0.471396685f, 0.881921291f},
+    {-0.453990221f, 0.891006649f}, {-0.436409175f, 0.899748325f}, {-0.418659896f, 0.908143103f},
+    {-0.40074876f, 0.916188002f}, {-0.382683128f, 0.923879683f}, {-0.364470422f, 0.931214988f},
+    {-0.346116722f, 0.938191473f}, {-0.327630073f, 0.944806099f}, {-0.309017092f, 0.95105648f},
+    {-0.290284544f, 0.956940353f}, {-0.271440089f, 0.962455332f}, {-0.252491444f, 0.967599154f},
+    {-0.233445451f, 0.972369909f}, {-0.214308992f, 0.976765931f}, {-0.195090383f, 0.980785251f},
+    {-0.175796106f, 0.984426618f}, {-0.156434044f, 0.987688422f}, {-0.137012154f, 0.990569353f},
+    {-0.117537431f, 0.993068457f}, {-0.0980169326f, 0.99518472f}, {-0.0784591138f, 0.996917307f},
+    {-0.0588705763f, 0.998265624f}, {-0.0392598212f, 0.999229014f}, {-0.0196334496f, 0.999807239f},
+    {1.19248806e-08f, 1.0f}, {0.0196339507f, 0.999807239f}, {0.0392603204f, 0.999229014f},
+    {0.0588706024f, 0.998265624f}, {0.0784591362f, 0.996917307f}, {0.0980174318f, 0.99518472f},
+    {0.117537454f, 0.993068457f}, {0.137012646f, 0.990569293f}, {0.156434536f, 0.987688303f},
+    {0.175796121f, 0.984426618f}, {0.195090413f, 0.980785251f}, {0.214309484f, 0.976765811f},
+    {0.233445466f, 0.972369909f}, {0.252491474f, 0.967599094f}, {0.271440566f, 0.962455213f},
+    {0.290285021f, 0.956940234f}, {0.309017122f, 0.95105648f}, {0.32763055f, 0.94480592f},
+    {0.346117198f, 0.938191295f}, {0.364470422f, 0.931214988f}, {0.382683605f, 0.923879445f},
+    {0.400749207f, 0.916187763f}, {0.418659896f, 0.908143103f}, {0.436409205f, 0.899748325f},
+    {0.453990668f, 0.89100641f}, {0.471396714f, 0.881921291f}, {0.488621444f, 0.87249589f},
+    {0.505657792f, 0.862734139f}, {0.522498369f, 0.852640271f}, {0.539138317f, 0.842217207f},
+    {0.555570424f, 0.831469476f}, {0.571787953f, 0.82040143f}, {0.587785482f, 0.809016824f},
+    {0.603555977f, 0.797320604f}, {0.619094193f, 0.785316765f}, {0.634393334f, 0.773010433f},
+    {0.649448276f, 0.760405779f}, {0.66425252f, 0.747508287f}, {0.678800642f, 0.734322608f},
+    {0.693087399f, 0.720853567f}, {0.707107008f, 0.707106531f}, {0.720853686f, 0.69308728f},
+    {0.734322727f, 0.678800464f}, {0.747508407f, 0.664252341f}, {0.760405898f, 0.649448156f},
+    {0.773010552f, 0.634393156f}, {0.785317183f, 0.619093657f}, {0.797320724f, 0.603555799f},
+    {0.809016943f, 0.587785304f}, {0.820401549f, 0.571787834f}, {0.831469595f, 0.555570304f},
+    {0.842217326f, 0.539138198f}, {0.85264039f, 0.52249819f}, {0.862734497f, 0.505657196f},
+    {0.872496009f, 0.488621265f}, {0.881921351f, 0.471396536f}, {0.891006708f, 0.453990102f},
+    {0.899748385f, 0.436409026f}, {0.908143163f, 0.418659747f}, {0.916188061f, 0.40074861f},
+    {0.923879564f, 0.382683426f}, {0.931215048f, 0.364470243f}, {0.938191533f, 0.346116573f},
+    {0.94480598f, 0.327630371f}, {0.95105654f, 0.309016943f}, {0.956940413f, 0.290284395f},
+    {0.962455273f, 0.271440387f}, {0.967599154f, 0.252491266f}, {0.972369909f, 0.233445287f},
+    {0.976765931f, 0.214308843f}, {0.98078531f, 0.195090234f}, {0.984426618f, 0.175795943f},
+    {0.987688363f, 0.156434357f}, {0.990569353f, 0.137012467f}, {0.993068457f, 0.117537275f},
+    {0.995184779f, 0.0980167687f}, {0.996917367f, 0.0784589499f}, {0.998265624f, 0.0588704161f},
+    {0.999229014f, 0.0392596573f}, {0.999807239f, 0.0196337644f},
+};
+
+static const opus_int32 fft_bitrev160[160] = {
+    0, 32, 64, 96, 128, 8, 40, 72, 104, 136, 16, 48,
+    80, 112, 144, 24, 56, 88, 120, 152, 4, 36, 68, 100,
+    132, 12, 44, 76, 108, 140, 20, 52, 84, 116, 148, 28,
+    60, 92, 124, 156, 1, 33, 65, 97, 129, 9, 41, 73,
+    105, 137, 17, 49, 81, 113, 145, 25, 57, 89, 121, 153,
+    5, 37, 69, 101, 133, 13, 45, 77, 109, 141, 21, 53,
+    85, 117, 149, 29, 61, 93, 125, 157, 2, 34, 66, 98,
+    130, 10, 42, 74, 106, 138, 18, 50, 82, 114, 146, 26,
+    58, 90, 122, 154, 6, 38, 70, 102, 134, 14, 46, 78,
+    110, 142, 22, 54, 86, 118, 150, 30, 62, 94, 126, 158,
+    3, 35, 67, 99, 131, 11, 43, 75, 107, 139, 19, 51,
+    83, 115, 147, 27, 59, 91, 123, 155, 7, 39, 71, 103,
+    135, 15, 47, 79, 111, 143, 23, 55, 87, 119, 151, 31,
+    63, 95, 127, 159,
+};
+
+static const float fft_split160[608] = {
+    1.0f, 1.0f, 0.999229014f, 0.999229014f, 0.996917307f, 0.996917307f,
+    0.993068457f, 0.993068457f, 0.987688363f, 0.987688363f, 0.980785251f, 0.980785251f,
+    0.972369909f, 0.972369909f, 0.962455213f, 0.962455213f, 0.95105654f, 0.95105654f,
+    0.938191354f, 0.938191354f, 0.923879504f, 0.923879504f, 0.908143163f, 0.908143163f,
+    0.891006529f, 0.891006529f, 0.872496009f, 0.872496009f, 0.852640152f, 0.852640152f,
+    0.831469595f, 0.831469595f, 0.809017003f, 0.809017003f, 0.785316885f, 0.785316885f,
+    0.760405958f, 0.760405958f, 0.734322488f, 0.734322488f, 0.707106769f, 0.707106769f,
+    0.678800762f, 0.678800762f, 0.649448037f, 0.649448037f, 0.619093955f, 0.619093955f,
+    0.587785184f, 0.587785184f, 0.555570185f, 0.555570185f, 0.522498608f, 0.522498608f,
+    0.488621175f, 0.488621175f, 0.453990519f, 0.453990519f, 0.418659627f, 0.418659627f,
+    0.382683426f, 0.382683426f, 0.346117049f, 0.346117049f, -0.0f, -0.0f,
+    -0.0392598175f, -0.0392598175f, -0.0784590989f, -0.0784590989f, -0.117537409f, -0.117537409f,
+    -0.156434476f, -0.156434476f, -0.195090324f, -0.195090324f, -0.233445391f, -0.233445391f,
+    -0.271440446f, -0.271440446f, -0.309017003f, -0.309017003f, -0.346117049f, -0.346117049f,
+    -0.382683456f, -0.382683456f, -0.418659776f, -0.418659776f, -0.453990549f, -0.453990549f,
+    -0.488621205f, -0.488621205f, -0.522498548f, -0.522498548f, -0.555570245f, -0.555570245f,
+    -0.587785244f, -0.587785244f, -0.619093955f, -0.619093955f, -0.649448037f, -0.649448037f,
+    -0.678800762f, -0.678800762f, -0.707106769f, -0.707106769f, -0.734322488f, -0.734322488f,
+    -0.760406017f, -0.760406017f, -0.785316944f, -0.785316944f, -0.809017062f, -0.809017062f,
+    -0.831469655f, -0.831469655f, -0.852640152f, -0.852640152f, -0.872496068f, -0.872496068f,
+    -0.891006529f, -0.891006529f, -0.908143222f, -0.908143222f, -0.923879504f, -0.923879504f,
+    -0.938191354f, -0.938191354f, 1.0f, 1.0f, 0.996917307f, 0.996917307f,
+    0.987688363f, 0.987688363f, 0.972369909f, 0.972369909f, 0.95105654f, 0.95105654f,
+    0.923879504f, 0.923879504f, 0.891006529f, 0.891006529f, 0.852640152f, 0.852640152f,
+    0.809017003f, 0.809017003f, 0.760405958f, 0.760405958f, 0.707106769f, 0.707106769f,
+    0.649448037f, 0.649448037f, 0.587785184f, 0.587785184f, 0.522498608f, 0.522498608f,
+    0.453990519f, 0.453990519f, 0.382683426f, 0.382683426f, 0.309016973f, 0.309016973f,
+    0.233445302f, 0.233445302f, 0.156434491f, 0.156434491f, 0.078459084f, 0.078459084f,
+    -4.37113883e-08f, -4.37113883e-08f, -0.0784590542f, -0.0784590542f, -0.156434566f, -0.156434566f,
+    -0.233445391f, -0.233445391f, -0.309017152f, -0.309017152f, -0.382683516f, -0.382683516f,
+    -0.4539904f, -0.4539904f, -0.522498667f, -0.522498667f, -0.587785184f, -0.587785184f,
+    -0.649448216f, -0.649448216f, -0.707106769f, -0.707106769f, -0.760406017f, -0.760406017f,
+    -0.0f, -0.0f, -0.0784590989f, -0.0784590989f, -0.156434476f, -0.156434476f,
+    -0.233445391f, -0.233445391f, -0.309017003f, -0.309017003f, -0.382683456f, -0.382683456f,
+    -0.453990549f, -0.453990549f, -0.522498548f, -0.522498548f, -0.587785244f, -0.587785244f,
+    -0.649448037f, -0.649448037f, -0.707106769f, -0.707106769f, -0.760406017f, -0.760406017f,
+    -0.809017062f, -0.809017062f, -0.852640152f, -0.852640152f, -0.891006529f, -0.891006529f,
+    -0.923879504f, -0.923879504f, -0.95105654f, -0.95105654f, -0.972369909f, -0.972369909f,
+    -0.987688363f, -0.987688363f, -0.996917307f, -0.996917307f, -1.0f, -1.0f,
+    -0.996917307f, -0.996917307f, -0.987688303f, -0.987688303f, -0.972369909f, -0.972369909f,
+    -0.95105648f, -0.95105648f, -0.923879504f, -0.923879504f, -0.891006589f, -0.891006589f,
+    -0.852640092f, -0.852640092f, -0.809017003f, -0.809017003f, -0.760405838f, -0.760405838f,
+    -0.707106769f, -0.707106769f, -0.649448037f, -0.649448037f, 1.0f, 1.0f,
+    0.993068457f, 0.993068457f, 0.972369909f, 0.972369909f, 0.938191354f, 0.938191354f,
+    0.891006529f, 0.891006529f, 0.831469595f, 0.831469595f, 0.760405958f, 0.760405958f,
+    0.678800762f, 0.678800762f, 0.587785184f, 0.587785184f, 0.488621175f, 0.488621175f,
+    0.382683426f, 0.382683426f, 0.271440417f, 0.271440417f, 0.156434491f, 0.156434491f,
+    0.0392597876f, 0.0392597876f, -0.0784590542f, -0.0784590542f, -0.195090324f, -0.195090324f,
+    -0.309017152f, -0.309017152f, -0.418659836f, -0.418659836f, -0.522498667f, -0.522498667f,
+    -0.619093895f, -0.619093895f, -0.707106769f, -0.707106769f, -0.785316944f, -0.785316944f,
+    -0.852640212f, -0.852640212f, -0.908143222f, -0.908143222f, -0.95105648f, -0.95105648f,
+    -0.98078531f, -0.98078531f, -0.996917367f, -0.996917367f, -0.999229014f, -0.999229014f,
+    -0.987688363f, -0.987688363f, -0.962455273f, -0.962455273f, -0.923879504f, -0.923879504f,
+    -0.87249589f, -0.87249589f, -0.0f, -0.0f, -0.117537409f, -0.117537409f,
+    -0.233445391f, -0.233445391f, -0.346117049f, -0.346117049f, -0.453990549f, -0.453990549f,
+    -0.555570245f, -0.555570245f, -0.649448037f, -0.649448037f, -0.734322488f, -0.734322488f,
+    -0.809017062f, -0.809017062f, -0.872496068f, -0.872496068f, -0.923879504f, -0.923879504f,
+    -0.962455273f, -0.962455273f, -0.987688363f, -0.987688363f, -0.999229014f, -0.999229014f,
+    -0.996917307f, -0.996917307f, -0.980785251f, -0.980785251f, -0.95105648f, -0.95105648f,
+    -0.908143103f, -0.908143103f, -0.852640092f, -0.852640092f, -0.785316944f, -0.785316944f,
+    -0.707106769f, -0.707106769f, -0.619093895f, -0.619093895f, -0.522498488f, -0.522498488f,
+    -0.418659598f, -0.418659598f, -0.309017032f, -0.309017032f, -0.195090309f, -0.195090309f,
+    -0.0784590393f, -0.0784590393f, 0.0392601565f, 0.0392601565f, 0.156434372f, 0.156434372f,
+    0.271440417f, 0.271440417f, 0.382683426f, 0.382683426f, 0.488621503f, 0.488621503f,
+    1.0f, 1.0f, 0.987688363f, 0.987688363f, 0.95105654f, 0.95105654f,
+    0.891006529f, 0.891006529f, 0.809017003f, 0.809017003f, 0.707106769f, 0.707106769f,
+    0.587785184f, 0.587785184f, 0.453990519f, 0.453990519f, 0.309016973f, 0.309016973f,
+    0.156434491f, 0.156434491f, -4.37113883e-08f, -4.37113883e-08f, -0.156434566f, -0.156434566f,
+    -0.309017152f, -0.309017152f, -0.4539904f, -0.4539904f, -0.587785184f, -0.587785184f,
+    -0.707106769f, -0.707106769f, -0.809017062f, -0.809017062f, -0.891006589f, -0.891006589f,
+    -0.95105648f, -0.95105648f, -0.987688363f, -0.987688363f, -1.0f, -1.0f,
+    -0.987688363f, -0.987688363f, -0.951056421f, -0.951056421f, -0.891006529f, -0.891006529f,
+    -0.809016764f, -0.809016764f, -0.70710665f, -0.70710665f, -0.587785423f, -0.587785423f,
+    -0.453990221f, -0.453990221f, -0.309017092f, -0.309017092f, -0.156434044f, -0.156434044f,
+    1.19248806e-08f, 1.19248806e-08f, 0.156434536f, 0.156434536f, -0.0f, -0.0f,
+    -0.156434476f, -0.156434476f, -0.309017003f, -0.309017003f, -0.453990549f, -0.453990549f,
+    -0.587785244f, -0.587785244f, -0.707106769f, -0.707106769f, -0.809017062f, -0.809017062f,
+    -0.891006529f, -0.891006529f, -0.95105654f, -0.95105654f, -0.987688363f, -0.987688363f,
+    -1.0f, -1.0f, -0.987688303f, -0.987688303f, -0.95105648f, -0.95105648f,
+    -0.891006589f, -0.891006589f, -0.809017003f, -0.809017003f, -0.707106769f, -0.707106769f,
+    -0.587785184f, -0.587785184f, -0.45399037f, -0.45399037f, -0.309017032f, -0.309017032f,
+    -0.156434447f, -0.156434447f, 8.74227766e-08f, 8.74227766e-08f, 0.156434372f, 0.156434372f,
+    0.309017211f, 0.309017211f, 0.453990549f, 0.453990549f, 0.587785542f, 0.587785542f,
+    0.707106888f, 0.707106888f, 0.809016824f, 0.809016824f, 0.891006649f, 0.891006649f,
+    0.95105648f, 0.95105648f, 0.987688422f, 0.987688422f, 1.0f, 1.0f,
+    0.987688303f, 0.987688303f, 1.0f, 1.0f, 0.980785251f, 0.980785251f,
+    0.923879504f, 0.923879504f, 0.831469595f, 0.831469595f, 0.707106769f, 0.707106769f,
+    0.555570185f, 0.555570185f, 0.382683426f, 0.382683426f, 0.195090234f, 0.195090234f,
+    -0.0f, -0.0f, -0.195090324f, -0.195090324f, -0.382683456f, -0.382683456f,
+    -0.555570245f, -0.555570245f, -0.707106769f, -0.707106769f, -0.831469655f, -0.831469655f,
+    -0.923879504f, -0.923879504f, -0.98078531f, -0.98078531f, 1.0f, 1.0f,
+    0.923879504f, 0.923879504f, 0.707106769f, 0.707106769f, 0.382683426f, 0.382683426f,
+    -4.37113883e-08f, -4.37113883e-08f, -0.382683516f, -0.382683516f, -0.707106769f, -0.707106769f,
+    -0.923879623f, -0.923879623f, -0.0f, -0.0f, -0.382683456f, -0.382683456f,
+    -0.707106769f, -0.707106769f, -0.923879504f, -0.923879504f, -1.0f, -1.0f,
+    -0.923879504f, -0.923879504f, -0.707106769f, -0.707106769f, -0.382683277f, -0.382683277f,
+    1.0f, 1.0f, 0.831469595f, 0.831469595f, 0.382683426f, 0.382683426f,
+    -0.195090324f, -0.195090324f, -0.707106769f, -0.707106769f, -0.98078531f, -0.98078531f,
+    -0.923879504f, -0.923879504f, -0.555570006f, -0.555570006f, -0.0f, -0.0f,
+    -0.555570245f, -0.555570245f, -0.923879504f, -0.923879504f, -0.980785251f, -0.980785251f,
+    -0.707106769f, -0.707106769f, -0.195090309f, -0.195090309f, 0.382683426f, 0.382683426f,
+    0.831469774f, 0.831469774f,
+};
+
+// Complex 960-point FFT
+const kiss_fft_state rnn_kfft = {
+    960, // nfft
+    0.0010416667f, // scale
+    -1, // shift
+    {5, 192, 3, 64, 4, 16, 4, 4, 4, 1, 0, 0, 0, 0, 0, 0}, // factors
+    fft_bitrev960, // bitrev
+    fft_twiddles, // twiddles
+    fft_split960 // split_twiddles
+};
+
+// Packed half-size FFT behind rnn_fftr/rnn_ifftr, scaled by 1/960 like the full transform
+const kiss_fft_state rnn_kfft_half = {
+    480, // nfft
+    0.0010416667f, // scale
+    1, // shift
+    {5, 96, 3, 32, 4, 8, 2, 4, 4, 1, 0, 0, 0, 0, 0, 0}, // factors
+    fft_bitrev480, // bitrev
+    fft_twiddles, // twiddles
+    fft_split480 // split_twiddles
+};
+
+// Packed half-size FFT for the 320-point real transforms of the 16 kHz spectral denoiser
+const kiss_fft_state rnn_kfft_16k = {
+    160, // nfft
+    0.003125f, // scale
+    1, // shift
+    {5, 32, 4, 8, 2, 4, 4, 1, 0, 0, 0, 0, 0, 0, 0, 0}, // factors
+    fft_bitrev160, // bitrev
+    fft_twiddles320, // twiddles
+    fft_split160 // split_twiddles
+};
+
+// ERB-spaced band edges, in units of 50 Hz
+const int eband20ms[NB_BANDS + 2] = {
+    0, 2, 4, 6, 8, 10, 12, 14, 18, 21, 24, 28,
+    32, 36, 41, 47, 53, 60, 68, 77, 87, 98, 110, 124,
+    140, 157, 176, 198, 223, 251, 282, 317, 356, 400,
+};
+
+// First half of the spectral denoiser's 320-point window
+const float spectral_half_window[SPECTRAL_FRAME_SIZE] = {
+    3.78491532e-05f, 0.000340620492f, 0.000946046319f, 0.00185389258f, 0.00306380726f, 0.00457531959f,
+    0.00638783723f, 0.0085006468f, 0.0109129101f, 0.0136236614f, 0.0166318044f, 0.0199361145f,
+    0.0235352255f, 0.0274276342f, 0.0316116922f, 0.0360856056f, 0.0408474281f, 0.0458950549f,
+    0.0512262285f, 0.0568385124f, 0.062729314f, 0.0688958541f, 0.0753351897f, 0.0820441842f,
+    0.0890194997f, 0.0962576419f, 0.103754878f, 0.111507311f, 0.119510807f, 0.127761051f,
+    0.136253506f, 0.144983411f, 0.153945804f, 0.163135484f, 0.172547072f, 0.182174906f,
+    0.192013159f, 0.202055752f, 0.212296382f, 0.222728521f, 0.233345464f, 0.244140238f,
+    0.255105674f, 0.266234398f, 0.277518868f, 0.288951218f, 0.300523549f, 0.312227666f,
+    0.324055225f, 0.335997701f, 0.348046392f, 0.360192508f, 0.372427016f, 0.384740859f,
+    0.397124738f, 0.409569323f, 0.422065198f, 0.434602767f, 0.447172493f, 0.459764689f,
+    0.472369671f, 0.484977663f, 0.497579008f, 0.510163903f, 0.522722721f, 0.535245717f,
+    0.547723293f, 0.560145974f, 0.572504222f, 0.58478874f, 0.596990347f, 0.609099925f,
+    0.621108532f, 0.633007407f, 0.644788086f, 0.656442165f, 0.667961538f, 0.679338276f,
+    0.690564752f, 0.701633692f, 0.712537885f, 0.723270535f, 0.733825266f, 0.744195819f,
+    0.754376352f, 0.764361382f, 0.774145722f, 0.783724606f, 0.793093503f, 0.802248418f,
+    0.811185598f, 0.819901764f, 0.828393936f, 0.836659551f, 0.844696403f, 0.852502763f,
+    0.860077202f, 0.867418647f, 0.87452656f, 0.881400526f, 0.888040781f, 0.894447744f,
+    0.900622249f, 0.906565487f, 0.91227901f, 0.917764664f, 0.923024654f, 0.928061485f,
+    0.932878017f, 0.937477291f, 0.941862822f, 0.946038187f, 0.950007319f, 0.953774393f,
+    0.957343817f, 0.960720181f, 0.963908315f, 0.966913164f, 0.969739914f, 0.97239387f,
+    0.974880517f, 0.977205336f, 0.979374051f, 0.981392324f, 0.983266115f, 0.985001266f,
+    0.986603677f, 0.988079309f, 0.989434063f, 0.990674019f, 0.991804957f, 0.992832899f,
+    0.993763626f, 0.994602919f, 0.995356441f, 0.996029854f, 0.996628702f, 0.997158289f,
+    0.997623861f, 0.998030603f, 0.998383403f, 0.998687088f, 0.998946249f, 0.999165416f,
+    0.9993487f, 0.999500215f, 0.999623775f, 0.999723017f, 0.999801278f, 0.999861658f,
+    0.999907196f, 0.999940455f, 0.99996388f, 0.999979615f, 0.99998951f, 0.999995291f,
+    0.999998271f, 0.999999523f, 0.99999994f, 1.0f,
+};
@@ -1,78 +1,4 @@
-#include <stdlib.h> // malloc, free
-#include <math.h>   // cosf, sinf
-
 #include "rnn.h"
-#include "kiss_fft.h"
-
-kiss_fft_state rnn_kfft = {
-    960,                                                  // nfft
-    0.0010416667f,                                        // scale
-    -1,                                                   // shift
-    {5, 192, 3, 64, 4, 16, 4, 4, 4, 1, 0, 0, 0, 0, 0, 0}, // factors
-    NULL,                                                 // bitrev
-    NULL                                                  // twiddles
-};
-
-static void compute_twiddles(int16_t nfft, kiss_fft_cpx* twiddles)
-{
-    for (int i = 0; i < nfft; i++)
-    {
-        float phase = -2.0f * M_PIF * ((float)i / nfft);
-        twiddles[i].r = cosf(phase);
-        twiddles[i].i = sinf(phase);
-    }
-}
-
-static void compute_bitrev_table(int32_t Fout, opus_int32 *f,
-                                 const int32_t fstride, int in_stride, opus_int16 *factors)
-{
-    const int p = *factors++; /* the radix  */
-    const int m = *factors++; /* stage's fft length/p */
-
-    if (m == 1)
-    {
-        int j;
-        for (j = 0; j < p; j++)
-        {
-            *f = Fout + j;
-            f += fstride * in_stride;
-        }
-    }
-    else
-    {
-        int j;
-        for (j = 0; j < p; j++)
-        {
-            compute_bitrev_table(Fout, f, fstride * p, in_stride, factors);
-            f += fstride * in_stride;
-            Fout += m;
-        }
-    }
-}
-
-// Initialize RNNoise FFT tables
-void init_rnnnoise_tables()
-{
-    size_t nfft = (size_t) rnn_kfft.nfft;
-    rnn_kfft.twiddles = (kiss_fft_cpx *)malloc(nfft * sizeof(kiss_fft_cpx));
-    compute_twiddles((int16_t)nfft, rnn_kfft.twiddles);
-    rnn_kfft.bitrev = (opus_int32 *)malloc(nfft * sizeof(opus_int32));
-    compute_bitrev_table(0, rnn_kfft.bitrev, 1, 1, rnn_kfft.factors);
-}
-
-void free_rnnnoise_tables()
-{
-    if (rnn_kfft.twiddles)
-    {
-        free(rnn_kfft.twiddles);
-        rnn_kfft.twiddles = NULL;
-    }
-    if (rnn_kfft.bitrev)
-    {
-        free(rnn_kfft.bitrev);
-        rnn_kfft.bitrev = NULL;
-    }
-}
 
 const float _rnn_half_window[] = {
 4.20549168e-06f, 3.78491532e-05f, 0.000105135041f, 0.000206060256f, 0.000340620492f,
@@ -0,0 +1,153 @@
+#include <stdlib.h>
+#include <math.h>
+
+#include "denoise.h"
+#include "pcm.h"
+#include "spectral.h"
+#include "x86cpu.h"
+
+#define SMOOTH_ALPHA .8f  // band energy smoothing for the noise tracker
+#define NOISE_RISE 1.0116f // the floor may rise 5 dB per second (100 frames)
+#define NOISE_BIAS 1.5f    // a running minimum sits below the mean noise energy
+#define DD_ALPHA .98f      // decision-directed weight of the previous frame's clean estimate
+#define GAIN_FLOOR .1f     // -20 dB: keeps some residual noise instead of musical tones
+
+// Band points: the eband20ms edges up to 7850 Hz, then Nyquist
+static int band_point(int i)
+{
+  return i < SPECTRAL_NB_BANDS - 1 ? eband20ms[i] : SPECTRAL_FRAME_SIZE;
+}
+
+SpectralState *spectral_create(void)
+{
+  rnn_init_arch(); // the FFT kernels
+  SpectralState *st = (SpectralState *)malloc(sizeof(SpectralState));
+  if (st)
+    memset(st, 0, sizeof(SpectralState));
+  return st;
+}
+
+void spectral_destroy(SpectralState *st)
+{
+  free(st);
+}
+
+static void apply_window(float *x)
+{
+  for (int i = 0; i < SPECTRAL_FRAME_SIZE; i++)
+  {
+    x[i] *= spectral_half_window[i];
+    x[SPECTRAL_WINDOW_SIZE - 1 - i] *= spectral_half_window[i];
+  }
+}
+
+// Triangular band energies, like compute_band_energy() in denoise.c
+static void compute_band_energy(float *bandE, const kiss_fft_cpx *X)
+{
+  for (int i = 0; i < SPECTRAL_NB_BANDS; i++)
+    bandE[i] = 0;
+  for (int i = 0; i < SPECTRAL_NB_BANDS - 1; i++)
+  {
+    int band_size = band_point(i + 1) - band_point(i);
+    for (int j = 0; j < band_size; j++)
+    {
+      float frac = (float)j / (float)band_size;
+      float tmp = SQUARE(X[band_point(i) + j].r) + SQUARE(X[band_point(i) + j].i);
+      bandE[i] += (1 - frac) * tmp;
+      bandE[i + 1] += frac * tmp;
+    }
+  }
+  bandE[SPECTRAL_NB_BANDS - 1] += SQUARE(X[SPECTRAL_FRAME_SIZE].r);
+}
+
+static void interp_band_gain(float *g, const float *bandG)
+{
+  for (int i = 0; i < SPECTRAL_NB_BANDS - 1; i++)
+  {
+    int band_size = band_point(i + 1) - band_point(i);
+    for (int j = 0; j < band_size; j++)
+    {
+      float frac = (float)j / (float)band_size;
+      g[band_point(i) + j] = (1 - frac) * bandG[i] + frac * bandG[i + 1];
+    }
+  }
+  g[SPECTRAL_FRAME_SIZE] = bandG[SPECTRAL_NB_BANDS - 1];
+}
+
+// The frame comes from in or in16 and goes to out or out16, whichever is set
+static float process_frame(SpectralState *st, float *out, opus_int16 *out16, const float *in, const opus_int16 *in16)
+{
+  float x[SPECTRAL_WINDOW_SIZE];
+  kiss_fft_cpx X[SPECTRAL_FREQ_SIZE];
+  float E[SPECTRAL_NB_BANDS];
+  float g[SPECTRAL_FREQ_SIZE];
+  float presence = 0;
+
+  RNN_COPY(x, st->analysis_mem, SPECTRAL_FRAME_SIZE);
+  if (in16)
+  {
+    for (int i = 0; i < SPECTRAL_FRAME_SIZE; i++)
+      x[SPECTRAL_FRAME_SIZE + i] = (float)in16[i];
+  }
+  else
+  {
+    RNN_COPY(&x[SPECTRAL_FRAME_SIZE], in, SPECTRAL_FRAME_SIZE);
+  }
+  RNN_COPY(st->analysis_mem, &x[SPECTRAL_FRAME_SIZE], SPECTRAL_FRAME_SIZE);
+  apply_window(x);
+  rnn_fftr(&rnn_kfft_16k, x, X);
+  compute_band_energy(E, X);
+
+  for (int i = 0; i < SPECTRAL_NB_BANDS; i++)
+  {
+    E[i] += 1e-6f;
+    if (!st->started)
+    {
+      st->smooth[i] = st->noise[i] = E[i];
+    }
+    else
+    {
+      st->smooth[i] = SMOOTH_ALPHA * st->smooth[i] + (1 - SMOOTH_ALPHA) * E[i];
+      st->noise[i] = st->smooth[i] < st->noise[i] ? st->smooth[i] : NOISE_RISE * st->noise[i];
+    }
+    // a-posteriori SNR gamma, a-priori SNR xi, Wiener gain xi / (1 + xi)
+    float gamma = E[i] / (NOISE_BIAS * st->noise[i]);
+    float xi = DD_ALPHA * SQUARE(st->gain[i]) * st->post_snr[i] + (1 - DD_ALPHA) * MAX(gamma - 1, 0);
+    float gain = xi / (1 + xi);
+    presence += gain;
+    st->gain[i] = MAX(gain, GAIN_FLOOR);
+    st->post_snr[i] = gamma;
+  }
+  st->started = 1;
+
+  interp_band_gain(g, st->gain);
+  for (int i = 0; i < SPECTRAL_FREQ_SIZE; i++)
+  {
+    X[i].r *= g[i];
+    X[i].i *= g[i];
+  }
+  rnn_ifftr(&rnn_kfft_16k, X, x);
+  apply_window(x);
+  if (out16)
+  {
+    for (int i = 0; i < SPECTRAL_FRAME_SIZE; i++)
+      out16[i] = rnn_float2s16(x[i] + st->synthesis_mem[i]);
+  }
+  else
+  {
+    for (int i = 0; i < SPECTRAL_FRAME_SIZE; i++)
+      out[i] = x[i] + st->synthesis_mem[i];
+  }
+  RNN_COPY(st->synthesis_mem, &x[SPECTRAL_FRAME_SIZE], SPECTRAL_FRAME_SIZE);
+  return presence / SPECTRAL_NB_BANDS;
+}
+
+float spectral_process_frame(SpectralState *st, float *out, const float *in)
+{
+  return process_frame(st, out, NULL, in, NULL);
+}
+
+float spectral_process_frame_s16(SpectralState *st, opus_int16 *out, const opus_int16 *in)
+{
+  return process_frame(st, NULL, out, NULL, in);
+}
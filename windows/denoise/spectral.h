@@ -0,0 +1,61 @@
+#ifndef SPECTRAL_H
+#define SPECTRAL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "kiss_fft.h"
+
+/*
+ * Spectral (Wiener/MMSE) noise suppressor for 16 kHz mono: a cheap alternative to the
+ * network for low-end machines and many streams at once. 10 ms frames, 20 ms sine-window
+ * overlap-add (10 ms latency), gains computed on the eband20ms band edges below 8 kHz and
+ * interpolated to the 50 Hz bins. The noise floor is a minimum-tracking estimate of the
+ * smoothed band energy; the gain is the Wiener gain of a decision-directed a-priori SNR.
+ */
+#define SPECTRAL_FRAME_SIZE 160
+#define SPECTRAL_WINDOW_SIZE (2 * SPECTRAL_FRAME_SIZE)
+#define SPECTRAL_FREQ_SIZE (SPECTRAL_FRAME_SIZE + 1)
+#define SPECTRAL_NB_BANDS 27 // eband20ms[0..25] and Nyquist
+
+// rnnoise_gen_tables.c, generated by tools/gen_tables.c
+extern const kiss_fft_state rnn_kfft_16k;
+extern const float spectral_half_window[SPECTRAL_FRAME_SIZE];
+
+typedef struct
+{
+  float analysis_mem[SPECTRAL_FRAME_SIZE];
+  float synthesis_mem[SPECTRAL_FRAME_SIZE];
+  float smooth[SPECTRAL_NB_BANDS]; // recursively smoothed band energy
+  float noise[SPECTRAL_NB_BANDS];  // noise floor estimate
+  float gain[SPECTRAL_NB_BANDS];   // previous frame's gain, for the decision-directed SNR
+  float post_snr[SPECTRAL_NB_BANDS];
+  int started; // the trackers have been seeded from a first frame
+} SpectralState;
+
+/**
+ * Allocate a SpectralState. Nothing is shared between states, so any thread may create one;
+ * each state must only be used by one thread at a time.
+ */
+SpectralState *spectral_create(void);
+
+void spectral_destroy(SpectralState *st);
+
+/**
+ * Denoise SPECTRAL_FRAME_SIZE samples at 16 kHz (same scale as rnnoise_process_frame(), in
+ * and out may alias). Returns the mean band gain before the floor, a rough speech presence.
+ */
+float spectral_process_frame(SpectralState *st, float *out, const float *in);
+
+/**
+ * spectral_process_frame() on 16-bit samples, rounded and saturated on the way out like
+ * rnnoise_process_frame_s16().
+ */
+float spectral_process_frame_s16(SpectralState *st, opus_int16 *out, const opus_int16 *in);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SPECTRAL_H */
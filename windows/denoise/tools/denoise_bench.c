@@ -0,0 +1,181 @@
+// Denoise benchmark: per-frame time and cache misses with the exported weight
+// layout ("before") and with the repacked, 64-byte aligned panels ("after").
+//
+//   denoise_bench [frames] [--soft] [--flush]
+//
+// --flush walks a 32 MB buffer between frames (outside the counters), which is
+// closer to a real player where other work evicts the weights every 10 ms.
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+
+#include "denoise.h"
+
+#define FLUSH_BYTES (32 << 20)
+
+typedef struct
+{
+  int fd[3];
+  long long value[3];
+} Counters;
+
+static const char *counter_names[3] = {"cycles", "L1D misses", "LLC misses"};
+
+static int open_counter(unsigned int type, unsigned long long config, int group)
+{
+  struct perf_event_attr attr;
+  memset(&attr, 0, sizeof(attr));
+  attr.size = sizeof(attr);
+  attr.type = type;
+  attr.config = config;
+  attr.disabled = group < 0;
+  attr.exclude_kernel = 1;
+  attr.exclude_hv = 1;
+  return (int)syscall(SYS_perf_event_open, &attr, 0, -1, group, 0);
+}
+
+static void counters_open(Counters *c)
+{
+  c->fd[0] = open_counter(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES, -1);
+  c->fd[1] = open_counter(PERF_TYPE_HW_CACHE,
+                          PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16),
+                          c->fd[0]);
+  c->fd[2] = open_counter(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES, c->fd[0]);
+  memset(c->value, 0, sizeof(c->value));
+}
+
+static void counters_close(Counters *c)
+{
+  for (int i = 0; i < 3; i++)
+    if (c->fd[i] >= 0)
+      close(c->fd[i]);
+}
+
+static void counters_enable(Counters *c, int on)
+{
+  if (c->fd[0] >= 0)
+    ioctl(c->fd[0], on ? PERF_EVENT_IOC_ENABLE : PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+}
+
+static void counters_read(Counters *c)
+{
+  for (int i = 0; i < 3; i++)
+  {
+    long long v = 0;
+    if (c->fd[i] >= 0 && read(c->fd[i], &v, sizeof(v)) == sizeof(v))
+      c->value[i] = v;
+    else
+      c->value[i] = -1;
+  }
+}
+
+static double now_us(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+}
+
+// Voiced bursts, pauses and a steady noise floor, in the 16-bit range RNNoise expects
+static void make_frame(float *frame, int index, unsigned int *seed)
+{
+  for (int i = 0; i < FRAME_SIZE; i++)
+  {
+    int t = index * FRAME_SIZE + i;
+    *seed = *seed * 1664525u + 1013904223u;
+    float noise = ((float)(*seed >> 9) / 8388608.f - 1.f) * 300.f;
+    float voice = ((index / 50) % 3 == 2) ? 0.f : 4000.f * sinf(t * .03f) * sinf(t * .0007f);
+    frame[i] = voice + noise;
+  }
+}
+
+static void run(const char *label, DenoiseState *st, int frames, unsigned char *flush)
+{
+  float in[FRAME_SIZE], out[FRAME_SIZE];
+  unsigned int seed = 1;
+  double elapsed = 0;
+  volatile unsigned char sink = 0;
+  Counters c;
+
+  counters_open(&c);
+  for (int n = 0; n < frames; n++)
+  {
+    make_frame(in, n, &seed);
+    if (flush)
+    {
+      for (size_t i = 0; i < FLUSH_BYTES; i += 64)
+        flush[i]++;
+      sink += flush[n & (FLUSH_BYTES - 1)];
+    }
+    double t0 = now_us();
+    counters_enable(&c, 1);
+    rnnoise_process_frame(st, out, in);
+    counters_enable(&c, 0);
+    elapsed += now_us() - t0;
+  }
+  counters_read(&c);
+  counters_close(&c);
+
+  printf("%-10s %9.1f us/frame", label, elapsed / frames);
+  for (int i = 0; i < 3; i++)
+  {
+    if (c.value[i] >= 0)
+      printf("  %s %10.1f", counter_names[i], (double)c.value[i] / frames);
+    else
+      printf("  %s %10s", counter_names[i], "n/a");
+  }
+  printf("  (per frame)\n");
+}
+
+int main(int argc, char **argv)
+{
+  int frames = 1000;
+  int full = 1;
+  unsigned char *flush = NULL;
+  for (int i = 1; i < argc; i++)
+  {
+    if (!strcmp(argv[i], "--soft"))
+      full = 0;
+    else if (!strcmp(argv[i], "--flush"))
+      flush = (unsigned char *)calloc(FLUSH_BYTES, 1);
+    else
+      frames = atoi(argv[i]);
+  }
+  if (frames <= 0)
+  {
+    fprintf(stderr, "usage: %s [frames] [--soft] [--flush]\n", argv[0]);
+    return 1;
+  }
+
+  DenoiseState *exported = rnnoise_create(full);
+  DenoiseState *repacked = rnnoise_create(full);
+  if (!exported || !repacked)
+  {
+    fprintf(stderr, "rnnoise_create failed\n");
+    return 1;
+  }
+  // Point the first state at a model built straight on the static arrays, as before repacking
+  RNNoise exported_model;
+  if (init_rnnoise(&exported_model, rnnoise_arrays) != 0)
+  {
+    fprintf(stderr, "init_rnnoise failed\n");
+    return 1;
+  }
+  exported->model = &exported_model;
+
+  printf("%d frames, %s denoise%s\n", frames, full ? "full" : "soft", flush ? ", caches flushed between frames" : "");
+  run("exported", exported, frames, flush);
+  run("repacked", repacked, frames, flush);
+
+  rnnoise_destroy(exported);
+  rnnoise_destroy(repacked);
+  free(flush);
+  return 0;
+}
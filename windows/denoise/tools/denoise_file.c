@@ -0,0 +1,378 @@
+// Offline file denoiser: 48 kHz mono WAV (16-bit PCM or 32-bit float) or raw PCM in,
+// same format out. Both files are mapped; the input is cut into segments that run on
+// all cores, each segment starting a few frames early so the network state has settled
+// by the time its own frames come up. Every segment writes its own range of the output
+// mapping, so stitching needs no copies or locks.
+//
+//   denoise_file [options] input output
+//     -j N          worker threads (default: online CPUs)
+//     --segment S   segment length in seconds (default 30)
+//     --warmup N    warm-up frames before each segment (default 50)
+//     --soft        Soft denoise instead of Full
+//     --model FILE  network from a model file (export_model) instead of the built-in one
+//     --raw-float   raw input is 32-bit float instead of 16-bit signed
+//
+// Input ending in .wav is parsed as WAV, anything else as raw little-endian PCM. The
+// output is delay-compensated (one frame) and has exactly as many samples as the input.
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "denoise.h"
+
+#define SAMPLE_RATE 48000
+#define WAV_HEADER_SIZE 44
+
+typedef struct
+{
+  const unsigned char *in; // first sample
+  unsigned char *out;      // first sample
+  size_t samples;
+  int is_float;
+  int full_denoise;
+  const char *model_path; // NULL for the built-in network
+  size_t segment_frames;
+  size_t warmup_frames;
+  size_t segments;
+  atomic_size_t next;
+  atomic_int failed;
+} Job;
+
+static double now_s(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static int has_suffix(const char *s, const char *suffix)
+{
+  size_t n = strlen(s), m = strlen(suffix);
+  return n >= m && !strcasecmp(s + n - m, suffix);
+}
+
+static unsigned int le16(const unsigned char *p) { return p[0] | (p[1] << 8); }
+static unsigned int le32(const unsigned char *p) { return p[0] | (p[1] << 8) | (p[2] << 16) | ((unsigned int)p[3] << 24); }
+
+static void put16(unsigned char *p, unsigned int v)
+{
+  p[0] = v & 0xff;
+  p[1] = (v >> 8) & 0xff;
+}
+
+static void put32(unsigned char *p, unsigned int v)
+{
+  put16(p, v & 0xffff);
+  put16(p + 2, v >> 16);
+}
+
+// Finds the fmt and data chunks; only 48 kHz mono PCM16 or float32 is accepted
+static int parse_wav(const unsigned char *p, size_t size, size_t *data_offset, size_t *data_size, int *is_float)
+{
+  if (size < 12 || memcmp(p, "RIFF", 4) || memcmp(p + 8, "WAVE", 4))
+  {
+    fprintf(stderr, "not a RIFF/WAVE file\n");
+    return -1;
+  }
+  int have_fmt = 0;
+  size_t pos = 12;
+  while (pos + 8 <= size)
+  {
+    size_t len = le32(p + pos + 4);
+    const unsigned char *body = p + pos + 8;
+    if (!memcmp(p + pos, "fmt ", 4) && len >= 16 && pos + 8 + len <= size)
+    {
+      unsigned int format = le16(body), channels = le16(body + 2), rate = le32(body + 4), bits = le16(body + 14);
+      if (format == 0xfffe && len >= 26) // WAVE_FORMAT_EXTENSIBLE: subformat GUID starts with the tag
+        format = le16(body + 24);
+      if (channels != 1 || rate != SAMPLE_RATE || !((format == 1 && bits == 16) || (format == 3 && bits == 32)))
+      {
+        fprintf(stderr, "unsupported WAV: %u ch, %u Hz, format %u, %u bits (need mono 48000 Hz PCM16 or float32)\n",
+                channels, rate, format, bits);
+        return -1;
+      }
+      *is_float = format == 3;
+      have_fmt = 1;
+    }
+    else if (!memcmp(p + pos, "data", 4))
+    {
+      if (!have_fmt)
+        break;
+      *data_offset = pos + 8;
+      *data_size = len <= size - pos - 8 ? len : size - pos - 8; // tolerate a truncated last chunk
+      return 0;
+    }
+    pos += 8 + len + (len & 1);
+  }
+  fprintf(stderr, "WAV has no fmt/data chunks\n");
+  return -1;
+}
+
+static void write_wav_header(unsigned char *p, size_t data_size, int is_float)
+{
+  const unsigned int bytes = is_float ? 4 : 2;
+  memcpy(p, "RIFF", 4);
+  put32(p + 4, (unsigned int)(36 + data_size));
+  memcpy(p + 8, "WAVEfmt ", 8);
+  put32(p + 16, 16);
+  put16(p + 20, is_float ? 3 : 1);
+  put16(p + 22, 1);
+  put32(p + 24, SAMPLE_RATE);
+  put32(p + 28, SAMPLE_RATE * bytes);
+  put16(p + 32, bytes);
+  put16(p + 34, 8 * bytes);
+  memcpy(p + 36, "data", 4);
+  put32(p + 40, (unsigned int)data_size);
+}
+
+// One frame of input in RNNoise's 16-bit range; zeros past the end of the file
+static void read_frame(const Job *job, size_t frame, float *x)
+{
+  size_t first = frame * FRAME_SIZE;
+  for (int i = 0; i < FRAME_SIZE; i++)
+  {
+    size_t t = first + i;
+    if (t >= job->samples)
+      x[i] = 0.f;
+    else if (job->is_float)
+    {
+      float v;
+      memcpy(&v, job->in + 4 * t, 4);
+      x[i] = v * 32768.f;
+    }
+    else
+      x[i] = (float)(short)le16(job->in + 2 * t);
+  }
+}
+
+// Output frame n holds input samples from frame n - 1 (the analysis window's delay)
+static void write_frame(const Job *job, size_t frame, const float *y)
+{
+  if (frame == 0)
+    return;
+  size_t first = (frame - 1) * FRAME_SIZE;
+  for (int i = 0; i < FRAME_SIZE && first + i < job->samples; i++)
+  {
+    size_t t = first + i;
+    if (job->is_float)
+    {
+      float v = y[i] * (1.f / 32768.f);
+      memcpy(job->out + 4 * t, &v, 4);
+    }
+    else
+    {
+      float v = floorf(.5f + y[i]);
+      v = v < -32768.f ? -32768.f : v > 32767.f ? 32767.f : v;
+      put16(job->out + 2 * t, (unsigned int)(unsigned short)(short)v);
+    }
+  }
+}
+
+static void process_segment(Job *job, DenoiseState *st, size_t first, size_t last)
+{
+  float x[FRAME_SIZE], y[FRAME_SIZE];
+  size_t start = first > job->warmup_frames ? first - job->warmup_frames : 0;
+  const size_t bytes = job->is_float ? 4 : 2;
+
+  madvise((void *)((uintptr_t)(job->in + start * FRAME_SIZE * bytes) & ~(uintptr_t)4095),
+          (last - start) * FRAME_SIZE * bytes + 4096, MADV_WILLNEED);
+  for (size_t n = start; n < last; n++)
+  {
+    read_frame(job, n, x);
+    rnnoise_process_frame(st, y, x);
+    if (n >= first)
+      write_frame(job, n, y);
+  }
+}
+
+static void *worker(void *arg)
+{
+  Job *job = (Job *)arg;
+  // Total frames include one extra to flush the last frame's delayed samples
+  const size_t frames = (job->samples + FRAME_SIZE - 1) / FRAME_SIZE + 1;
+  for (;;)
+  {
+    size_t s = atomic_fetch_add(&job->next, 1);
+    if (s >= job->segments)
+      break;
+    int err = 0;
+    DenoiseState *st = job->model_path ? rnnoise_create_from_file(job->model_path, job->full_denoise, &err)
+                                       : rnnoise_create(job->full_denoise);
+    if (!st)
+    {
+      atomic_store(&job->failed, err != 0 ? err : 1);
+      break;
+    }
+    size_t first = s * job->segment_frames;
+    size_t last = first + job->segment_frames < frames ? first + job->segment_frames : frames;
+    process_segment(job, st, first, last);
+    rnnoise_destroy(st);
+  }
+  return NULL;
+}
+
+static void usage(const char *argv0)
+{
+  fprintf(stderr, "usage: %s [-j threads] [--segment seconds] [--warmup frames] [--soft] [--model file] [--raw-float] input output\n", argv0);
+}
+
+int main(int argc, char **argv)
+{
+  int threads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+  double segment_s = 30.;
+  long warmup = 50;
+  int full = 1, raw_float = 0;
+  const char *in_path = NULL, *out_path = NULL, *model_path = NULL;
+
+  for (int i = 1; i < argc; i++)
+  {
+    if (!strcmp(argv[i], "-j") && i + 1 < argc)
+      threads = atoi(argv[++i]);
+    else if (!strcmp(argv[i], "--segment") && i + 1 < argc)
+      segment_s = atof(argv[++i]);
+    else if (!strcmp(argv[i], "--warmup") && i + 1 < argc)
+      warmup = atol(argv[++i]);
+    else if (!strcmp(argv[i], "--soft"))
+      full = 0;
+    else if (!strcmp(argv[i], "--model") && i + 1 < argc)
+      model_path = argv[++i];
+    else if (!strcmp(argv[i], "--raw-float"))
+      raw_float = 1;
+    else if (!in_path)
+      in_path = argv[i];
+    else if (!out_path)
+      out_path = argv[i];
+    else
+    {
+      usage(argv[0]);
+      return 1;
+    }
+  }
+  if (!in_path || !out_path || threads <= 0 || segment_s <= 0 || warmup < 0)
+  {
+    usage(argv[0]);
+    return 1;
+  }
+
+  int in_fd = open(in_path, O_RDONLY);
+  struct stat sb;
+  if (in_fd < 0 || fstat(in_fd, &sb) != 0)
+  {
+    perror(in_path);
+    return 1;
+  }
+  size_t in_size = (size_t)sb.st_size;
+  const unsigned char *in_map = NULL;
+  if (in_size > 0)
+  {
+    in_map = mmap(NULL, in_size, PROT_READ, MAP_PRIVATE, in_fd, 0);
+    if (in_map == MAP_FAILED)
+    {
+      perror("mmap input");
+      return 1;
+    }
+    madvise((void *)in_map, in_size, MADV_SEQUENTIAL);
+  }
+
+  const int wav = has_suffix(in_path, ".wav");
+  size_t data_offset = 0, data_size = in_size;
+  int is_float = raw_float;
+  if (wav && parse_wav(in_map, in_size, &data_offset, &data_size, &is_float) != 0)
+    return 1;
+
+  Job job;
+  memset(&job, 0, sizeof(job));
+  job.is_float = is_float;
+  job.samples = data_size / (is_float ? 4 : 2);
+  job.full_denoise = full;
+  job.model_path = model_path;
+  job.in = in_map + data_offset;
+  job.warmup_frames = (size_t)warmup;
+  job.segment_frames = (size_t)(segment_s * SAMPLE_RATE / FRAME_SIZE);
+  if (job.segment_frames == 0)
+    job.segment_frames = 1;
+  const size_t frames = (job.samples + FRAME_SIZE - 1) / FRAME_SIZE + 1;
+  job.segments = (frames + job.segment_frames - 1) / job.segment_frames;
+
+  const size_t out_header = wav ? WAV_HEADER_SIZE : 0;
+  const size_t out_data = job.samples * (is_float ? 4 : 2);
+  const size_t out_size = out_header + out_data;
+  int out_fd = open(out_path, O_RDWR | O_CREAT | O_TRUNC, 0644);
+  if (out_fd < 0 || ftruncate(out_fd, (off_t)out_size) != 0)
+  {
+    perror(out_path);
+    return 1;
+  }
+  unsigned char *out_map = NULL;
+  if (out_size > 0)
+  {
+    out_map = mmap(NULL, out_size, PROT_READ | PROT_WRITE, MAP_SHARED, out_fd, 0);
+    if (out_map == MAP_FAILED)
+    {
+      perror("mmap output");
+      return 1;
+    }
+  }
+  if (wav)
+    write_wav_header(out_map, out_data, is_float);
+  job.out = out_map + out_header;
+
+  if ((size_t)threads > job.segments)
+    threads = (int)job.segments;
+  pthread_t *tid = (pthread_t *)calloc(threads, sizeof(pthread_t));
+  double t0 = now_s();
+  int started = 0, create_error = 0;
+  for (; started < threads; started++)
+  {
+    create_error = pthread_create(&tid[started], NULL, worker, &job);
+    if (create_error != 0)
+    {
+      atomic_store(&job.next, job.segments); // the running workers stop after their segment
+      break;
+    }
+  }
+  for (int i = 0; i < started; i++)
+    pthread_join(tid[i], NULL);
+  double elapsed = now_s() - t0;
+  free(tid);
+
+  if (out_map)
+  {
+    msync(out_map, out_size, MS_SYNC);
+    munmap(out_map, out_size);
+  }
+  close(out_fd);
+  if (in_map)
+    munmap((void *)in_map, in_size);
+  close(in_fd);
+  if (create_error != 0)
+  {
+    fprintf(stderr, "pthread_create: %s\n", strerror(create_error));
+    return 1;
+  }
+  const int failed = atomic_load(&job.failed);
+  if (failed)
+  {
+    if (model_path && failed < 0)
+      fprintf(stderr, "%s: %s\n", model_path, rnn_model_strerror(failed));
+    else
+      fprintf(stderr, "rnnoise_create failed\n");
+    return 1;
+  }
+
+  double audio = (double)job.samples / SAMPLE_RATE;
+  printf("%.2f s of audio, %zu segments on %d threads, %.2f s wall\n", audio, job.segments, threads, elapsed);
+  if (audio > 0 && elapsed > 0)
+    printf("real-time factor %.4f (%.1fx faster than real time)\n", elapsed / audio, audio / elapsed);
+  return 0;
+}
@@ -0,0 +1,590 @@
+// Regression net for the denoise kernels. Fixed PCM corpora go through rnnoise_process_frame():
+//
+//  - with a synthetic network (deterministic weights in the built-in model's shapes, int8 and
+//    sparse like it), loaded from a model file, at RNN_ARCH_C: per-frame output level and VAD
+//    must match the golden vectors in golden/synthetic.txt within tolerance;
+//  - with the synthetic and the built-in network, at every kernel level the CPU supports:
+//    every level must match every other level frame by frame from the same state, and rnnoise_process_frames() and
+//    rnnoise_process_frame_s16() must give exactly what rnnoise_process_frame() gives.
+//
+//   denoise_golden golden/synthetic.txt            check
+//   denoise_golden --update golden/synthetic.txt   rewrite the golden vectors (after an intended change)
+//
+// Everything is generated with IEEE-exact arithmetic (no libm transcendentals), so the corpora
+// and the synthetic weights are the same on every compiler and platform.
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "denoise.h"
+#include "pcm.h"
+#include "x86cpu.h"
+
+#define CORPUS_FRAMES 100 // 1 s
+#define CORPUS_SIZE (CORPUS_FRAMES * FRAME_SIZE)
+#define MODEL_PATH "denoise_golden.rnnm"
+
+// Golden tolerance: room for a compiler that contracts a multiply-add, not for a behavior change
+#define GOLDEN_LEVEL_TOL .05f // dB
+#define GOLDEN_VAD_TOL .005f
+// Kernel levels may differ in the last bits where a SIMD kernel fuses multiply-adds (float GEMV,
+// pitch inner products). Through the GRU state that drift grows by an amount that depends on
+// the weights, so levels are compared one frame at a time from the same state (lockstep()).
+// Over 30 random weight sets in the built-in shapes the worst frame was 68 dB and the worst
+// VAD difference .0004; one input column dropped from the AVX2 float GEMV gives 24 dB and
+// .012. The bounds sit between: 1% error amplitude, and about 10x the rounding seen.
+#define CROSS_SNR_MIN 40.f // dB, worst frame
+#define CROSS_VAD_TOL .005f
+
+static const char *arch_names[RNN_ARCH_COUNT] = {"C", "SSE4.1", "AVX2"};
+
+static unsigned int lcg(unsigned int *seed)
+{
+  *seed = *seed * 1664525u + 1013904223u;
+  return *seed;
+}
+
+// Uniform in [-1, 1), exact
+static float uniform(unsigned int *seed)
+{
+  return (float)(lcg(seed) >> 9) / 8388608.f - 1.f;
+}
+
+/* ---- Corpora ---- */
+
+typedef enum
+{
+  CORPUS_VOICED,        // harmonic "vowels" with syllable envelope
+  CORPUS_NOISE,         // white noise
+  CORPUS_VOICED_NOISE,  // voiced over low-passed noise, about 5 dB SNR
+  CORPUS_SILENCE_BURST, // digital silence, a faint hiss, then a loud voiced burst
+  CORPUS_CLIPPED,       // voiced driven into 16-bit clipping
+  CORPUS_COUNT
+} CorpusId;
+
+static const char *corpus_names[CORPUS_COUNT] = {"voiced", "noise", "voiced_noise", "silence_burst", "clipped"};
+
+/* A sum of harmonics from resonators y[n] = c * y[n-1] - y[n-2], c = 2cos(hw), started at
+   y[-1] = 0, y[0] = 1 so y[n] = sin((n + 1) hw) / sin(hw). The harmonic coefficients follow
+   from c1 by the Chebyshev recurrence and sin(hw) = sqrt(1 - c^2 / 4), so only +, *, / and
+   sqrt are used. f0 steps every 25 frames. */
+static void voiced(float *x, int n, double amplitude)
+{
+  static const double c1_table[4] = {
+      1.9996144810, // 2cos(2pi 150 / 48000)
+      1.9994448604, // 180 Hz
+      1.9997532650, // 120 Hz
+      1.9995240540, // 166.7 Hz
+  };
+  const int harmonics = 12;
+  for (int seg = 0; seg * 25 * FRAME_SIZE < n; seg++)
+  {
+    const double c1 = c1_table[seg & 3];
+    double c_prev = 2., c_h = c1;
+    const int start = seg * 25 * FRAME_SIZE;
+    const int len = MIN(25 * FRAME_SIZE, n - start);
+    for (int i = 0; i < len; i++)
+      x[start + i] = 0;
+    for (int h = 1; h <= harmonics; h++)
+    {
+      const double sh = sqrt(MAX(1e-12, 1. - c_h * c_h / 4.));
+      const double gain = amplitude / h * sh;
+      double y1 = 0., y0 = 1.;
+      for (int i = 0; i < len; i++)
+      {
+        x[start + i] += (float)(gain * y0);
+        double y = c_h * y0 - y1;
+        y1 = y0;
+        y0 = y;
+      }
+      double c_next = c1 * c_h - c_prev;
+      c_prev = c_h;
+      c_h = c_next;
+    }
+  }
+  // Syllables: 150 ms up, 100 ms hold, 150 ms down, 100 ms pause
+  for (int i = 0; i < n; i++)
+  {
+    int t = i % 24000;
+    float env = t < 7200 ? t / 7200.f : t < 12000 ? 1.f : t < 19200 ? (19200 - t) / 7200.f : 0.f;
+    x[i] *= env;
+  }
+}
+
+static void white(float *x, int n, float amplitude, unsigned int seed)
+{
+  for (int i = 0; i < n; i++)
+    x[i] = amplitude * uniform(&seed);
+}
+
+// Rounded and clamped to 16-bit values, as the plugin hands them over
+static void to_pcm(float *x, int n)
+{
+  for (int i = 0; i < n; i++)
+    x[i] = floorf(.5f + MAX(-32768.f, MIN(32767.f, x[i])));
+}
+
+static void make_corpus(CorpusId id, float *x)
+{
+  static float tmp[CORPUS_SIZE];
+  switch (id)
+  {
+  case CORPUS_VOICED:
+    voiced(x, CORPUS_SIZE, 6000.);
+    break;
+  case CORPUS_NOISE:
+    white(x, CORPUS_SIZE, 3000.f, 1);
+    break;
+  case CORPUS_VOICED_NOISE:
+    voiced(x, CORPUS_SIZE, 3000.);
+    white(tmp, CORPUS_SIZE, 6000.f, 2);
+    {
+      float y = 0;
+      for (int i = 0; i < CORPUS_SIZE; i++)
+      {
+        y = .9f * y + .1f * tmp[i]; // one-pole low-pass
+        x[i] += 2.f * y;
+      }
+    }
+    break;
+  case CORPUS_SILENCE_BURST:
+    memset(x, 0, sizeof(float) * CORPUS_SIZE);
+    white(&x[30 * FRAME_SIZE], 30 * FRAME_SIZE, 4.f, 3);
+    voiced(tmp, 40 * FRAME_SIZE, 20000.);
+    for (int i = 0; i < 40 * FRAME_SIZE; i++)
+      x[60 * FRAME_SIZE + i] = tmp[i];
+    break;
+  case CORPUS_CLIPPED:
+    voiced(x, CORPUS_SIZE, 60000.);
+    break;
+  default:
+    break;
+  }
+  to_pcm(x, CORPUS_SIZE);
+}
+
+/* ---- Synthetic network ---- */
+
+#define MAX_ARRAYS 48
+
+typedef struct
+{
+  WeightArray arrays[MAX_ARRAYS + 1]; // NULL-terminated
+  char names[MAX_ARRAYS][40];
+  int count;
+  unsigned int seed;
+} SyntheticWeights;
+
+static void *add_array(SyntheticWeights *sw, const char *prefix, const char *suffix, int type, int size)
+{
+  WeightArray *a = &sw->arrays[sw->count];
+  snprintf(sw->names[sw->count], sizeof(sw->names[0]), "%s%s", prefix, suffix);
+  a->name = sw->names[sw->count];
+  a->type = type;
+  a->size = size;
+  a->data = calloc(1, (size_t)size);
+  sw->count++;
+  return (void *)a->data;
+}
+
+static void add_floats(SyntheticWeights *sw, const char *prefix, const char *suffix, int n, float amplitude)
+{
+  float *v = (float *)add_array(sw, prefix, suffix, WEIGHT_TYPE_float, n * SIZEOF(float));
+  for (int i = 0; i < n; i++)
+    v[i] = amplitude * uniform(&sw->seed);
+}
+
+static void add_int8(SyntheticWeights *sw, const char *prefix, int n)
+{
+  opus_int8 *v = (opus_int8 *)add_array(sw, prefix, "_weights_int8", WEIGHT_TYPE_int8, n);
+  for (int i = 0; i < n; i++)
+    v[i] = (opus_int8)((int)(lcg(&sw->seed) % 255u) - 127);
+}
+
+// Outputs of about unit variance: int8 weights and inputs average |73| and |60| or so
+static void add_scale(SyntheticWeights *sw, const char *prefix, int n, int fan_in)
+{
+  float *v = (float *)add_array(sw, prefix, "_scale", WEIGHT_TYPE_float, n * SIZEOF(float));
+  for (int i = 0; i < n; i++)
+    v[i] = (1.f + .25f * uniform(&sw->seed)) / (4096.f * sqrtf((float)fan_in));
+}
+
+static void dense(SyntheticWeights *sw, const char *prefix, int nb_inputs, int nb_outputs, int int8)
+{
+  add_floats(sw, prefix, "_bias", nb_outputs, .1f);
+  if (int8)
+  {
+    add_int8(sw, prefix, nb_inputs * nb_outputs);
+    add_scale(sw, prefix, nb_outputs, nb_inputs);
+  }
+  else
+  {
+    add_floats(sw, prefix, "_weights_float", nb_inputs * nb_outputs, sqrtf(3.f / nb_inputs));
+  }
+}
+
+// 8x4 blocks, about 80% of them present, int8
+static void sparse(SyntheticWeights *sw, const char *prefix, int nb_inputs, int nb_outputs, int diag)
+{
+  const int groups = nb_outputs / 8;
+  int *idx = (int *)add_array(sw, prefix, "_weights_idx", WEIGHT_TYPE_int, groups * (nb_inputs / 4 + 1) * SIZEOF(int));
+  int n = 0, blocks = 0;
+  for (int g = 0; g < groups; g++)
+  {
+    int *count = &idx[n++];
+    for (int pos = 0; pos < nb_inputs; pos += 4)
+    {
+      if (lcg(&sw->seed) % 5u != 0)
+      {
+        idx[n++] = pos;
+        (*count)++;
+        blocks++;
+      }
+    }
+  }
+  sw->arrays[sw->count - 1].size = n * SIZEOF(int);
+  add_floats(sw, prefix, "_bias", nb_outputs, .1f);
+  add_int8(sw, prefix, blocks * 32);
+  add_scale(sw, prefix, nb_outputs, nb_inputs * 4 / 5);
+  if (diag)
+    add_floats(sw, prefix, "_weights_diag", nb_outputs, .5f);
+}
+
+#define SYNTH_CONV1 128
+#define SYNTH_CONV2 384
+#define SYNTH_GRU 384
+
+// Writes MODEL_PATH; returns 0 on success
+static int write_synthetic_model(void)
+{
+  SyntheticWeights sw;
+  memset(&sw, 0, sizeof(sw));
+  sw.seed = 2024;
+  const int cat = SYNTH_CONV2 + 3 * SYNTH_GRU;
+  dense(&sw, "conv1", 3 * CONV1_IN_SIZE, SYNTH_CONV1, 0);
+  dense(&sw, "conv2", 3 * SYNTH_CONV1, SYNTH_CONV2, 1);
+  sparse(&sw, "gru1_input", SYNTH_CONV2, 3 * SYNTH_GRU, 0);
+  sparse(&sw, "gru1_recurrent", SYNTH_GRU, 3 * SYNTH_GRU, 1);
+  sparse(&sw, "gru2_input", SYNTH_GRU, 3 * SYNTH_GRU, 0);
+  sparse(&sw, "gru2_recurrent", SYNTH_GRU, 3 * SYNTH_GRU, 1);
+  sparse(&sw, "gru3_input", SYNTH_GRU, 3 * SYNTH_GRU, 0);
+  sparse(&sw, "gru3_recurrent", SYNTH_GRU, 3 * SYNTH_GRU, 1);
+  dense(&sw, "dense_out", cat, NB_BANDS, 0);
+  dense(&sw, "vad_dense", cat, 1, 0);
+
+  RNNoise model;
+  const WeightArray *a = sw.arrays;
+  int err = linear_init(&model.conv1, a, "conv1_bias", NULL, "conv1_weights_float", NULL, NULL, NULL, 3 * CONV1_IN_SIZE, SYNTH_CONV1) ||
+            linear_init(&model.conv2, a, "conv2_bias", "conv2_weights_int8", NULL, NULL, NULL, "conv2_scale", 3 * SYNTH_CONV1, SYNTH_CONV2) ||
+            linear_init(&model.gru1_input, a, "gru1_input_bias", "gru1_input_weights_int8", NULL, "gru1_input_weights_idx", NULL, "gru1_input_scale", SYNTH_CONV2, 3 * SYNTH_GRU) ||
+            linear_init(&model.gru1_recurrent, a, "gru1_recurrent_bias", "gru1_recurrent_weights_int8", NULL, "gru1_recurrent_weights_idx", "gru1_recurrent_weights_diag", "gru1_recurrent_scale", SYNTH_GRU, 3 * SYNTH_GRU) ||
+            linear_init(&model.gru2_input, a, "gru2_input_bias", "gru2_input_weights_int8", NULL, "gru2_input_weights_idx", NULL, "gru2_input_scale", SYNTH_GRU, 3 * SYNTH_GRU) ||
+            linear_init(&model.gru2_recurrent, a, "gru2_recurrent_bias", "gru2_recurrent_weights_int8", NULL, "gru2_recurrent_weights_idx", "gru2_recurrent_weights_diag", "gru2_recurrent_scale", SYNTH_GRU, 3 * SYNTH_GRU) ||
+            linear_init(&model.gru3_input, a, "gru3_input_bias", "gru3_input_weights_int8", NULL, "gru3_input_weights_idx", NULL, "gru3_input_scale", SYNTH_GRU, 3 * SYNTH_GRU) ||
+            linear_init(&model.gru3_recurrent, a, "gru3_recurrent_bias", "gru3_recurrent_weights_int8", NULL, "gru3_recurrent_weights_idx", "gru3_recurrent_weights_diag", "gru3_recurrent_scale", SYNTH_GRU, 3 * SYNTH_GRU) ||
+            linear_init(&model.dense_out, a, "dense_out_bias", NULL, "dense_out_weights_float", NULL, NULL, NULL, cat, NB_BANDS) ||
+            linear_init(&model.vad_dense, a, "vad_dense_bias", NULL, "vad_dense_weights_float", NULL, NULL, NULL, cat, 1);
+  model.arena = NULL;
+  if (!err)
+    err = rnnoise_repack(&model);
+  if (!err)
+  {
+    FILE *f = fopen(MODEL_PATH, "wb");
+    err = f ? rnn_model_write(f, &model) : RNN_MODEL_ERR_IO;
+    if (f && fclose(f) != 0)
+      err = RNN_MODEL_ERR_IO;
+    rnnoise_free_packed(&model);
+  }
+  for (int i = 0; i < sw.count; i++)
+    free((void *)sw.arrays[i].data);
+  return err;
+}
+
+/* ---- Runs ---- */
+
+typedef struct
+{
+  float out[CORPUS_SIZE];
+  float vad[CORPUS_FRAMES];
+} RunResult;
+
+static DenoiseState *create(const char *model_path, int full_denoise)
+{
+  int err = 0;
+  DenoiseState *st = model_path ? rnnoise_create_from_file(model_path, full_denoise, &err) : rnnoise_create(full_denoise);
+  if (!st)
+    fprintf(stderr, "cannot create a denoiser%s%s: %s\n", model_path ? " from " : "", model_path ? model_path : "",
+            rnn_model_strerror(err));
+  return st;
+}
+
+static int run(const char *model_path, int full_denoise, int arch, const float *corpus, RunResult *r)
+{
+  DenoiseState *st = create(model_path, full_denoise);
+  if (!st)
+    return 1;
+  rnn_arch = arch; // after create: the first state picks the CPU's level
+  for (int f = 0; f < CORPUS_FRAMES; f++)
+    r->vad[f] = rnnoise_process_frame(st, &r->out[f * FRAME_SIZE], &corpus[f * FRAME_SIZE]);
+  rnnoise_destroy(st);
+  return 0;
+}
+
+// All corpora at once through rnnoise_process_frames(), checked against single-stream runs
+static int check_batch(const char *label, const char *model_path, int full_denoise, int arch, float *const *corpora, RunResult *single)
+{
+  DenoiseState *st[CORPUS_COUNT];
+  float *out[CORPUS_COUNT];
+  const float *in[CORPUS_COUNT];
+  float vad[CORPUS_COUNT];
+  static float outbuf[CORPUS_COUNT][FRAME_SIZE];
+  int failed = 0;
+  for (int c = 0; c < CORPUS_COUNT; c++)
+  {
+    st[c] = create(model_path, full_denoise);
+    if (!st[c])
+      return 1;
+    out[c] = outbuf[c];
+  }
+  rnn_arch = arch;
+  for (int f = 0; f < CORPUS_FRAMES && !failed; f++)
+  {
+    for (int c = 0; c < CORPUS_COUNT; c++)
+      in[c] = &corpora[c][f * FRAME_SIZE];
+    rnnoise_process_frames(st, out, in, vad, CORPUS_COUNT);
+    for (int c = 0; c < CORPUS_COUNT; c++)
+    {
+      if (memcmp(out[c], &single[c].out[f * FRAME_SIZE], sizeof(outbuf[c])) != 0 || vad[c] != single[c].vad[f])
+      {
+        printf("FAIL %s %s batch: %s frame %d differs from rnnoise_process_frame\n", label, arch_names[arch], corpus_names[c], f);
+        failed = 1;
+      }
+    }
+  }
+  for (int c = 0; c < CORPUS_COUNT; c++)
+    rnnoise_destroy(st[c]);
+  return failed;
+}
+
+// Each corpus through rnnoise_process_frame_s16(), checked against the rounded float output
+static int check_s16(const char *label, const char *model_path, int full_denoise, int arch, float *const *corpora, RunResult *single)
+{
+  int failed = 0;
+  for (int c = 0; c < CORPUS_COUNT && !failed; c++)
+  {
+    DenoiseState *st = create(model_path, full_denoise);
+    if (!st)
+      return 1;
+    rnn_arch = arch;
+    for (int f = 0; f < CORPUS_FRAMES && !failed; f++)
+    {
+      opus_int16 in[FRAME_SIZE], out[FRAME_SIZE];
+      const float *ref = &single[c].out[f * FRAME_SIZE];
+      for (int i = 0; i < FRAME_SIZE; i++)
+        in[i] = (opus_int16)corpora[c][f * FRAME_SIZE + i];
+      float vad = rnnoise_process_frame_s16(st, out, in);
+      for (int i = 0; i < FRAME_SIZE; i++)
+        failed |= out[i] != rnn_float2s16(ref[i]);
+      if (failed || vad != single[c].vad[f])
+      {
+        printf("FAIL %s %s s16: %s frame %d differs from rnnoise_process_frame\n", label, arch_names[arch], corpus_names[c], f);
+        failed = 1;
+      }
+    }
+    rnnoise_destroy(st);
+  }
+  return failed;
+}
+
+static float frame_level(const float *x)
+{
+  double e = 0;
+  for (int i = 0; i < FRAME_SIZE; i++)
+    e += (double)x[i] * x[i];
+  return (float)(10. * log10(1. + e / FRAME_SIZE));
+}
+
+static float snr(const float *ref, const float *x, int n)
+{
+  double s = 0, d = 0;
+  for (int i = 0; i < n; i++)
+  {
+    s += (double)ref[i] * ref[i];
+    d += (double)(x[i] - ref[i]) * (x[i] - ref[i]);
+  }
+  return d == 0 ? INFINITY : (float)(10. * log10((s + 1.) / d));
+}
+
+// One kernel level against another, frame by frame: before each frame the candidate state
+// is set to the reference state, so what is compared is one frame's rounding, not its
+// accumulation through the recurrent state
+static int lockstep(const char *model_path, int full_denoise, int ref_arch, int arch, const float *corpus,
+                    float *worst_snr, float *worst_vad)
+{
+  DenoiseState *ref = create(model_path, full_denoise);
+  DenoiseState *st = create(model_path, full_denoise);
+  float ref_out[FRAME_SIZE], out[FRAME_SIZE];
+  if (!ref || !st)
+  {
+    rnnoise_destroy(ref);
+    rnnoise_destroy(st);
+    return 1;
+  }
+  for (int f = 0; f < CORPUS_FRAMES; f++)
+  {
+    const RNNoise *model = st->model;
+    *st = *ref;
+    st->model = model;
+    rnn_arch = ref_arch;
+    float ref_vad = rnnoise_process_frame(ref, ref_out, &corpus[f * FRAME_SIZE]);
+    rnn_arch = arch;
+    float vad = rnnoise_process_frame(st, out, &corpus[f * FRAME_SIZE]);
+    *worst_snr = MIN(*worst_snr, snr(ref_out, out, FRAME_SIZE));
+    *worst_vad = MAX(*worst_vad, fabsf(vad - ref_vad));
+  }
+  rnnoise_destroy(ref);
+  rnnoise_destroy(st);
+  return 0;
+}
+
+// Every kernel level against every other, and the batched and 16-bit paths at each level
+static int cross_check(const char *label, const char *model_path, float *const *corpora, int max_arch)
+{
+  static RunResult results[CORPUS_COUNT];
+  int failed = 0;
+  for (int full = 0; full <= 1; full++)
+  {
+    for (int arch = RNN_ARCH_C; arch <= max_arch; arch++)
+    {
+      for (int c = 0; c < CORPUS_COUNT; c++)
+        if (run(model_path, full, arch, corpora[c], &results[c]))
+          return 1;
+      failed |= check_batch(label, model_path, full, arch, corpora, results);
+      failed |= check_s16(label, model_path, full, arch, corpora, results);
+    }
+    for (int a = RNN_ARCH_C; a <= max_arch; a++)
+    {
+      for (int b = a + 1; b <= max_arch; b++)
+      {
+        for (int c = 0; c < CORPUS_COUNT; c++)
+        {
+          float s = INFINITY, dv = 0;
+          if (lockstep(model_path, full, a, b, corpora[c], &s, &dv))
+            return 1;
+          if (s < CROSS_SNR_MIN || dv > CROSS_VAD_TOL)
+          {
+            printf("FAIL %s %s %s vs %s, %s: worst frame SNR %.1f dB, VAD diff %.4f\n", label, full ? "full" : "soft",
+                   arch_names[a], arch_names[b], corpus_names[c], s, dv);
+            failed = 1;
+          }
+        }
+      }
+    }
+  }
+  return failed;
+}
+
+// Golden vectors: per corpus, mode and frame, the output level in dB and the VAD probability
+static int golden(const char *path, float *const *corpora, int update)
+{
+  static RunResult r;
+  FILE *f = fopen(path, update ? "w" : "r");
+  if (!f)
+  {
+    fprintf(stderr, "cannot open %s\n", path);
+    return 1;
+  }
+  if (update)
+    fprintf(f, "# denoise_golden --update: corpus mode frame level_db vad (synthetic model, RNN_ARCH_C)\n");
+  else
+  {
+    int ch;
+    while ((ch = fgetc(f)) != '\n' && ch != EOF)
+      ;
+  }
+
+  int failed = 0, checked = 0;
+  float worst_level = 0, worst_vad = 0;
+  for (int full = 0; full <= 1 && !failed; full++)
+  {
+    for (int c = 0; c < CORPUS_COUNT && !failed; c++)
+    {
+      if (run(MODEL_PATH, full, RNN_ARCH_C, corpora[c], &r))
+      {
+        failed = 1;
+        break;
+      }
+      for (int frame = 0; frame < CORPUS_FRAMES; frame++)
+      {
+        float level = frame_level(&r.out[frame * FRAME_SIZE]);
+        if (update)
+        {
+          fprintf(f, "%s %s %d %.4f %.6f\n", corpus_names[c], full ? "full" : "soft", frame, level, r.vad[frame]);
+          continue;
+        }
+        char name[32], mode[8];
+        int gf;
+        float gl, gv;
+        if (fscanf(f, "%31s %7s %d %f %f", name, mode, &gf, &gl, &gv) != 5 || strcmp(name, corpus_names[c]) ||
+            strcmp(mode, full ? "full" : "soft") || gf != frame)
+        {
+          printf("FAIL %s: unexpected line for %s %s frame %d\n", path, corpus_names[c], full ? "full" : "soft", frame);
+          failed = 1;
+          break;
+        }
+        worst_level = MAX(worst_level, fabsf(level - gl));
+        worst_vad = MAX(worst_vad, fabsf(r.vad[frame] - gv));
+        if (fabsf(level - gl) > GOLDEN_LEVEL_TOL || fabsf(r.vad[frame] - gv) > GOLDEN_VAD_TOL)
+        {
+          printf("FAIL golden %s %s frame %d: level %.4f dB (golden %.4f), vad %.6f (golden %.6f)\n", corpus_names[c],
+                 full ? "full" : "soft", frame, level, gl, r.vad[frame], gv);
+          failed = 1;
+        }
+        checked++;
+      }
+    }
+  }
+  fclose(f);
+  if (update)
+    printf("wrote %s\n", path);
+  else if (!failed)
+    printf("golden: %d frames within tolerance (worst %.4f dB, VAD %.6f)\n", checked, worst_level, worst_vad);
+  return failed;
+}
+
+int main(int argc, char **argv)
+{
+  int update = argc == 3 && !strcmp(argv[1], "--update");
+  if (argc != 2 && !update)
+  {
+    fprintf(stderr, "usage: %s [--update] golden.txt\n", argv[0]);
+    return 2;
+  }
+
+  static float corpus_data[CORPUS_COUNT][CORPUS_SIZE];
+  float *corpora[CORPUS_COUNT];
+  for (int c = 0; c < CORPUS_COUNT; c++)
+  {
+    make_corpus((CorpusId)c, corpus_data[c]);
+    corpora[c] = corpus_data[c];
+  }
+  int err = write_synthetic_model();
+  if (err)
+  {
+    fprintf(stderr, "cannot write %s: %s\n", MODEL_PATH, rnn_model_strerror(err));
+    return 1;
+  }
+
+  const int max_arch = rnn_select_arch();
+  int failed = golden(argv[argc - 1], corpora, update);
+  if (!update)
+  {
+    failed |= cross_check("synthetic", MODEL_PATH, corpora, max_arch);
+    failed |= cross_check("built-in", NULL, corpora, max_arch);
+    printf("%s: %d corpora x soft/full, levels C..%s\n", failed ? "FAILED" : "kernel levels agree", CORPUS_COUNT,
+           arch_names[max_arch]);
+  }
+  remove(MODEL_PATH);
+  return failed;
+}
@@ -0,0 +1,67 @@
+// Writes the built-in network (rnnoise_data.c) as a model file for rnnoise_create_from_file(),
+// repacked into kernel order so the plugin can map it and use it in place.
+//
+//   export_model rnnoise.rnnm
+//   export_model --check rnnoise.rnnm     validate an existing file and print its layers
+//
+// Another model is shipped by building this tool against that model's rnnoise_data.c.
+#include <stdio.h>
+#include <string.h>
+
+#include "denoise.h"
+
+static int check(const char *path)
+{
+  RNNModelMap map;
+  RNNoise model;
+  int err = rnn_model_map(&map, path);
+  if (err == 0)
+    err = rnn_model_init(&model, map.data, map.size);
+  if (err != 0)
+  {
+    fprintf(stderr, "%s: %s\n", path, rnn_model_strerror(err));
+    rnn_model_unmap(&map);
+    return 1;
+  }
+  const RNNModelHeader *h = (const RNNModelHeader *)map.data;
+  const RNNModelLayer *entries = (const RNNModelLayer *)(map.data + h->header_size);
+  printf("%s: version %u, %zu bytes, crc32 %08x\n", path, h->version, map.size, h->checksum);
+  for (int i = 0; i < RNN_MODEL_LAYERS; i++)
+  {
+    const LinearLayer *layer = rnnoise_layer(&model, i);
+    printf("  %-15s %5d x %-5d %s%s%s\n", entries[i].name, layer->nb_inputs, layer->nb_outputs,
+           layer->weights_idx ? "sparse " : "", layer->weights ? "int8" : "float",
+           layer->panel_rows ? " panels" : "");
+  }
+  rnn_model_unmap(&map);
+  return 0;
+}
+
+int main(int argc, char **argv)
+{
+  if (argc == 3 && !strcmp(argv[1], "--check"))
+    return check(argv[2]);
+  if (argc != 2)
+  {
+    fprintf(stderr, "usage: %s model.rnnm | --check model.rnnm\n", argv[0]);
+    return 2;
+  }
+
+  RNNoise model;
+  if (init_rnnoise(&model, rnnoise_arrays) != 0 || rnnoise_repack(&model) != 0)
+  {
+    fprintf(stderr, "init_rnnoise failed\n");
+    return 1;
+  }
+  FILE *f = fopen(argv[1], "wb");
+  int err = f ? rnn_model_write(f, &model) : RNN_MODEL_ERR_IO;
+  if (f && fclose(f) != 0)
+    err = RNN_MODEL_ERR_IO;
+  rnnoise_free_packed(&model);
+  if (err != 0)
+  {
+    fprintf(stderr, "%s: %s\n", argv[1], rnn_model_strerror(err));
+    return 1;
+  }
+  return check(argv[1]);
+}
@@ -0,0 +1,87 @@
+// Bit-accuracy check of the SIMD FFT butterflies against the scalar ones: every kernel
+// level the CPU supports must give exactly the same bits as RNN_ARCH_C.
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "denoise.h"
+#include "x86cpu.h"
+
+#define RUNS 64
+
+static const char *arch_names[RNN_ARCH_COUNT] = {"C", "SSE4.1", "AVX2"};
+
+static float random_sample(unsigned int *seed)
+{
+  *seed = *seed * 1664525u + 1013904223u;
+  return ((float)(*seed >> 9) / 8388608.f - 1.f) * 32768.f;
+}
+
+static int check_complex(const char *name, const kiss_fft_state *st, int max_arch)
+{
+  kiss_fft_cpx in[WINDOW_SIZE], ref[WINDOW_SIZE], out[WINDOW_SIZE];
+  unsigned int seed = 1;
+  int failed = 0;
+  for (int run = 0; run < RUNS; run++)
+  {
+    for (int i = 0; i < st->nfft; i++)
+    {
+      in[i].r = random_sample(&seed);
+      in[i].i = random_sample(&seed);
+    }
+    rnn_arch = RNN_ARCH_C;
+    rnn_fft_c(st, in, ref);
+    for (int arch = RNN_ARCH_C + 1; arch <= max_arch && arch < RNN_ARCH_COUNT; arch++)
+    {
+      rnn_arch = arch;
+      rnn_fft_c(st, in, out);
+      if (memcmp(ref, out, (size_t)st->nfft * sizeof(out[0])) != 0)
+      {
+        printf("FAIL %s %s run %d\n", name, arch_names[arch], run);
+        failed = 1;
+      }
+    }
+  }
+  return failed;
+}
+
+static int check_real(int max_arch)
+{
+  float in[WINDOW_SIZE], ref_t[WINDOW_SIZE], out_t[WINDOW_SIZE];
+  kiss_fft_cpx ref[FREQ_SIZE], out[FREQ_SIZE];
+  unsigned int seed = 7;
+  int failed = 0;
+  for (int run = 0; run < RUNS; run++)
+  {
+    for (int i = 0; i < WINDOW_SIZE; i++)
+      in[i] = random_sample(&seed);
+    rnn_arch = RNN_ARCH_C;
+    rnn_fftr(&rnn_kfft_half, in, ref);
+    rnn_ifftr(&rnn_kfft_half, ref, ref_t);
+    for (int arch = RNN_ARCH_C + 1; arch <= max_arch && arch < RNN_ARCH_COUNT; arch++)
+    {
+      rnn_arch = arch;
+      rnn_fftr(&rnn_kfft_half, in, out);
+      rnn_ifftr(&rnn_kfft_half, ref, out_t);
+      if (memcmp(ref, out, sizeof(out)) != 0 || memcmp(ref_t, out_t, sizeof(out_t)) != 0)
+      {
+        printf("FAIL real %s run %d\n", arch_names[arch], run);
+        failed = 1;
+      }
+    }
+  }
+  return failed;
+}
+
+int main(void)
+{
+  int max_arch = rnn_select_arch();
+  if (max_arch >= RNN_ARCH_COUNT)
+    max_arch = RNN_ARCH_COUNT - 1;
+  int failed = check_complex("fft960", &rnn_kfft, max_arch);
+  failed |= check_complex("fft480", &rnn_kfft_half, max_arch);
+  failed |= check_real(max_arch);
+
+  printf("%s: %d runs per transform, levels C..%s\n", failed ? "FAILED" : "bit-exact", RUNS, arch_names[max_arch]);
+  return failed;
+}
@@ -0,0 +1,242 @@
+// Writes rnnoise_gen_tables.c: the FFT states with their twiddles, bit-reverse and SIMD
+// split-twiddle tables, the ERB band edges and the spectral denoiser's window. The library
+// only ever sees the generated constants, so creating a denoiser allocates nothing and calls
+// no transcendental math.
+//
+//   gen_tables > ../rnnoise_gen_tables.c
+//
+// The tables_current test fails when the checked-in file no longer matches this output.
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <string.h>
+
+#include "kiss_fft.h"
+#include "spectral.h"
+
+#define NFFT 960
+#define NFFT_16K (2 * SPECTRAL_FRAME_SIZE)
+#define NB_EDGES (NB_BANDS + 2)
+
+static const opus_int16 factors_full[2 * MAXFACTORS] = {5, 192, 3, 64, 4, 16, 4, 4, 4, 1};
+static const opus_int16 factors_half[2 * MAXFACTORS] = {5, 96, 3, 32, 4, 8, 2, 4, 4, 1};
+static const opus_int16 factors_16k[2 * MAXFACTORS] = {5, 32, 4, 8, 2, 4, 4, 1};
+
+static void compute_twiddles(int nfft, kiss_fft_cpx *twiddles)
+{
+  for (int i = 0; i < nfft; i++)
+  {
+    float phase = -2.0f * M_PIF * ((float)i / nfft);
+    twiddles[i].r = cosf(phase);
+    twiddles[i].i = sinf(phase);
+  }
+}
+
+static void compute_bitrev_table(int Fout, opus_int32 *f, const int fstride, int in_stride, const opus_int16 *factors)
+{
+  const int p = *factors++; /* the radix  */
+  const int m = *factors++; /* stage's fft length/p */
+
+  if (m == 1)
+  {
+    for (int j = 0; j < p; j++)
+    {
+      *f = Fout + j;
+      f += fstride * in_stride;
+    }
+  }
+  else
+  {
+    for (int j = 0; j < p; j++)
+    {
+      compute_bitrev_table(Fout, f, fstride * p, in_stride, factors);
+      f += fstride * in_stride;
+      Fout += m;
+    }
+  }
+}
+
+// ERB-spaced band edges in units of 50 Hz, from 20 kHz down (Glasberg & Moore), with
+// 700 Hz and 800 Hz merged into 750 Hz
+static void compute_eband20ms(int *asc)
+{
+  int v = 400;
+  for (int i = 0; i < NB_EDGES; i++)
+  {
+    double f_hz = v * 50.0;
+    double erb = 24.7 * (4.37 * f_hz / 1000.0 + 1.0);
+    int step = (int)round(erb / 50.0);
+    if (step < 2)
+      step = 2;
+    v -= step;
+    int index = NB_EDGES - 1 - i;
+    asc[index] = index >= 8 ? v + step : v;
+  }
+}
+
+// Power-complementary (Vorbis) window, so analysis plus synthesis windowing sums to one
+static void compute_half_window(int n, float *w)
+{
+  for (int i = 0; i < n; i++)
+  {
+    double s = sin(.5 * M_PI * (i + .5) / n);
+    w[i] = (float)sin(.5 * M_PI * s * s);
+  }
+}
+
+// A float literal that reads back as exactly v (%.9g round-trips every float)
+static const char *literal(char *buf, float v)
+{
+  sprintf(buf, "%.9g", v);
+  if (!strpbrk(buf, ".e"))
+    strcat(buf, ".0");
+  strcat(buf, "f");
+  return buf;
+}
+
+static void print_floats(const char *decl, const float *v, int n)
+{
+  char a[32];
+  printf("%s = {\n", decl);
+  for (int i = 0; i < n; i++)
+    printf("%s%s,%s", i % 6 == 0 ? "    " : "", literal(a, v[i]), i % 6 == 5 || i == n - 1 ? "\n" : " ");
+  printf("};\n");
+}
+
+static void print_cpx(const char *decl, const kiss_fft_cpx *v, int n)
+{
+  char a[32], b[32];
+  printf("%s = {\n", decl);
+  for (int i = 0; i < n; i++)
+    printf("%s{%s, %s},%s", i % 3 == 0 ? "    " : "", literal(a, (float)v[i].r), literal(b, (float)v[i].i), i % 3 == 2 || i == n - 1 ? "\n" : " ");
+  printf("};\n");
+}
+
+static void print_ints(const char *decl, const int *v, int n)
+{
+  printf("%s = {\n", decl);
+  for (int i = 0; i < n; i++)
+    printf("%s%d,%s", i % 12 == 0 ? "    " : "", v[i], i % 12 == 11 || i == n - 1 ? "\n" : " ");
+  printf("};\n");
+}
+
+static void print_state(const char *name, const char *comment, int nfft, const char *scale, int shift,
+                        const opus_int16 *factors, const char *bitrev, const char *twiddles, const char *split)
+{
+  printf("// %s\n", comment);
+  printf("const kiss_fft_state %s = {\n", name);
+  printf("    %d, // nfft\n", nfft);
+  printf("    %s, // scale\n", scale);
+  printf("    %d, // shift\n", shift);
+  printf("    {");
+  for (int i = 0; i < 2 * MAXFACTORS; i++)
+    printf("%d%s", factors[i], i + 1 < 2 * MAXFACTORS ? ", " : "");
+  printf("}, // factors\n");
+  printf("    %s, // bitrev\n", bitrev);
+  printf("    %s, // twiddles\n", twiddles);
+  printf("    %s // split_twiddles\n", split);
+  printf("};\n");
+}
+
+static float *split_table(kiss_fft_state *st, int *size)
+{
+  *size = rnn_fft_split_twiddles_size(st);
+  float *split = (float *)malloc((size_t)*size * sizeof(float));
+  if (split)
+    rnn_fft_split_twiddles(st, split);
+  return split;
+}
+
+int main(void)
+{
+  static kiss_fft_cpx twiddles[NFFT], twiddles_16k[NFFT_16K];
+  static opus_int32 bitrev_full[NFFT], bitrev_half[NFFT / 2], bitrev_16k[NFFT_16K / 2];
+  static float window_16k[SPECTRAL_FRAME_SIZE];
+  static int ints[NFFT];
+  int eband[NB_EDGES];
+  int split_full_size, split_half_size, split_16k_size;
+
+  compute_twiddles(NFFT, twiddles);
+  compute_twiddles(NFFT_16K, twiddles_16k);
+  compute_bitrev_table(0, bitrev_full, 1, 1, factors_full);
+  compute_bitrev_table(0, bitrev_half, 1, 1, factors_half);
+  compute_bitrev_table(0, bitrev_16k, 1, 1, factors_16k);
+  compute_eband20ms(eband);
+  compute_half_window(SPECTRAL_FRAME_SIZE, window_16k);
+
+  kiss_fft_state full = {NFFT, 1.f / NFFT, -1, {0}, bitrev_full, twiddles, NULL};
+  kiss_fft_state half = {NFFT / 2, 1.f / NFFT, 1, {0}, bitrev_half, twiddles, NULL};
+  kiss_fft_state half_16k = {NFFT_16K / 2, 1.f / NFFT_16K, 1, {0}, bitrev_16k, twiddles_16k, NULL};
+  for (int i = 0; i < 2 * MAXFACTORS; i++)
+  {
+    full.factors[i] = factors_full[i];
+    half.factors[i] = factors_half[i];
+    half_16k.factors[i] = factors_16k[i];
+  }
+  float *split_full = split_table(&full, &split_full_size);
+  float *split_half = split_table(&half, &split_half_size);
+  float *split_16k = split_table(&half_16k, &split_16k_size);
+  if (!split_full || !split_half || !split_16k)
+  {
+    fprintf(stderr, "out of memory\n");
+    return 1;
+  }
+
+  printf("// Generated by tools/gen_tables.c, do not edit.\n\n");
+  printf("#include \"denoise.h\"\n");
+  printf("#include \"spectral.h\"\n\n");
+
+  print_cpx("static const kiss_fft_cpx fft_twiddles[960]", twiddles, NFFT);
+  printf("\n");
+  for (int i = 0; i < NFFT; i++)
+    ints[i] = bitrev_full[i];
+  print_ints("static const opus_int32 fft_bitrev960[960]", ints, NFFT);
+  printf("\n");
+  for (int i = 0; i < NFFT / 2; i++)
+    ints[i] = bitrev_half[i];
+  print_ints("static const opus_int32 fft_bitrev480[480]", ints, NFFT / 2);
+  printf("\n");
+
+  char decl[96];
+  snprintf(decl, sizeof(decl), "static const float fft_split960[%d]", split_full_size);
+  print_floats(decl, split_full, split_full_size);
+  printf("\n");
+  snprintf(decl, sizeof(decl), "static const float fft_split480[%d]", split_half_size);
+  print_floats(decl, split_half, split_half_size);
+  printf("\n");
+
+  print_cpx("static const kiss_fft_cpx fft_twiddles320[320]", twiddles_16k, NFFT_16K);
+  printf("\n");
+  for (int i = 0; i < NFFT_16K / 2; i++)
+    ints[i] = bitrev_16k[i];
+  print_ints("static const opus_int32 fft_bitrev160[160]", ints, NFFT_16K / 2);
+  printf("\n");
+  snprintf(decl, sizeof(decl), "static const float fft_split160[%d]", split_16k_size);
+  print_floats(decl, split_16k, split_16k_size);
+  printf("\n");
+
+  print_state("rnn_kfft", "Complex 960-point FFT", NFFT, "0.0010416667f", -1, factors_full,
+              "fft_bitrev960", "fft_twiddles", "fft_split960");
+  printf("\n");
+  print_state("rnn_kfft_half", "Packed half-size FFT behind rnn_fftr/rnn_ifftr, scaled by 1/960 like the full transform",
+              NFFT / 2, "0.0010416667f", 1, factors_half,
+              "fft_bitrev480", "fft_twiddles", "fft_split480");
+  printf("\n");
+
+  print_state("rnn_kfft_16k", "Packed half-size FFT for the 320-point real transforms of the 16 kHz spectral denoiser",
+              NFFT_16K / 2, "0.003125f", 1, factors_16k,
+              "fft_bitrev160", "fft_twiddles320", "fft_split160");
+  printf("\n");
+
+  printf("// ERB-spaced band edges, in units of 50 Hz\n");
+  print_ints("const int eband20ms[NB_BANDS + 2]", eband, NB_EDGES);
+  printf("\n");
+
+  printf("// First half of the spectral denoiser's 320-point window\n");
+  print_floats("const float spectral_half_window[SPECTRAL_FRAME_SIZE]", window_16k, SPECTRAL_FRAME_SIZE);
+
+  free(split_full);
+  free(split_half);
+  free(split_16k);
+  return 0;
+}
@@ -0,0 +1,214 @@
+// PacketJitterBuffer playout against scripted packet sequences: wrapping sequence numbers and
+// timestamps, reordering, duplicates, late packets, an underrun, a sender restart (RESYNC_WINDOW), holes
+// and the maxSamples skip. Checks every Pop result, the frame contents and JitterStats.
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+#include "playback/jitterbuffer.h"
+
+using playback::JitterStats;
+using playback::PacketJitterBuffer;
+using playback::PlayoutFrame;
+
+#define FRAME 160 // samples per 10 ms frame, mono 16-bit
+
+static int failures = 0;
+
+#define CHECK(cond)                                                \
+  do                                                               \
+  {                                                                \
+    if (!(cond))                                                   \
+    {                                                              \
+      printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #cond);       \
+      failures++;                                                  \
+    }                                                              \
+  } while (0)
+
+// Every sample carries the low bits of its timestamp, so a frame shows where it came from
+static int16_t sample_at(uint32_t timestamp)
+{
+  return (int16_t)(timestamp & 0x7fff);
+}
+
+static bool add(PacketJitterBuffer &jb, uint16_t sequence, uint32_t timestamp, uint32_t samples = FRAME)
+{
+  std::vector<int16_t> pcm(samples);
+  for (uint32_t i = 0; i < samples; i++)
+    pcm[i] = sample_at(timestamp + i);
+  return jb.Add(sequence, timestamp, reinterpret_cast<const uint8_t *>(pcm.data()), samples * sizeof(int16_t));
+}
+
+static PlayoutFrame pop(PacketJitterBuffer &jb, int16_t *frame, uint32_t minSamples = FRAME, uint32_t maxSamples = 100 * FRAME)
+{
+  return jb.Pop(reinterpret_cast<uint8_t *>(frame), minSamples, maxSamples);
+}
+
+// Samples [from, to) of frame hold the stream from timestamp on, the rest is zero
+static bool frame_is(const int16_t *frame, uint32_t timestamp, int from = 0, int to = FRAME)
+{
+  for (int i = 0; i < FRAME; i++)
+  {
+    int16_t expected = i >= from && i < to ? sample_at(timestamp + i) : 0;
+    if (frame[i] != expected)
+      return false;
+  }
+  return true;
+}
+
+static void wrapping(void)
+{
+  PacketJitterBuffer jb(sizeof(int16_t), FRAME);
+  int16_t frame[FRAME];
+  const uint32_t start = 0xffffffffu - 3 * FRAME + 1; // the timestamp wraps in the fourth packet
+  for (int p = 0; p < 10; p++)
+    CHECK(add(jb, (uint16_t)(65530 + p), start + p * FRAME));
+  CHECK(jb.Buffered() == 0); // not playing yet
+
+  for (int p = 0; p < 10; p++)
+  {
+    CHECK(pop(jb, frame, 2 * FRAME) == PlayoutFrame::AUDIO);
+    CHECK(frame_is(frame, start + p * FRAME));
+    if (p == 0)
+      CHECK(jb.Buffered() == 9 * FRAME);
+  }
+  CHECK(pop(jb, frame) == PlayoutFrame::EMPTY);
+
+  JitterStats stats = jb.Stats();
+  CHECK(stats.received == 10 && stats.reordered == 0 && stats.late == 0 && stats.duplicate == 0 && stats.lostFrames == 0);
+}
+
+static void reordered_duplicate_late(void)
+{
+  PacketJitterBuffer jb(sizeof(int16_t), FRAME);
+  int16_t frame[FRAME];
+  CHECK(add(jb, 100, 1000));
+  CHECK(add(jb, 102, 1000 + 2 * FRAME));
+  CHECK(add(jb, 101, 1000 + FRAME));  // reordered
+  CHECK(!add(jb, 101, 1000 + FRAME)); // duplicate
+  CHECK(add(jb, 103, 1000 + 3 * FRAME));
+
+  CHECK(pop(jb, frame) == PlayoutFrame::AUDIO && frame_is(frame, 1000));
+  CHECK(pop(jb, frame) == PlayoutFrame::AUDIO && frame_is(frame, 1000 + FRAME));
+  CHECK(!add(jb, 104 - 1, 1000 + FRAME)); // already played out
+  CHECK(add(jb, 105, 1000 + 5 * FRAME));
+  CHECK(!add(jb, (uint16_t)(105 - REORDER_WINDOW), 1000 + 4 * FRAME)); // behind the reorder window
+  CHECK(pop(jb, frame) == PlayoutFrame::AUDIO && frame_is(frame, 1000 + 2 * FRAME));
+  CHECK(pop(jb, frame) == PlayoutFrame::AUDIO && frame_is(frame, 1000 + 3 * FRAME));
+  CHECK(pop(jb, frame) == PlayoutFrame::LOST && frame_is(frame, 1000 + 4 * FRAME, 0, 0)); // never arrived
+  CHECK(pop(jb, frame) == PlayoutFrame::AUDIO && frame_is(frame, 1000 + 5 * FRAME));
+
+  JitterStats stats = jb.Stats();
+  CHECK(stats.received == 5 && stats.reordered == 1 && stats.duplicate == 1 && stats.late == 2 && stats.lostFrames == 1);
+}
+
+static void holes(void)
+{
+  PacketJitterBuffer jb(sizeof(int16_t), FRAME);
+  int16_t frame[FRAME];
+  CHECK(add(jb, 0, 0));
+  CHECK(add(jb, 1, FRAME));
+  CHECK(add(jb, 3, 3 * FRAME));                // seq 2 lost
+  CHECK(add(jb, 4, 4 * FRAME, FRAME / 2));     // only the first half of the frame
+  CHECK(add(jb, 5, 5 * FRAME + FRAME / 2, FRAME / 2)); // the second half of the next one
+  CHECK(add(jb, 6, 6 * FRAME));
+
+  CHECK(pop(jb, frame) == PlayoutFrame::AUDIO && frame_is(frame, 0));
+  CHECK(pop(jb, frame) == PlayoutFrame::AUDIO && frame_is(frame, FRAME));
+  CHECK(pop(jb, frame) == PlayoutFrame::LOST && frame_is(frame, 2 * FRAME, 0, 0));
+  CHECK(pop(jb, frame) == PlayoutFrame::AUDIO && frame_is(frame, 3 * FRAME));
+  CHECK(pop(jb, frame) == PlayoutFrame::LOST && frame_is(frame, 4 * FRAME, 0, FRAME / 2));
+  CHECK(pop(jb, frame) == PlayoutFrame::LOST && frame_is(frame, 5 * FRAME, FRAME / 2, FRAME));
+  CHECK(pop(jb, frame) == PlayoutFrame::AUDIO && frame_is(frame, 6 * FRAME));
+  CHECK(pop(jb, frame) == PlayoutFrame::EMPTY);
+
+  // After the underrun, playout waits for minSamples again
+  CHECK(add(jb, 7, 7 * FRAME));
+  CHECK(pop(jb, frame, 2 * FRAME) == PlayoutFrame::EMPTY);
+  CHECK(add(jb, 8, 8 * FRAME));
+  CHECK(pop(jb, frame, 2 * FRAME) == PlayoutFrame::AUDIO && frame_is(frame, 7 * FRAME));
+
+  CHECK(jb.Stats().lostFrames == 3);
+  CHECK(!jb.Add(9, 9 * FRAME, reinterpret_cast<const uint8_t *>(frame), 3)); // not whole samples
+  CHECK(jb.Stats().received == 8);
+}
+
+static void underrun(void)
+{
+  PacketJitterBuffer jb(sizeof(int16_t), FRAME);
+  int16_t frame[FRAME];
+  CHECK(add(jb, 0, 0));
+  CHECK(add(jb, 1, FRAME));
+  CHECK(pop(jb, frame) == PlayoutFrame::AUDIO && frame_is(frame, 0));
+  CHECK(pop(jb, frame) == PlayoutFrame::AUDIO && frame_is(frame, FRAME));
+  CHECK(pop(jb, frame) == PlayoutFrame::EMPTY);
+
+  // While rebuffering, a reordered packet that was already played is still late; one that was
+  // not is where playout resumes
+  CHECK(!add(jb, 1, FRAME));
+  CHECK(add(jb, 3, 3 * FRAME));
+  CHECK(add(jb, 2, 2 * FRAME));
+  CHECK(pop(jb, frame, 2 * FRAME) == PlayoutFrame::AUDIO && frame_is(frame, 2 * FRAME));
+  CHECK(pop(jb, frame, 2 * FRAME) == PlayoutFrame::AUDIO && frame_is(frame, 3 * FRAME));
+  CHECK(pop(jb, frame, 2 * FRAME) == PlayoutFrame::EMPTY);
+
+  // A sender that went on off the frame grid: playout resumes at the next whole frame, not back
+  // at the packet's start
+  CHECK(add(jb, 5, 4 * FRAME + FRAME / 2));
+  CHECK(add(jb, 6, 5 * FRAME + FRAME / 2));
+  CHECK(add(jb, 7, 6 * FRAME + FRAME / 2));
+  CHECK(pop(jb, frame, 2 * FRAME) == PlayoutFrame::AUDIO && frame_is(frame, 5 * FRAME));
+  CHECK(pop(jb, frame, 2 * FRAME) == PlayoutFrame::AUDIO && frame_is(frame, 6 * FRAME));
+  CHECK(pop(jb, frame, 2 * FRAME) == PlayoutFrame::LOST && frame_is(frame, 7 * FRAME, 0, FRAME / 2));
+
+  JitterStats stats = jb.Stats();
+  CHECK(stats.received == 7 && stats.reordered == 1 && stats.late == 1 && stats.lostFrames == 1);
+}
+
+static void resync(void)
+{
+  PacketJitterBuffer jb(sizeof(int16_t), FRAME);
+  int16_t frame[FRAME];
+  for (int p = 0; p < 4; p++)
+    CHECK(add(jb, (uint16_t)(10 + p), 5000 + p * FRAME));
+  CHECK(pop(jb, frame) == PlayoutFrame::AUDIO && frame_is(frame, 5000));
+
+  // The sender restarted: a sequence jump of RESYNC_WINDOW and an unrelated timeline
+  const uint16_t sequence = 13 + RESYNC_WINDOW;
+  CHECK(add(jb, sequence, 90000));
+  CHECK(jb.Buffered() == 0); // the old stream is gone and playout buffers again
+  CHECK(pop(jb, frame, 2 * FRAME) == PlayoutFrame::EMPTY);
+  CHECK(add(jb, (uint16_t)(sequence + 1), 90000 + FRAME));
+  CHECK(pop(jb, frame, 2 * FRAME) == PlayoutFrame::AUDIO && frame_is(frame, 90000));
+  CHECK(pop(jb, frame, 2 * FRAME) == PlayoutFrame::AUDIO && frame_is(frame, 90000 + FRAME));
+  CHECK(jb.Stats().late == 0 && jb.Stats().lostFrames == 0);
+}
+
+static void skip_ahead(void)
+{
+  PacketJitterBuffer jb(sizeof(int16_t), FRAME);
+  int16_t frame[FRAME];
+  for (int p = 0; p < 10; p++)
+    CHECK(add(jb, (uint16_t)p, p * FRAME));
+  // 10 frames buffered, 3 allowed: whole frames are skipped until the frame played and the
+  // ones after it are 3
+  CHECK(pop(jb, frame, FRAME, 3 * FRAME) == PlayoutFrame::AUDIO && frame_is(frame, 7 * FRAME));
+  CHECK(jb.Buffered() == 2 * FRAME);
+  CHECK(jb.Stats().lostFrames == 0);
+
+  jb.Reset();
+  CHECK(jb.Stats().received == 0);
+  CHECK(pop(jb, frame) == PlayoutFrame::EMPTY);
+}
+
+int main(void)
+{
+  wrapping();
+  reordered_duplicate_late();
+  holes();
+  underrun();
+  resync();
+  skip_ahead();
+  printf("jitter buffer: %s\n", failures ? "FAILED" : "ok");
+  return failures ? 1 : 0;
+}
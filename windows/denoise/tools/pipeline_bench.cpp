@@ -0,0 +1,328 @@
+// Headless playback and capture: Player and Recorder on the virtual devices, on a simulated
+// clock (as fast as the machine allows) or in real time.
+//
+//   pipeline_bench [--realtime] [--denoise LEVEL] [--packets] [--jitter MS] [--loss PERCENT]
+//                  [--seconds S] [in.raw [out.raw]]
+//   pipeline_bench --check
+//
+// in.raw is 16 kHz mono s16, a synthetic voiced signal without it; out.raw gets what the
+// render device played. The stream goes out in 10 ms chunks that arrive up to --jitter ms
+// late: in order through AddChunk, or as numbered packets through AddPacket with --packets,
+// where --loss percent of them never arrive. The same signal is recorded from the virtual
+// capture device. --check plays and records a steady stream without denoising and fails
+// unless both come out bit for bit once playout has settled.
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "playback/player.h"
+#include "recording/recorder.h"
+#include "device/virtualdevice.h"
+
+#define CHUNK_SAMPLES 160 // 10 ms of the stream
+#define DRAIN_SECONDS 1   // played after the last chunk was sent
+
+struct Options
+{
+  bool realtime = false;
+  bool packets = false;
+  playback::DenoiseLevel level = playback::DenoiseLevel::NONE;
+  int jitterMs = 0;
+  int lossPercent = 0;
+  float seconds = 5.f;
+  const char *in = nullptr;
+  const char *out = nullptr;
+};
+
+struct Chunk
+{
+  uint16_t sequence;
+  uint64_t arrivalMs;
+  std::vector<uint8_t> data;
+};
+
+struct Result
+{
+  std::vector<int16_t> played;
+  uint64_t frames = 0;
+  uint64_t silentFrames = 0;
+  int gaps = 0; // periods that were not all stream once playout had started, before the drain
+  playback::JitterStats jitter = {};
+  std::vector<int16_t> recorded;
+  size_t vadFrames = 0;
+  double vadSum = 0;
+  double seconds = 0; // wall time
+};
+
+static uint32_t seed = 1;
+
+static uint32_t lcg(void)
+{
+  seed = seed * 1664525u + 1013904223u;
+  return seed >> 8;
+}
+
+// 140 Hz voiced signal with a slow level change and a little noise
+static std::vector<int16_t> synthetic(size_t samples)
+{
+  std::vector<int16_t> pcm(samples);
+  for (size_t i = 0; i < samples; i++)
+  {
+    float t = i / 16000.f;
+    float v = 0;
+    for (int h = 1; h <= 8; h++)
+      v += sinf(2 * (float)M_PI * 140.f * h * t) / h;
+    v *= 4000.f * (1.2f + sinf(2 * (float)M_PI * .7f * t));
+    v += (float)(lcg() % 401) - 200.f;
+    pcm[i] = (int16_t)std::max(-32768.f, std::min(32767.f, v));
+  }
+  return pcm;
+}
+
+static bool read_raw(const char *path, std::vector<int16_t> &pcm)
+{
+  FILE *file = fopen(path, "rb");
+  if (!file)
+    return false;
+  int16_t chunk[4096];
+  size_t read;
+  while ((read = fread(chunk, sizeof(int16_t), 4096, file)) > 0)
+    pcm.insert(pcm.end(), chunk, chunk + read);
+  fclose(file);
+  return true;
+}
+
+// When each chunk arrives: in order without --packets, as a socket delivers it
+static std::vector<Chunk> schedule(const std::vector<int16_t> &pcm, const Options &options)
+{
+  std::vector<Chunk> chunks;
+  uint64_t lastArrival = 0;
+  for (size_t start = 0; start + CHUNK_SAMPLES <= pcm.size(); start += CHUNK_SAMPLES)
+  {
+    Chunk chunk;
+    chunk.sequence = (uint16_t)(start / CHUNK_SAMPLES);
+    chunk.arrivalMs = start / 16 + (options.jitterMs ? lcg() % (options.jitterMs + 1) : 0);
+    if (!options.packets)
+      chunk.arrivalMs = lastArrival = std::max(lastArrival, chunk.arrivalMs);
+    else if (options.lossPercent && (int)(lcg() % 100) < options.lossPercent)
+      continue;
+    const uint8_t *bytes = reinterpret_cast<const uint8_t *>(&pcm[start]);
+    chunk.data.assign(bytes, bytes + CHUNK_SAMPLES * sizeof(int16_t));
+    chunks.push_back(std::move(chunk));
+  }
+  std::stable_sort(chunks.begin(), chunks.end(), [](const Chunk &a, const Chunk &b)
+                   { return a.arrivalMs < b.arrivalMs; });
+  return chunks;
+}
+
+static HRESULT run(const std::vector<int16_t> &pcm, const Options &options, Result &result)
+{
+  device::VirtualClock clock(!options.realtime);
+  auto render = std::make_unique<device::VirtualRenderDevice>(clock, options.out ? options.out : "");
+  device::VirtualRenderDevice *sink = render.get();
+  const uint8_t *bytes = reinterpret_cast<const uint8_t *>(pcm.data());
+  auto capture = std::make_unique<device::VirtualCaptureDevice>(
+      clock, std::vector<uint8_t>(bytes, bytes + pcm.size() * sizeof(int16_t)));
+
+  playback::Player player;
+  HRESULT hr = player.SetDenoise(options.level);
+  if (SUCCEEDED(hr))
+    hr = player.Start(std::move(render));
+  if (FAILED(hr))
+    return hr;
+
+  std::mutex recordMutex;
+  recording::Recorder recorder([&](const std::vector<uint8_t> &chunk, const std::vector<float> &vad)
+                               {
+    std::lock_guard<std::mutex> lock(recordMutex);
+    const int16_t *samples = reinterpret_cast<const int16_t *>(chunk.data());
+    result.recorded.insert(result.recorded.end(), samples, samples + chunk.size() / sizeof(int16_t));
+    result.vadFrames += vad.size();
+    for (float p : vad)
+      result.vadSum += p; });
+  hr = recorder.SetDenoise(options.level);
+  if (SUCCEEDED(hr))
+    hr = recorder.Start(std::move(capture));
+  if (FAILED(hr))
+  {
+    player.Dispose();
+    return hr;
+  }
+
+  const std::vector<Chunk> chunks = schedule(pcm, options);
+  const uint64_t sendPeriods = pcm.size() / CHUNK_SAMPLES;
+  const uint64_t periods = sendPeriods + DRAIN_SECONDS * 1000 / VIRTUAL_PERIOD_MS;
+  const auto start = std::chrono::steady_clock::now();
+  size_t next = 0;
+  bool started = false;
+  device::VirtualRenderStats last = {};
+
+  for (uint64_t period = 0; period < periods; period++)
+  {
+    const uint64_t nowMs = period * VIRTUAL_PERIOD_MS;
+    for (; next < chunks.size() && chunks[next].arrivalMs <= nowMs; next++)
+    {
+      if (options.packets)
+        player.AddPacket(chunks[next].sequence, chunks[next].sequence * CHUNK_SAMPLES, chunks[next].data);
+      else
+        player.AddChunk(chunks[next].data);
+    }
+
+    if (clock.IsSimulated())
+    {
+      // The denoise stage runs on its own poll, in real time: give it one pass before the
+      // device takes the next period
+      std::this_thread::sleep_for(std::chrono::milliseconds(DENOISE_POLL_MS + 1));
+      clock.Advance(VIRTUAL_PERIOD_MS * 1000);
+    }
+    else
+    {
+      std::this_thread::sleep_until(start + std::chrono::milliseconds(nowMs + VIRTUAL_PERIOD_MS));
+    }
+
+    device::VirtualRenderStats stats = sink->Stats();
+    if (started && period < sendPeriods && stats.silentFrames > last.silentFrames)
+      result.gaps++;
+    started = started || stats.silentFrames < stats.frames;
+    last = stats;
+  }
+
+  // The recorder's denoise thread may still hold the last chunks
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  player.GetJitterStats(&result.jitter);
+  recorder.Dispose();
+
+  // The simulated clock has stopped, so the sink does not play on; the player destroys it
+  std::vector<uint8_t> output = sink->Output();
+  const int16_t *samples = reinterpret_cast<const int16_t *>(output.data());
+  result.played.assign(samples, samples + output.size() / sizeof(int16_t));
+  device::VirtualRenderStats stats = sink->Stats();
+  result.frames = stats.frames;
+  result.silentFrames = stats.silentFrames;
+  player.Dispose();
+  return S_OK;
+}
+
+// Where pcm[at...] shows up in played, or -1
+static long find_lag(const std::vector<int16_t> &pcm, const std::vector<int16_t> &played, size_t at)
+{
+  for (size_t lag = 0; at + lag + CHUNK_SAMPLES <= played.size(); lag++)
+    if (memcmp(&played[at + lag], &pcm[at], CHUNK_SAMPLES * sizeof(int16_t)) == 0)
+      return (long)lag;
+  return -1;
+}
+
+static int check(void)
+{
+  Options options;
+  options.seconds = 6.f;
+  std::vector<int16_t> pcm = synthetic((size_t)(options.seconds * 16000));
+  Result result;
+  HRESULT hr = run(pcm, options, result);
+  if (FAILED(hr))
+  {
+    fprintf(stderr, "check: pipeline failed to start (0x%X)\n", (unsigned)hr);
+    return 1;
+  }
+
+  int failures = 0;
+  // Playout settles at rate 1 within a couple of seconds; from there on, unchanged
+  const size_t from = 3 * 16000, to = pcm.size() - 4 * CHUNK_SAMPLES;
+  long lag = find_lag(pcm, result.played, from);
+  size_t mismatched = 0;
+  for (size_t i = from; lag >= 0 && i < to; i++)
+    mismatched += i + lag >= result.played.size() || result.played[i + lag] != pcm[i];
+  if (lag < 0 || mismatched)
+  {
+    fprintf(stderr, "check: playback lag %ld, %zu samples differ\n", lag, mismatched);
+    failures++;
+  }
+  if (result.gaps)
+  {
+    fprintf(stderr, "check: %d playback gaps\n", result.gaps);
+    failures++;
+  }
+  if (result.recorded != pcm)
+  {
+    fprintf(stderr, "check: recorded %zu samples of %zu, not the source\n", result.recorded.size(), pcm.size());
+    failures++;
+  }
+  printf("pipeline check: lag %.1f ms, %s\n", lag / 16.f, failures ? "FAILED" : "ok");
+  return failures ? 1 : 0;
+}
+
+int main(int argc, char **argv)
+{
+  Options options;
+  int arg = 1;
+  for (; arg < argc && argv[arg][0] == '-'; arg++)
+  {
+    if (!strcmp(argv[arg], "--check"))
+      return check();
+    else if (!strcmp(argv[arg], "--realtime"))
+      options.realtime = true;
+    else if (!strcmp(argv[arg], "--packets"))
+      options.packets = true;
+    else if (!strcmp(argv[arg], "--denoise") && arg + 1 < argc)
+      options.level = static_cast<playback::DenoiseLevel>(atoi(argv[++arg]));
+    else if (!strcmp(argv[arg], "--jitter") && arg + 1 < argc)
+      options.jitterMs = atoi(argv[++arg]);
+    else if (!strcmp(argv[arg], "--loss") && arg + 1 < argc)
+      options.lossPercent = atoi(argv[++arg]);
+    else if (!strcmp(argv[arg], "--seconds") && arg + 1 < argc)
+      options.seconds = (float)atof(argv[++arg]);
+    else
+      break;
+  }
+  if (arg < argc && argv[arg][0] == '-')
+  {
+    fprintf(stderr, "usage: %s [--realtime] [--denoise LEVEL] [--packets] [--jitter MS] [--loss PERCENT]\n"
+                    "       [--seconds S] [in.raw [out.raw]] | --check\n",
+            argv[0]);
+    return 1;
+  }
+  if (arg < argc)
+    options.in = argv[arg++];
+  if (arg < argc)
+    options.out = argv[arg++];
+
+  std::vector<int16_t> pcm;
+  if (options.in && !read_raw(options.in, pcm))
+  {
+    fprintf(stderr, "%s: cannot read\n", options.in);
+    return 1;
+  }
+  if (!options.in)
+    pcm = synthetic((size_t)(options.seconds * 16000));
+
+  Result result;
+  HRESULT hr = run(pcm, options, result);
+  if (FAILED(hr))
+  {
+    fprintf(stderr, "pipeline failed to start (0x%X)\n", (unsigned)hr);
+    return 1;
+  }
+
+  const double streamSeconds = pcm.size() / 16000.0;
+  printf("stream      %.2f s in %.2f s (%.1fx real time)\n", streamSeconds, result.seconds,
+         streamSeconds / result.seconds);
+  printf("playback    %llu frames, %llu silent, %d gaps after playout started\n",
+         (unsigned long long)result.frames, (unsigned long long)result.silentFrames, result.gaps);
+  if (options.packets)
+    printf("packets     %llu received, %llu reordered, %llu late, %llu frames lost\n",
+           (unsigned long long)result.jitter.received, (unsigned long long)result.jitter.reordered,
+           (unsigned long long)result.jitter.late, (unsigned long long)result.jitter.lostFrames);
+  printf("capture     %zu samples of %zu", result.recorded.size(), pcm.size());
+  if (result.vadFrames)
+    printf(", mean speech probability %.3f", result.vadSum / result.vadFrames);
+  printf("\n");
+  return 0;
+}
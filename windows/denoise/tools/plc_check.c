@@ -0,0 +1,320 @@
+// Packet loss concealment, checked on what it has to get right: a loss of voiced audio is
+// filled with its pitch period (noise with the longest period), the joins (loss start, each
+// repetition of the period, the return to good frames) are continuous, the level fades to
+// silence after PLC_FADE_FRAMES + 1 frames, and good frames pass through a quarter frame late.
+#include <math.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "plc.h"
+
+#define MAX_FRAMES 64
+#define LEVEL 8000.f
+
+static int failures = 0;
+static char context[64];
+
+static void fail(const char *fmt, ...)
+{
+  va_list ap;
+  va_start(ap, fmt);
+  printf("FAIL %s: ", context);
+  vprintf(fmt, ap);
+  printf("\n");
+  va_end(ap);
+  failures++;
+}
+
+/* ---- Sources ---- */
+
+// Five harmonics of a period in samples (not necessarily whole), phases differing per channel,
+// with a tremolo of depth over a little more than four periods
+static void voiced(opus_int16 *x, int n, int channels, float period, float depth)
+{
+  for (int t = 0; t < n; t++)
+    for (int c = 0; c < channels; c++)
+    {
+      float v = 0;
+      for (int k = 1; k <= 5; k++)
+        v += sinf(2 * M_PIF * k * t / period + .7f * k * c) / k;
+      v *= 1.f + depth * sinf(2 * M_PIF * t / (4.37f * period));
+      x[t * channels + c] = (opus_int16)lrintf(LEVEL * .4f * v);
+    }
+}
+
+static void noise(opus_int16 *x, int n, int channels)
+{
+  unsigned int seed = 12345; // xorshift: consecutive values, so the channels, are uncorrelated
+  for (int i = 0; i < n * channels; i++)
+  {
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+    x[i] = (opus_int16)((int)(seed % 8001u) - 4000);
+  }
+}
+
+/* ---- A stream through the concealment ---- */
+
+// Output is stored by stream position: what plays sample p of the input is out[p], so a
+// frame's output lands delay samples before the frame
+typedef struct
+{
+  PlcState *st;
+  int channels, hop, delay;
+  const opus_int16 *in;
+  int frames;
+  int lost[MAX_FRAMES]; // how many frames in a row were lost up to this one, 0 if it arrived
+  int faded[MAX_FRAMES]; // plc_conceal() returned 0
+  opus_int16 out[MAX_FRAMES * FRAME_SIZE * PLC_MAX_CHANNELS];
+} Stream;
+
+static void stream_init(Stream *s, int channels, int hop, const opus_int16 *in)
+{
+  memset(s, 0, sizeof(*s));
+  s->st = plc_create(channels, hop);
+  s->channels = channels;
+  s->hop = hop;
+  s->delay = hop / 4;
+  s->in = in;
+}
+
+static void stream_frame(Stream *s, int arrived)
+{
+  opus_int16 frame[FRAME_SIZE * PLC_MAX_CHANNELS];
+  const int f = s->frames++;
+  const int n = s->hop * s->channels;
+  if (arrived)
+    plc_good(s->st, frame, &s->in[f * n]);
+  else
+  {
+    s->lost[f] = (f > 0 ? s->lost[f - 1] : 0) + 1;
+    s->faded[f] = !plc_conceal(s->st, frame);
+  }
+  const int skip = f == 0 ? s->delay * s->channels : 0; // before the stream started
+  memcpy(&s->out[f * n - s->delay * s->channels + skip], &frame[skip], (size_t)(n - skip) * sizeof(frame[0]));
+}
+
+static void stream_run(Stream *s, int arrived, int lost)
+{
+  for (int i = 0; i < arrived; i++)
+    stream_frame(s, 1);
+  for (int i = 0; i < lost; i++)
+    stream_frame(s, 0);
+}
+
+// Positions [from, to) of every channel
+static float rms(const opus_int16 *x, int channels, int from, int to)
+{
+  double e = 0;
+  for (int i = from * channels; i < to * channels; i++)
+    e += (double)x[i] * x[i];
+  return (float)sqrt(e / ((to - from) * channels));
+}
+
+static int max_step(const opus_int16 *x, int channels, int from, int to)
+{
+  int step = 0;
+  for (int p = from; p < to; p++)
+    for (int c = 0; c < channels; c++)
+    {
+      int d = x[p * channels + c] - x[(p - 1) * channels + c];
+      step = d > step ? d : -d > step ? -d : step;
+    }
+  return step;
+}
+
+/* ---- Checks ---- */
+
+// A voiced loss repeats the pitch period: with a whole-sample period the first concealed
+// frame is the signal that was lost, and the joins are as smooth as the signal
+static void check_period(int channels, int hop)
+{
+  static opus_int16 in[MAX_FRAMES * FRAME_SIZE * PLC_MAX_CHANNELS];
+  static Stream s;
+  const int period = hop / 2; // 200 Hz at the stream rate
+  voiced(in, 20 * hop + hop, channels, (float)period, 0);
+  stream_init(&s, channels, hop, in);
+  stream_run(&s, 20, 1);
+  const int period_size = s.st->period_size;
+  stream_run(&s, 1, 0);
+
+  if (period_size != period && period_size != 2 * period)
+    fail("repeats %d samples, the pitch period is %d", period_size, period);
+  const int start = 20 * hop, end = 21 * hop;
+  double err = 0, sig = 0;
+  for (int i = start * channels; i < end * channels; i++)
+  {
+    err += (double)(s.out[i] - in[i]) * (s.out[i] - in[i]);
+    sig += (double)in[i] * in[i];
+  }
+  float snr = (float)(10 * log10(sig / (err + 1)));
+  if (snr < 30.f)
+    fail("concealed frame is %.1f dB from the lost one", snr);
+  int step = max_step(s.out, channels, start - s.delay, end + hop / 2);
+  int ref = max_step(in, channels, start - s.delay, end + hop / 2);
+  if (step > ref + ref / 4)
+    fail("step of %d around the loss, the signal's is %d", step, ref);
+  plc_destroy(s.st);
+}
+
+// Largest second difference: a join that does not continue the waveform bends it
+static int max_bend(const opus_int16 *x, int channels, int from, int to)
+{
+  int bend = 0;
+  for (int p = from; p < to; p++)
+    for (int c = 0; c < channels; c++)
+    {
+      int d = x[(p + 1) * channels + c] - 2 * x[p * channels + c] + x[(p - 1) * channels + c];
+      bend = d > bend ? d : -d > bend ? -d : bend;
+    }
+  return bend;
+}
+
+// A period that is not a whole number of samples, under a tremolo, cannot repeat exactly: its
+// end is blended into its start so that every repetition joins without bending the waveform
+// more than the signal does, at the level of the period repeated
+static void check_seams(int channels, int hop)
+{
+  static opus_int16 in[MAX_FRAMES * FRAME_SIZE * PLC_MAX_CHANNELS];
+  static Stream s;
+  voiced(in, 23 * hop, channels, hop * .47f, .4f);
+  stream_init(&s, channels, hop, in);
+  stream_run(&s, 20, 1);
+  const int period = s.st->period_size;
+  stream_run(&s, 0, 2);
+
+  const int start = 20 * hop, end = 23 * hop - s.delay;
+  int bend = max_bend(s.out, channels, start - s.delay, end - 1);
+  int ref = max_bend(in, channels, start - s.delay, end - 1);
+  if (bend > ref + ref / 2)
+    fail("second difference of %d in the concealment (period %d), the signal's is %d", bend, period, ref);
+  float level = rms(s.out, channels, start, start + hop) / rms(in, channels, start - period, start);
+  if (level < .8f || level > 1.2f)
+    fail("concealment at %.2f of the repeated period's level", level);
+  plc_destroy(s.st);
+}
+
+// Without a pitch, the longest period is repeated, at the signal's level
+static void check_unvoiced(int channels, int hop)
+{
+  static opus_int16 in[MAX_FRAMES * FRAME_SIZE * PLC_MAX_CHANNELS];
+  static Stream s;
+  noise(in, 21 * hop, channels);
+  stream_init(&s, channels, hop, in);
+  stream_run(&s, 20, 1);
+  if (s.st->period_size != s.st->max_period)
+    fail("noise repeats %d samples, not the longest period %d", s.st->period_size, s.st->max_period);
+  float level = rms(s.out, channels, 20 * hop, 21 * hop - s.delay) / rms(in, channels, 20 * hop, 21 * hop);
+  if (level < .5f || level > 1.5f)
+    fail("concealed noise at %.2f of the signal's level", level);
+  plc_destroy(s.st);
+}
+
+// The fade: full level for one frame, then linearly to zero by the end of frame
+// PLC_FADE_FRAMES + 1, which is the last one plc_conceal() reports as audible. The first good
+// frame after silence ramps in over half a frame; later ones pass through unchanged.
+static void check_fade_and_return(int channels, int hop)
+{
+  static opus_int16 in[MAX_FRAMES * FRAME_SIZE * PLC_MAX_CHANNELS];
+  static Stream s;
+  const int loss = PLC_FADE_FRAMES + 4;
+  voiced(in, (20 + loss + 4) * hop, channels, (float)(hop / 2), 0);
+  stream_init(&s, channels, hop, in);
+  stream_run(&s, 20, loss);
+  stream_run(&s, 4, 0);
+  plc_destroy(s.st); // only its output is checked
+
+  int peak = 0;
+  for (int i = 0; i < 20 * hop * channels; i++)
+    peak = in[i] > peak ? in[i] : -in[i] > peak ? -in[i] : peak;
+  for (int f = 20; f < 20 + loss; f++)
+  {
+    if (s.faded[f] != (s.lost[f] > PLC_FADE_FRAMES + 1))
+      fail("plc_conceal() on lost frame %d returned %d", s.lost[f], !s.faded[f]);
+    for (int j = 0; j < hop; j++)
+    {
+      float envelope = s.lost[f] <= 1 ? 1.f : 1.f - (float)((s.lost[f] - 2) * hop + j + 1) / (PLC_FADE_FRAMES * hop);
+      envelope = envelope > 0 ? envelope : 0;
+      for (int c = 0; c < channels; c++)
+      {
+        int y = s.out[(f * hop + j) * channels + c];
+        if (abs(y) > envelope * peak + (envelope > 0))
+        {
+          fail("lost frame %d sample %d is %d, above the fade (%.3f of %d)", s.lost[f], j, y, envelope, peak);
+          return;
+        }
+      }
+    }
+  }
+
+  // Back from silence: a ramp into the input over half a frame, then the input itself
+  const int back = 20 + loss;
+  for (int j = 0; j < 4 * hop - s.delay; j++)
+    for (int c = 0; c < channels; c++)
+    {
+      int i = (back * hop + j) * channels + c;
+      int expected = j < hop / 2 ? (int)lrintf((float)(j + 1) / (hop / 2 + 1) * in[i]) : in[i];
+      if (abs(s.out[i] - expected) > (j < hop / 2))
+      {
+        fail("sample %d after the loss is %d, expected %d", j, s.out[i], expected);
+        return;
+      }
+    }
+
+  // Good frames before the loss: unchanged, up to the held-back quarter frame the period's
+  // end is blended into
+  for (int i = 0; i < (20 * hop - s.delay) * channels; i++)
+    if (s.out[i] != in[i])
+    {
+      fail("good sample %d is %d, input %d", i / channels, s.out[i], in[i]);
+      return;
+    }
+}
+
+// A single lost frame: the repetition hands back to the input without a jump
+static void check_short_loss(int channels, int hop)
+{
+  static opus_int16 in[MAX_FRAMES * FRAME_SIZE * PLC_MAX_CHANNELS];
+  static Stream s;
+  voiced(in, 24 * hop, channels, hop * .47f, 0);
+  stream_init(&s, channels, hop, in);
+  stream_run(&s, 20, 1);
+  stream_run(&s, 3, 0);
+  const int from = 21 * hop - s.delay, to = 21 * hop + hop / 2 + 1;
+  int step = max_step(s.out, channels, from, to);
+  int ref = max_step(in, channels, from, to);
+  if (step > ref + ref / 2)
+    fail("step of %d returning from a one-frame loss, the signal's is %d", step, ref);
+  for (int i = (21 * hop + hop / 2) * channels; i < (23 * hop - s.delay) * channels; i++)
+    if (s.out[i] != in[i])
+    {
+      fail("good sample %d after the crossfade is %d, input %d", i / channels, s.out[i], in[i]);
+      break;
+    }
+  plc_destroy(s.st);
+}
+
+int main(void)
+{
+  static const int hops[] = {160, 480};
+  if (plc_create(1, 240) || plc_create(PLC_MAX_CHANNELS + 1, 160))
+  {
+    snprintf(context, sizeof(context), "plc_create");
+    fail("unsupported hop or channel count accepted");
+  }
+  for (int h = 0; h < 2; h++)
+    for (int channels = 1; channels <= PLC_MAX_CHANNELS; channels++)
+    {
+      snprintf(context, sizeof(context), "hop %d, %s", hops[h], channels == 1 ? "mono" : "stereo");
+      check_period(channels, hops[h]);
+      check_seams(channels, hops[h]);
+      check_unvoiced(channels, hops[h]);
+      check_fade_and_return(channels, hops[h]);
+      check_short_loss(channels, hops[h]);
+    }
+  printf("plc: %s\n", failures ? "FAILED" : "ok");
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,161 @@
+// Contract check of the WSOLA time-stretcher for hop 160 and 480, mono and stereo: at rate 1
+// the output is the input bit for bit after the fade-in hop; at WSOLA_MIN_RATE and
+// WSOLA_MAX_RATE the output stays within the input's peak and level, and the input consumed
+// follows rate input samples per output sample.
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "wsola.h"
+
+#define HOPS 300
+#define PEAK 12000
+
+// Two harmonics and a slow vibrato, different per channel, so the similarity search has
+// periodic material to lock onto
+static opus_int16 input_sample(long i, int c, int hop)
+{
+  const float rate = hop * 100.f;
+  const float t = (float)i / rate;
+  const float f = (c ? 180.f : 130.f) * (1.f + .03f * sinf(2 * M_PIF * 3.f * t));
+  const float phase = 2 * M_PIF * f * t;
+  return (opus_int16)lrintf(PEAK * (.6f * sinf(phase) + .4f * sinf(2.f * phase + c)));
+}
+
+// Pushes what wsola_needed() asks for at rate, continuing the input from *pushed
+static void feed(WsolaState *st, float rate, long *pushed)
+{
+  opus_int16 in[WSOLA_BUF_SIZE * WSOLA_MAX_CHANNELS];
+  int n = wsola_needed(st, rate);
+  for (int i = 0; i < n; i++)
+    for (int c = 0; c < st->channels; c++)
+      in[i * st->channels + c] = input_sample(*pushed + i, c, st->hop);
+  wsola_push(st, in, n);
+  *pushed += n;
+}
+
+static int check_unity(int channels, int hop)
+{
+  opus_int16 out[WSOLA_MAX_HOP * WSOLA_MAX_CHANNELS];
+  WsolaState *st = wsola_create(channels, hop);
+  long pushed = 0;
+  int failed = 0;
+  for (int k = 0; k < HOPS && !failed; k++)
+  {
+    feed(st, 1.f, &pushed);
+    if (wsola_needed(st, 1.f) != 0)
+    {
+      printf("FAIL rate 1 hop %d channels %d: still needs input\n", hop, channels);
+      failed = 1;
+      break;
+    }
+    wsola_process(st, out, 1.f);
+    if (k == 0)
+      continue; // the fade-in
+    for (int i = 0; i < hop && !failed; i++)
+      for (int c = 0; c < channels; c++)
+        if (out[i * channels + c] != input_sample((long)k * hop + i, c, hop))
+        {
+          printf("FAIL rate 1 hop %d channels %d: output %d channel %d is %d, input %d\n", hop, channels,
+                 k * hop + i, c, out[i * channels + c], input_sample((long)k * hop + i, c, hop));
+          failed = 1;
+          break;
+        }
+  }
+  // One hop of lookahead beyond the hop being output
+  if (!failed && pushed != (long)(HOPS + 1) * hop)
+  {
+    printf("FAIL rate 1 hop %d channels %d: %ld samples pushed for %d hops\n", hop, channels, pushed, HOPS);
+    failed = 1;
+  }
+  wsola_destroy(st);
+  return failed;
+}
+
+static int check_stretch(int channels, int hop, float rate)
+{
+  opus_int16 out[WSOLA_MAX_HOP * WSOLA_MAX_CHANNELS];
+  WsolaState *st = wsola_create(channels, hop);
+  long pushed = 0;
+  double in_energy = 0, out_energy = 0;
+  int peak = 0, in_peak = 0;
+  int failed = 0;
+  for (int k = 0; k < HOPS; k++)
+  {
+    feed(st, rate, &pushed);
+    if (wsola_needed(st, rate) != 0)
+    {
+      printf("FAIL rate %.1f hop %d channels %d: still needs input\n", rate, hop, channels);
+      failed = 1;
+      break;
+    }
+    wsola_process(st, out, rate);
+    // The segment played starts within the search range of the nominal read position
+    long start = pushed - st->fill + st->prev;
+    double nominal = (double)k * rate * hop;
+    if (fabs((double)start - nominal) > st->search + 1)
+    {
+      printf("FAIL rate %.1f hop %d channels %d: hop %d read at %ld, nominal %.0f\n", rate, hop, channels, k, start,
+             nominal);
+      failed = 1;
+      break;
+    }
+    if (k == 0)
+      continue;
+    for (int i = 0; i < hop * channels; i++)
+    {
+      peak = abs(out[i]) > peak ? abs(out[i]) : peak;
+      out_energy += (double)out[i] * out[i];
+    }
+  }
+  for (long i = hop; i < (long)HOPS * hop; i++)
+    for (int c = 0; c < channels; c++)
+    {
+      int x = input_sample(i, c, hop);
+      in_peak = abs(x) > in_peak ? abs(x) : in_peak;
+      in_energy += (double)x * x;
+    }
+
+  // The overlap-add weights sum to one, so no sample can exceed the input peak
+  if (!failed && peak > in_peak + 1)
+  {
+    printf("FAIL rate %.1f hop %d channels %d: peak %d above the input's %d\n", rate, hop, channels, peak, in_peak);
+    failed = 1;
+  }
+  // Segments that continue each other keep the level; a bad match would cancel in the overlap
+  double level = sqrt(out_energy / in_energy);
+  if (!failed && (level < .9 || level > 1.1))
+  {
+    printf("FAIL rate %.1f hop %d channels %d: output level %.3f of the input's\n", rate, hop, channels, level);
+    failed = 1;
+  }
+  // Input consumed per output hop follows the rate, up to the lookahead kept in the buffer
+  double consumed = (double)pushed / ((double)HOPS * hop);
+  if (!failed && fabs(consumed - rate) > 3. / HOPS + (double)st->search / ((double)HOPS * hop))
+  {
+    printf("FAIL rate %.1f hop %d channels %d: %.4f input samples per output sample\n", rate, hop, channels, consumed);
+    failed = 1;
+  }
+  wsola_destroy(st);
+  return failed;
+}
+
+int main(void)
+{
+  static const int hops[] = {160, 480};
+  int failed = 0;
+  if (wsola_create(1, 240) || wsola_create(WSOLA_MAX_CHANNELS + 1, 160))
+  {
+    printf("FAIL unsupported hop or channel count accepted\n");
+    failed = 1;
+  }
+  for (int h = 0; h < 2; h++)
+    for (int channels = 1; channels <= WSOLA_MAX_CHANNELS; channels++)
+    {
+      failed |= check_unity(channels, hops[h]);
+      failed |= check_stretch(channels, hops[h], WSOLA_MIN_RATE);
+      failed |= check_stretch(channels, hops[h], WSOLA_MAX_RATE);
+    }
+  printf("wsola: %s\n", failed ? "FAILED" : "ok");
+  return failed;
+}
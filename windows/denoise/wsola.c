@@ -0,0 +1,130 @@
+#include <stdlib.h>
+#include <math.h>
+
+#include "denoise.h"
+#include "pcm.h"
+#include "pitch.h"
+#include "spectral.h"
+#include "wsola.h"
+#include "x86cpu.h"
+
+WsolaState *wsola_create(int channels, int hop)
+{
+  WsolaState *st;
+  if (channels < 1 || channels > WSOLA_MAX_CHANNELS || (hop != SPECTRAL_FRAME_SIZE && hop != FRAME_SIZE))
+    return NULL;
+  rnn_init_arch(); // the pitch correlation kernels
+  st = (WsolaState *)malloc(sizeof(WsolaState));
+  if (!st)
+    return NULL;
+  memset(st, 0, sizeof(WsolaState));
+  st->channels = channels;
+  st->hop = hop;
+  st->search = hop / 2;
+  // The existing power-complementary analysis windows: their squares sum to one at 50% overlap
+  st->half_window = hop == FRAME_SIZE ? rnn_half_window : spectral_half_window;
+  st->prev = -hop; // the first segment continues nothing: it starts the buffer
+  return st;
+}
+
+void wsola_destroy(WsolaState *st)
+{
+  free(st);
+}
+
+static float clamp_rate(float rate)
+{
+  return MAX(WSOLA_MIN_RATE, MIN(WSOLA_MAX_RATE, rate));
+}
+
+static int nominal_start(const WsolaState *st)
+{
+  return (int)floorf(st->nominal + .5f);
+}
+
+int wsola_needed(const WsolaState *st, float rate)
+{
+  int end = st->prev + 3 * st->hop; // the natural continuation, windowed
+  if (clamp_rate(rate) != 1.f)
+    end = MAX(end, nominal_start(st) + st->search + 2 * st->hop);
+  return MAX(end - st->fill, 0);
+}
+
+void wsola_push(WsolaState *st, const opus_int16 *in, int n)
+{
+  n = MIN(n, WSOLA_BUF_SIZE - st->fill);
+  for (int i = 0; i < n; i++)
+  {
+    float sum = 0;
+    for (int c = 0; c < st->channels; c++)
+    {
+      st->in[c][st->fill + i] = (float)in[i * st->channels + c];
+      sum += st->in[c][st->fill + i];
+    }
+    st->mix[st->fill + i] = sum;
+  }
+  st->fill += n;
+}
+
+// The segment start in [lo, hi] whose first hop is most like the natural continuation at
+// target, by normalized cross-correlation; the continuation itself wins when it is in range
+static int best_match(const WsolaState *st, int target, int lo, int hi)
+{
+  float xcorr[WSOLA_MAX_HOP + 1];
+  const int hop = st->hop;
+  const float *y = &st->mix[lo];
+  float energy = 0;
+  float best_score = -1e30f;
+  int best = lo;
+  rnn_xcorr(&st->mix[target], y, xcorr, hop, hi - lo + 1);
+  for (int i = 0; i < hop; i++)
+    energy += SQUARE(y[i]);
+  for (int k = 0; k <= hi - lo; k++)
+  {
+    float score = xcorr[k] / sqrtf(energy + 1.f);
+    if (score > best_score)
+    {
+      best_score = score;
+      best = lo + k;
+    }
+    energy += SQUARE(y[k + hop]) - SQUARE(y[k]);
+  }
+  return best;
+}
+
+void wsola_process(WsolaState *st, opus_int16 *out, float rate)
+{
+  const int hop = st->hop;
+  const float *w = st->half_window;
+  const int target = st->prev + hop;
+  int s = target;
+  rate = clamp_rate(rate);
+  if (rate != 1.f)
+  {
+    int c = nominal_start(st);
+    s = best_match(st, target, MAX(c - st->search, 0), c + st->search);
+  }
+
+  for (int ch = 0; ch < st->channels; ch++)
+  {
+    const float *x = &st->in[ch][s];
+    float *tail = st->tail[ch];
+    for (int i = 0; i < hop; i++)
+    {
+      out[i * st->channels + ch] = rnn_float2s16(tail[i] + SQUARE(w[i]) * x[i]);
+      tail[i] = SQUARE(w[hop - 1 - i]) * x[hop + i];
+    }
+  }
+  st->prev = s;
+  // At rate 1 the read position follows the segments, so nothing is stretched later
+  st->nominal = (rate == 1.f ? (float)s : st->nominal) + rate * hop;
+
+  // Drop the input no later search or continuation can reach
+  int keep = MAX(MIN(st->prev + hop, nominal_start(st) - st->search), 0);
+  for (int ch = 0; ch < st->channels; ch++)
+    RNN_MOVE(st->in[ch], &st->in[ch][keep], st->fill - keep);
+  RNN_MOVE(st->mix, &st->mix[keep], st->fill - keep);
+  st->fill -= keep;
+  st->prev -= keep;
+  st->nominal -= (float)keep;
+}
@@ -0,0 +1,67 @@
+#ifndef WSOLA_H
+#define WSOLA_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "rnn.h"
+
+/*
+ * WSOLA time-scale modification for playback latency control: the stream plays up to 10%
+ * faster or slower without a pitch change, so a jitter buffer can drain or refill without
+ * a jump or a gap. Each call outputs one hop (10ms: 160 samples at 16 kHz or 480 at 48 kHz)
+ * per channel. That hop is the windowed input segment nearest the nominal read position
+ * (which advances rate hops per call) whose start best continues the previous segment,
+ * overlap-added 50% with the previous one. At rate 1 the input comes out unchanged (the
+ * first hop fades in); a call needs one hop of input beyond the hop it outputs.
+ */
+#define WSOLA_MAX_CHANNELS 2
+#define WSOLA_MAX_HOP FRAME_SIZE
+#define WSOLA_BUF_SIZE (6 * WSOLA_MAX_HOP) // input kept per channel
+#define WSOLA_MIN_RATE .9f
+#define WSOLA_MAX_RATE 1.1f
+
+typedef struct
+{
+  int channels;
+  int hop;    // output samples per channel per call
+  int search; // candidate segments start within +-search of the nominal position
+  const float *half_window; // rising half of a power-complementary window; its square is the overlap-add window
+  float in[WSOLA_MAX_CHANNELS][WSOLA_BUF_SIZE];
+  float mix[WSOLA_BUF_SIZE]; // channel sum, for the similarity search
+  int fill;                  // input samples per channel in the buffers
+  int prev;                  // start of the last segment; its natural continuation is prev + hop
+  float nominal;             // where the next segment would start at the requested rates
+  float tail[WSOLA_MAX_CHANNELS][WSOLA_MAX_HOP]; // second half of the last windowed segment
+} WsolaState;
+
+/**
+ * hop is 160 (16 kHz) or 480 (48 kHz) and channels at most WSOLA_MAX_CHANNELS; NULL otherwise.
+ */
+WsolaState *wsola_create(int channels, int hop);
+
+void wsola_destroy(WsolaState *st);
+
+/**
+ * Input samples per channel still needed before wsola_process() can run at this rate.
+ */
+int wsola_needed(const WsolaState *st, float rate);
+
+/**
+ * Append n interleaved samples per channel. The buffer holds what wsola_needed() asks for
+ * plus one hop; more than that is dropped.
+ */
+void wsola_push(WsolaState *st, const opus_int16 *in, int n);
+
+/**
+ * One hop of interleaved output, reading input at rate (clamped to WSOLA_MIN_RATE..
+ * WSOLA_MAX_RATE) input samples per output sample. wsola_needed() must be 0.
+ */
+void wsola_process(WsolaState *st, opus_int16 *out, float rate);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* WSOLA_H */
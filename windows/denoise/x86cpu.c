@@ -0,0 +1,116 @@
+#include "x86cpu.h"
+
+#if defined(RNN_X86)
+#if defined(_MSC_VER)
+#include <intrin.h> // __cpuid, __cpuidex, _xgetbv
+#else
+#include <cpuid.h> // __get_cpuid_count
+#endif
+#endif
+
+#if defined(_WIN32)
+#include <windows.h> // INIT_ONCE
+#else
+#include <pthread.h> // pthread_once
+#endif
+
+int rnn_arch = RNN_ARCH_C;
+static int detected_arch = RNN_ARCH_C;
+
+#if defined(RNN_X86)
+static void cpuid(unsigned int leaf, unsigned int subleaf, unsigned int regs[4])
+{
+#if defined(_MSC_VER)
+   int info[4];
+   __cpuidex(info, (int)leaf, (int)subleaf);
+   regs[0] = (unsigned int)info[0];
+   regs[1] = (unsigned int)info[1];
+   regs[2] = (unsigned int)info[2];
+   regs[3] = (unsigned int)info[3];
+#else
+   if (!__get_cpuid_count(leaf, subleaf, &regs[0], &regs[1], &regs[2], &regs[3]))
+      regs[0] = regs[1] = regs[2] = regs[3] = 0;
+#endif
+}
+
+// XCR0 tells whether the OS saves the YMM registers on context switch
+static unsigned long long xgetbv0(void)
+{
+#if defined(_MSC_VER)
+   return _xgetbv(0);
+#else
+   unsigned int eax, edx;
+   __asm__ __volatile__("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+   return ((unsigned long long)edx << 32) | eax;
+#endif
+}
+
+static int detect_arch(void)
+{
+   unsigned int regs[4];
+   int arch = RNN_ARCH_C;
+
+   cpuid(0, 0, regs);
+   unsigned int max_leaf = regs[0];
+   if (max_leaf < 1)
+      return arch;
+
+   cpuid(1, 0, regs);
+   const int sse4_1 = (regs[2] >> 19) & 1;
+   const int fma = (regs[2] >> 12) & 1;
+   const int osxsave = (regs[2] >> 27) & 1;
+   const int avx = (regs[2] >> 28) & 1;
+   if (sse4_1)
+      arch = RNN_ARCH_SSE4_1;
+
+   if (!sse4_1 || !fma || !osxsave || !avx || max_leaf < 7)
+      return arch;
+   if ((xgetbv0() & 0x6) != 0x6) // XMM and YMM state
+      return arch;
+
+   cpuid(7, 0, regs);
+   if ((regs[1] >> 5) & 1) // AVX2
+      arch = RNN_ARCH_AVX2;
+   return arch;
+}
+#endif
+
+static void init_arch(void)
+{
+#if defined(RNN_X86)
+   detected_arch = detect_arch();
+#endif
+   rnn_arch = detected_arch;
+}
+
+#if defined(_WIN32)
+static INIT_ONCE arch_once = INIT_ONCE_STATIC_INIT;
+
+static BOOL CALLBACK init_arch_once(PINIT_ONCE once, PVOID param, PVOID *context)
+{
+   (void)once;
+   (void)param;
+   (void)context;
+   init_arch();
+   return TRUE;
+}
+
+void rnn_init_arch(void)
+{
+   InitOnceExecuteOnce(&arch_once, init_arch_once, NULL, NULL);
+}
+#else
+static pthread_once_t arch_once = PTHREAD_ONCE_INIT;
+
+void rnn_init_arch(void)
+{
+   pthread_once(&arch_once, init_arch);
+}
+#endif
+
+int rnn_select_arch(void)
+{
+   rnn_init_arch();
+   rnn_arch = detected_arch;
+   return rnn_arch;
+}
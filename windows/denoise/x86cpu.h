@@ -0,0 +1,41 @@
+#ifndef X86CPU_H
+#define X86CPU_H
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define RNN_X86 1
+#endif
+
+// Kernel levels, lowest first. Dispatch tables are indexed by rnn_arch.
+#define RNN_ARCH_C 0
+#define RNN_ARCH_SSE4_1 1
+#define RNN_ARCH_AVX2 2
+#define RNN_ARCH_COUNT 3
+
+// GCC/Clang only allow intrinsics inside functions built for that ISA; MSVC accepts them anywhere.
+#if defined(RNN_X86) && (defined(__GNUC__) || defined(__clang__))
+#define RNN_TARGET_SSE4_1 __attribute__((target("sse4.1")))
+#define RNN_TARGET_AVX2 __attribute__((target("avx,avx2,fma")))
+// AVX without FMA, for kernels that must round exactly like the scalar code
+#define RNN_TARGET_AVX __attribute__((target("avx")))
+#else
+#define RNN_TARGET_SSE4_1
+#define RNN_TARGET_AVX2
+#define RNN_TARGET_AVX
+#endif
+
+extern int rnn_arch;
+
+/**
+ * Set rnn_arch to the best kernel level supported by the CPU and OS, once per process and
+ * thread-safe. Every entry point that creates state for the dispatched kernels calls it, so
+ * rnn_arch is never written while another thread runs them.
+ */
+void rnn_init_arch(void);
+
+/**
+ * For tests and benchmarks: the rnn_init_arch level, stored again in rnn_arch (which they
+ * may have lowered) and returned. Not thread-safe.
+ */
+int rnn_select_arch(void);
+
+#endif /* X86CPU_H */
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <cstddef>	  // size_t
+#include <cstdint>	  // uint8_t, uint16_t, uint32_t
+#include <functional> // std::function
+
+#include "../platform.h" // HRESULT
+
+// The audio endpoints under Player and Recorder. On Windows they are WASAPI and Media
+// Foundation (windowsdevice.h); anywhere, the virtual devices (virtualdevice.h) play into and
+// capture from memory or a file on a real or simulated clock, so the whole pipeline runs
+// headless for tests and benchmarks.
+namespace device
+{
+	// Interleaved PCM
+	struct AudioFormat
+	{
+		uint32_t sampleRate;
+		uint16_t channels;
+		uint16_t bitsPerSample;
+
+		uint32_t BlockAlign() const { return channels * bitsPerSample / 8; }
+	};
+
+	// Called on the device's render thread with room for size bytes (whole frames): fills the
+	// buffer, silence included, and returns the bytes that came from the stream
+	using RenderCallback = std::function<size_t(uint8_t *buffer, size_t size)>;
+
+	class RenderDevice
+	{
+	public:
+		virtual ~RenderDevice() = default;
+
+		// format: what the stream would like; on return, what the device takes. Not thread-safe.
+		virtual HRESULT Open(AudioFormat &format, float bufferSeconds) = 0;
+
+		// Frames of the device buffer, once open
+		virtual uint32_t BufferFrames() = 0;
+
+		// Calls render from the device's own thread whenever the device has room, until Stop
+		virtual HRESULT Start(RenderCallback render) = 0;
+
+		// Joins the render thread; render is not called once this returns
+		virtual HRESULT Stop() = 0;
+
+		virtual HRESULT SetVolume(float volume) = 0;
+	};
+
+	// Called on the device's capture thread for every chunk of captured PCM. A failed status
+	// ends the capture and comes without data.
+	using CaptureCallback = std::function<void(HRESULT status, const uint8_t *data, size_t size)>;
+
+	class CaptureDevice
+	{
+	public:
+		virtual ~CaptureDevice() = default;
+
+		// Opens the endpoint for format and starts calling capture
+		virtual HRESULT Start(const AudioFormat &format, CaptureCallback capture) = 0;
+
+		virtual HRESULT Pause() = 0;
+		virtual HRESULT Resume() = 0;
+
+		// Closes the endpoint; capture is not called once this returns
+		virtual HRESULT Stop() = 0;
+	};
+}
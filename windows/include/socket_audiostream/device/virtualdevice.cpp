@@ -0,0 +1,249 @@
+#include <cmath>	// lrintf
+#include <cstring> // memcpy
+
+#include "virtualdevice.h"
+
+namespace device
+{
+	VirtualClock::VirtualClock(bool simulated)
+		: m_simulated(simulated),
+		  m_start(std::chrono::steady_clock::now()) {}
+
+	uint64_t VirtualClock::NowUs()
+	{
+		if (!m_simulated)
+			return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - m_start).count();
+		std::lock_guard<std::mutex> lock(m_mutex);
+		return m_nowUs;
+	}
+
+	void VirtualClock::Advance(uint64_t us)
+	{
+		if (!m_simulated)
+			return;
+		std::unique_lock<std::mutex> lock(m_mutex);
+		m_nowUs += us;
+		m_tick.notify_all();
+		// Done when every device waits again, and for a time still ahead
+		m_idle.wait(lock, [this]
+					{ return m_waiting.size() >= m_attached && (m_waiting.empty() || *m_waiting.begin() > m_nowUs); });
+	}
+
+	bool VirtualClock::WaitUntil(uint64_t us, const std::atomic<bool> &running)
+	{
+		std::unique_lock<std::mutex> lock(m_mutex);
+		if (!m_simulated)
+		{
+			m_tick.wait_until(lock, m_start + std::chrono::microseconds(us), [&running]
+							  { return !running; });
+			return running;
+		}
+		auto waiting = m_waiting.insert(us);
+		m_idle.notify_all();
+		m_tick.wait(lock, [this, us, &running]
+					{ return !running || m_nowUs >= us; });
+		m_waiting.erase(waiting);
+		return running;
+	}
+
+	void VirtualClock::Wake()
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_tick.notify_all();
+	}
+
+	void VirtualClock::Attach()
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_attached++;
+	}
+
+	void VirtualClock::Detach()
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_attached--;
+		m_idle.notify_all();
+	}
+
+	VirtualRenderDevice::VirtualRenderDevice(VirtualClock &clock, const std::string &path)
+		: m_clock(clock),
+		  m_path(path) {}
+
+	VirtualRenderDevice::~VirtualRenderDevice()
+	{
+		Stop();
+		if (m_file)
+			fclose(m_file);
+	}
+
+	HRESULT VirtualRenderDevice::Open(AudioFormat &format, float bufferSeconds)
+	{
+		if (format.BlockAlign() == 0 || format.sampleRate == 0)
+			return E_INVALIDARG;
+		if (!m_path.empty() && !m_file)
+		{
+			m_file = fopen(m_path.c_str(), "wb");
+			if (!m_file)
+				return E_FAIL;
+		}
+		m_format = format;
+		m_bufferFrames = static_cast<uint32_t>(format.sampleRate * bufferSeconds);
+		return S_OK;
+	}
+
+	uint32_t VirtualRenderDevice::BufferFrames() { return m_bufferFrames; }
+
+	HRESULT VirtualRenderDevice::Start(RenderCallback render)
+	{
+		if (m_bufferFrames == 0)
+			return E_FAIL;
+		Stop();
+		m_render = std::move(render);
+		m_running = true;
+		m_clock.Attach();
+		m_renderThread = std::thread(&VirtualRenderDevice::RenderThread, this);
+		return S_OK;
+	}
+
+	HRESULT VirtualRenderDevice::Stop()
+	{
+		m_running = false;
+		m_clock.Wake();
+		if (m_renderThread.joinable())
+			m_renderThread.join();
+		return S_OK;
+	}
+
+	HRESULT VirtualRenderDevice::SetVolume(float volume)
+	{
+		m_volume = volume;
+		return S_OK;
+	}
+
+	std::vector<uint8_t> VirtualRenderDevice::Output()
+	{
+		std::lock_guard<std::mutex> lock(m_outputMutex);
+		return m_output;
+	}
+
+	VirtualRenderStats VirtualRenderDevice::Stats()
+	{
+		std::lock_guard<std::mutex> lock(m_outputMutex);
+		return m_stats;
+	}
+
+	void VirtualRenderDevice::RenderThread()
+	{
+		const uint32_t blockAlign = m_format.BlockAlign();
+		const uint32_t periodFrames = m_format.sampleRate * VIRTUAL_PERIOD_MS / 1000;
+		std::vector<uint8_t> buffer(periodFrames * blockAlign);
+		const uint64_t startUs = m_clock.NowUs();
+
+		for (uint64_t period = 1; m_clock.WaitUntil(startUs + period * VIRTUAL_PERIOD_MS * 1000, m_running); period++)
+		{
+			size_t fromStream = m_render(buffer.data(), buffer.size());
+
+			const float volume = m_volume;
+			if (volume != 1.f && m_format.bitsPerSample == 16)
+			{
+				int16_t *samples = reinterpret_cast<int16_t *>(buffer.data());
+				for (size_t i = 0; i < buffer.size() / sizeof(int16_t); i++)
+					samples[i] = static_cast<int16_t>(lrintf(samples[i] * volume));
+			}
+
+			std::lock_guard<std::mutex> lock(m_outputMutex);
+			m_output.insert(m_output.end(), buffer.begin(), buffer.end());
+			m_stats.frames += periodFrames;
+			m_stats.silentFrames += periodFrames - fromStream / blockAlign;
+			if (m_file)
+				fwrite(buffer.data(), 1, buffer.size(), m_file);
+		}
+		m_clock.Detach();
+	}
+
+	VirtualCaptureDevice::VirtualCaptureDevice(VirtualClock &clock, std::vector<uint8_t> pcm, bool loop)
+		: m_clock(clock),
+		  m_pcm(std::move(pcm)),
+		  m_loop(loop) {}
+
+	VirtualCaptureDevice::VirtualCaptureDevice(VirtualClock &clock, const std::string &path, bool loop)
+		: m_clock(clock),
+		  m_path(path),
+		  m_loop(loop) {}
+
+	VirtualCaptureDevice::~VirtualCaptureDevice()
+	{
+		Stop();
+	}
+
+	HRESULT VirtualCaptureDevice::Start(const AudioFormat &format, CaptureCallback capture)
+	{
+		Stop();
+		if (!m_path.empty())
+		{
+			FILE *file = fopen(m_path.c_str(), "rb");
+			if (!file)
+				return E_FAIL;
+			m_pcm.clear();
+			uint8_t chunk[4096];
+			size_t read;
+			while ((read = fread(chunk, 1, sizeof(chunk), file)) > 0)
+				m_pcm.insert(m_pcm.end(), chunk, chunk + read);
+			fclose(file);
+		}
+		m_chunkBytes = format.sampleRate * VIRTUAL_PERIOD_MS / 1000 * format.BlockAlign();
+		if (m_chunkBytes == 0)
+			return E_INVALIDARG;
+
+		m_capture = std::move(capture);
+		m_paused = false;
+		m_finished = m_pcm.empty();
+		m_running = true;
+		m_clock.Attach();
+		m_captureThread = std::thread(&VirtualCaptureDevice::CaptureThread, this);
+		return S_OK;
+	}
+
+	HRESULT VirtualCaptureDevice::Pause()
+	{
+		m_paused = true;
+		return S_OK;
+	}
+
+	HRESULT VirtualCaptureDevice::Resume()
+	{
+		m_paused = false;
+		return S_OK;
+	}
+
+	HRESULT VirtualCaptureDevice::Stop()
+	{
+		m_running = false;
+		m_clock.Wake();
+		if (m_captureThread.joinable())
+			m_captureThread.join();
+		return S_OK;
+	}
+
+	void VirtualCaptureDevice::CaptureThread()
+	{
+		const uint64_t startUs = m_clock.NowUs();
+		size_t position = 0;
+
+		for (uint64_t period = 1; m_clock.WaitUntil(startUs + period * VIRTUAL_PERIOD_MS * 1000, m_running); period++)
+		{
+			if (m_finished)
+				continue;
+			size_t size = min(m_chunkBytes, m_pcm.size() - position);
+			if (!m_paused)
+				m_capture(S_OK, m_pcm.data() + position, size);
+			position += size;
+			if (position == m_pcm.size())
+			{
+				position = 0;
+				m_finished = !m_loop;
+			}
+		}
+		m_clock.Detach();
+	}
+}
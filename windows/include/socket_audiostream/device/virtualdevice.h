@@ -0,0 +1,131 @@
+#pragma once
+
+#include <atomic>			  // std::atomic
+#include <chrono>			  // std::chrono::steady_clock
+#include <condition_variable> // std::condition_variable
+#include <cstdio>			  // FILE
+#include <mutex>			  // std::mutex
+#include <set>				  // std::multiset
+#include <string>			  // std::string
+#include <thread>			  // std::thread
+#include <vector>			  // std::vector
+
+#include "audiodevice.h"
+
+#define VIRTUAL_PERIOD_MS 10 // how often a virtual device renders or captures
+
+namespace device
+{
+	// Time for the virtual devices. Real time, or simulated time that only moves in Advance,
+	// which returns once every device has handled the periods that fell due: the devices then
+	// run in lockstep with the caller, as fast as the machine allows.
+	class VirtualClock
+	{
+	public:
+		explicit VirtualClock(bool simulated);
+
+		bool IsSimulated() const { return m_simulated; }
+
+		// Microseconds since the clock was created
+		uint64_t NowUs();
+
+		// Simulated only: moves the clock on by us and waits for the devices to catch up
+		void Advance(uint64_t us);
+
+		// For the device threads: blocks until the clock reaches us, or until running is
+		// cleared and Wake is called; returns running
+		bool WaitUntil(uint64_t us, const std::atomic<bool> &running);
+		void Wake();
+
+		// Devices Advance waits for, from Start until their thread ends
+		void Attach();
+		void Detach();
+
+	private:
+		const bool m_simulated;
+		const std::chrono::steady_clock::time_point m_start;
+		std::mutex m_mutex;
+		std::condition_variable m_tick; // time moved on, or a device is stopping
+		std::condition_variable m_idle; // a device is waiting again, or left
+		uint64_t m_nowUs = 0;			// simulated time
+		size_t m_attached = 0;
+		std::multiset<uint64_t> m_waiting; // the times the attached devices wait for
+	};
+
+	struct VirtualRenderStats
+	{
+		uint64_t frames;	   // frames rendered
+		uint64_t silentFrames; // of those, frames the stream did not have ready
+	};
+
+	// Render device that plays into memory, and into a raw PCM file when path is given
+	class VirtualRenderDevice : public RenderDevice
+	{
+	public:
+		explicit VirtualRenderDevice(VirtualClock &clock, const std::string &path = std::string());
+		~VirtualRenderDevice() override;
+
+		// Takes any format as asked
+		HRESULT Open(AudioFormat &format, float bufferSeconds) override;
+		uint32_t BufferFrames() override;
+		HRESULT Start(RenderCallback render) override;
+		HRESULT Stop() override;
+		HRESULT SetVolume(float volume) override; // scales 16-bit output
+
+		// Everything rendered so far
+		std::vector<uint8_t> Output();
+		VirtualRenderStats Stats();
+
+	private:
+		void RenderThread();
+
+		VirtualClock &m_clock;
+		const std::string m_path;
+		FILE *m_file = nullptr;
+		AudioFormat m_format = {};
+		uint32_t m_bufferFrames = 0;
+		std::atomic<float> m_volume{1.f};
+
+		RenderCallback m_render;
+		std::atomic<bool> m_running{false};
+		std::thread m_renderThread;
+
+		std::mutex m_outputMutex;
+		std::vector<uint8_t> m_output;
+		VirtualRenderStats m_stats = {};
+	};
+
+	// Capture device that plays back PCM from memory, or from a raw PCM file read at Start, in
+	// chunks of VIRTUAL_PERIOD_MS. At the end it starts over when loop is set, otherwise it
+	// goes quiet. Time runs on while paused, as it does for a microphone.
+	class VirtualCaptureDevice : public CaptureDevice
+	{
+	public:
+		VirtualCaptureDevice(VirtualClock &clock, std::vector<uint8_t> pcm, bool loop = false);
+		VirtualCaptureDevice(VirtualClock &clock, const std::string &path, bool loop = false);
+		~VirtualCaptureDevice() override;
+
+		HRESULT Start(const AudioFormat &format, CaptureCallback capture) override;
+		HRESULT Pause() override;
+		HRESULT Resume() override;
+		HRESULT Stop() override;
+
+		// The whole source has been captured (never with loop)
+		bool Finished() { return m_finished; }
+
+	private:
+		void CaptureThread();
+
+		VirtualClock &m_clock;
+		const std::string m_path;
+		std::vector<uint8_t> m_pcm;
+		const bool m_loop;
+		size_t m_chunkBytes = 0;
+
+		CaptureCallback m_capture;
+		std::atomic<bool> m_running{false};
+		std::atomic<bool> m_paused{false};
+		std::atomic<bool> m_finished{false};
+		std::thread m_captureThread;
+	};
+}
@@ -0,0 +1,445 @@
+#include <mfapi.h>		 // MFStartup, MFCreateAttributes, MFCreateMediaType
+#include <mmdeviceapi.h> // IMMDeviceEnumerator, IMMDevice
+#include <system_error>	 // std::system_category
+
+#include "windowsdevice.h"
+#include "../utils.h" // SafeRelease
+
+namespace device
+{
+	WasapiRenderDevice::WasapiRenderDevice(const wchar_t *deviceId)
+		: m_deviceId(deviceId ? deviceId : L"") {}
+
+	WasapiRenderDevice::~WasapiRenderDevice()
+	{
+		Stop();
+		SafeRelease(m_renderClient);
+		SafeRelease(m_audioClient);
+		if (m_comInitialized)
+			CoUninitialize();
+	}
+
+	HRESULT WasapiRenderDevice::Open(AudioFormat &format, float bufferSeconds)
+	{
+		HRESULT hr = CoInitializeEx(NULL, COINIT_MULTITHREADED);
+		if (FAILED(hr))
+			return hr;
+		m_comInitialized = true;
+
+		IMMDeviceEnumerator *enumerator = nullptr;
+		hr = CoCreateInstance(__uuidof(MMDeviceEnumerator), NULL, CLSCTX_ALL,
+							  __uuidof(IMMDeviceEnumerator), (void **)&enumerator);
+
+		IMMDevice *device = nullptr;
+		if (SUCCEEDED(hr))
+		{
+			hr = !m_deviceId.empty() ? enumerator->GetDevice(m_deviceId.c_str(), &device) : enumerator->GetDefaultAudioEndpoint(eRender, eConsole, &device);
+		}
+
+		if (SUCCEEDED(hr))
+			hr = device->Activate(__uuidof(IAudioClient), CLSCTX_ALL, NULL, (void **)&m_audioClient);
+
+		WAVEFORMATEX *mixFormat = nullptr;
+		if (SUCCEEDED(hr))
+			hr = m_audioClient->GetMixFormat(&mixFormat);
+
+		WAVEFORMATEX desiredFormat = {};
+		if (SUCCEEDED(hr))
+		{
+			desiredFormat = *mixFormat;
+			desiredFormat.wFormatTag = WAVE_FORMAT_PCM;
+			desiredFormat.nChannels = format.channels;
+			desiredFormat.nSamplesPerSec = format.sampleRate;
+			desiredFormat.wBitsPerSample = format.bitsPerSample;
+			desiredFormat.nBlockAlign = (desiredFormat.nChannels * desiredFormat.wBitsPerSample) / 8;
+			desiredFormat.nAvgBytesPerSec = desiredFormat.nSamplesPerSec * desiredFormat.nBlockAlign;
+			desiredFormat.cbSize = 0;
+
+			REFERENCE_TIME soundBufferDuration = (REFERENCE_TIME)(REFTIMES_PER_SEC * bufferSeconds);
+			hr = m_audioClient->Initialize(AUDCLNT_SHAREMODE_SHARED,
+										   AUDCLNT_STREAMFLAGS_AUTOCONVERTPCM | AUDCLNT_STREAMFLAGS_SRC_DEFAULT_QUALITY,
+										   soundBufferDuration, 0, &desiredFormat, NULL);
+			if (FAILED(hr))
+			{
+				DebugPrint("Falling back to mixFormat\n");
+				desiredFormat = *mixFormat;
+				hr = m_audioClient->Initialize(AUDCLNT_SHAREMODE_SHARED,
+											   AUDCLNT_STREAMFLAGS_AUTOCONVERTPCM | AUDCLNT_STREAMFLAGS_SRC_DEFAULT_QUALITY,
+											   soundBufferDuration, 0, &desiredFormat, NULL);
+			}
+
+			DebugPrint("Device wFormatTag: %d, Channels: %d, nSamplesPerSec: %d, nBlockAlign: %u, nAvgBytesPerSec: %u, wBitsPerSample: %u, cbSize: %d\n",
+					   desiredFormat.wFormatTag, desiredFormat.nChannels, desiredFormat.nSamplesPerSec,
+					   desiredFormat.nBlockAlign, desiredFormat.nAvgBytesPerSec, desiredFormat.wBitsPerSample, desiredFormat.cbSize);
+		}
+
+		if (SUCCEEDED(hr))
+			hr = m_audioClient->GetService(__uuidof(IAudioRenderClient), (void **)&m_renderClient);
+
+		if (SUCCEEDED(hr))
+			hr = m_audioClient->GetBufferSize(&m_bufferFrameCount);
+
+		if (SUCCEEDED(hr))
+		{
+			format.sampleRate = desiredFormat.nSamplesPerSec;
+			format.channels = desiredFormat.nChannels;
+			format.bitsPerSample = desiredFormat.wBitsPerSample;
+			m_blockAlign = desiredFormat.nBlockAlign;
+		}
+
+		CoTaskMemFree(mixFormat);
+		SafeRelease(device);
+		SafeRelease(enumerator);
+		return hr;
+	}
+
+	uint32_t WasapiRenderDevice::BufferFrames() { return m_bufferFrameCount; }
+
+	HRESULT WasapiRenderDevice::Start(RenderCallback render)
+	{
+		if (!m_audioClient)
+			return E_FAIL;
+		m_render = std::move(render);
+		m_running = true;
+		m_renderThread = std::thread(&WasapiRenderDevice::RenderThread, this);
+		HRESULT hr = m_audioClient->Start();
+		if (FAILED(hr))
+			Stop();
+		return hr;
+	}
+
+	HRESULT WasapiRenderDevice::Stop()
+	{
+		m_running = false;
+		if (m_renderThread.joinable())
+			m_renderThread.join();
+		if (m_audioClient)
+			m_audioClient->Stop();
+		return S_OK;
+	}
+
+	HRESULT WasapiRenderDevice::SetVolume(float volume)
+	{
+		if (!m_audioClient)
+			return E_FAIL;
+		ISimpleAudioVolume *audioVolume = nullptr;
+		HRESULT hr = m_audioClient->GetService(__uuidof(ISimpleAudioVolume), (void **)&audioVolume);
+		if (SUCCEEDED(hr))
+		{
+			hr = audioVolume->SetMasterVolume(volume, NULL);
+			SafeRelease(audioVolume);
+		}
+		return hr;
+	}
+
+	void WasapiRenderDevice::RenderThread()
+	{
+		CoInitializeEx(NULL, COINIT_MULTITHREADED);
+
+		while (m_running)
+		{
+			UINT32 padding = 0;
+			if (FAILED(m_audioClient->GetCurrentPadding(&padding)))
+				continue;
+
+			UINT32 framesAvailable = m_bufferFrameCount - padding;
+			if (framesAvailable == 0)
+				continue;
+
+			BYTE *buffer = nullptr;
+			if (FAILED(m_renderClient->GetBuffer(framesAvailable, &buffer)))
+				continue;
+
+			m_render(buffer, framesAvailable * m_blockAlign);
+
+			m_renderClient->ReleaseBuffer(framesAvailable, 0);
+		}
+		CoUninitialize();
+	}
+
+	MfCaptureDevice::MfCaptureDevice(const wchar_t *deviceId)
+		: m_deviceId(deviceId ? deviceId : L""),
+		  m_LockCount(1),
+		  m_imfSource(NULL),
+		  m_imfReader(NULL),
+		  m_imfDescriptor(NULL)
+	{
+	}
+
+	MfCaptureDevice::~MfCaptureDevice()
+	{
+		Stop();
+	}
+
+	STDMETHODIMP MfCaptureDevice::QueryInterface(REFIID iid, void **ppv)
+	{
+		if (!ppv)
+			return E_POINTER;
+		*ppv = nullptr;
+		if (iid == __uuidof(IUnknown))
+		{
+			*ppv = static_cast<IUnknown *>(static_cast<IMFSourceReaderCallback *>(this));
+		}
+		else if (iid == __uuidof(IMFSourceReaderCallback))
+		{
+			*ppv = static_cast<IMFSourceReaderCallback *>(this);
+		}
+		else
+		{
+			return E_NOINTERFACE;
+		}
+		AddRef();
+		return S_OK;
+	}
+
+	STDMETHODIMP_(ULONG)
+	MfCaptureDevice::AddRef()
+	{
+		return InterlockedIncrement(&m_LockCount);
+	}
+
+	STDMETHODIMP_(ULONG)
+	MfCaptureDevice::Release()
+	{
+		ULONG uCount = InterlockedDecrement(&m_LockCount);
+		if (uCount == 0)
+		{
+			delete this;
+		}
+		return uCount;
+	}
+
+	STDMETHODIMP MfCaptureDevice::OnEvent(DWORD, IMFMediaEvent *)
+	{
+		return S_OK;
+	}
+
+	STDMETHODIMP MfCaptureDevice::OnFlush(DWORD)
+	{
+		return S_OK;
+	}
+
+	HRESULT MfCaptureDevice::OnReadSample(
+		HRESULT hrStatus,
+		DWORD dwStreamIndex,
+		DWORD dwStreamFlags,
+		LONGLONG llTimestamp,
+		IMFSample *imfSample)
+	{
+		HRESULT hr = S_OK;
+
+		if (SUCCEEDED(hrStatus))
+		{
+			if (imfSample)
+			{
+				hr = imfSample->SetSampleTime(llTimestamp);
+
+				if (SUCCEEDED(hr))
+				{
+					IMFMediaBuffer *pBuffer = NULL;
+					hr = imfSample->ConvertToContiguousBuffer(&pBuffer);
+
+					if (SUCCEEDED(hr))
+					{
+						BYTE *pChunk = NULL;
+						DWORD size = 0;
+						hr = pBuffer->Lock(&pChunk, NULL, &size);
+
+						if (SUCCEEDED(hr))
+						{
+							m_capture(S_OK, pChunk, size);
+							pBuffer->Unlock();
+						}
+						SafeRelease(pBuffer);
+					}
+				}
+			}
+
+			if (SUCCEEDED(hr) && m_imfReader)
+			{
+				hr = m_imfReader->ReadSample((DWORD)MF_SOURCE_READER_FIRST_AUDIO_STREAM,
+											 0, NULL, NULL, NULL, NULL);
+			}
+		}
+		else
+		{
+			auto errorText = std::system_category().message(hrStatus);
+			printf("Record: Error when reading sample (0x%X)\n%s\n", hrStatus, errorText.c_str());
+			m_capture(hrStatus, nullptr, 0);
+		}
+
+		return hr;
+	}
+
+	HRESULT MfCaptureDevice::Start(const AudioFormat &format, CaptureCallback capture)
+	{
+		HRESULT hr = Stop();
+		m_capture = std::move(capture);
+
+		if (SUCCEEDED(hr))
+		{
+			if (!m_imfStarted)
+			{
+				hr = MFStartup(MF_VERSION, MFSTARTUP_NOSOCKET);
+			}
+			if (SUCCEEDED(hr))
+			{
+				m_imfStarted = true;
+			}
+		}
+
+		if (SUCCEEDED(hr))
+		{
+			IMFAttributes *pAttributes = NULL;
+			hr = MFCreateAttributes(&pAttributes, 2);
+			// Enable speech processing mode for AEC, NS, AGC
+			pAttributes->SetUINT32(MF_AUDIO_RENDERER_ATTRIBUTE_FLAGS, MF_AUDIO_RENDERER_ATTRIBUTE_FLAG_ENABLE_VOICE);
+
+			// Set the device type to audio.
+			if (SUCCEEDED(hr))
+			{
+				hr = pAttributes->SetGUID(
+					MF_DEVSOURCE_ATTRIBUTE_SOURCE_TYPE,
+					MF_DEVSOURCE_ATTRIBUTE_SOURCE_TYPE_AUDCAP_GUID);
+			}
+
+			// Set the endpoint ID.
+			if (SUCCEEDED(hr) && !m_deviceId.empty())
+			{
+				hr = pAttributes->SetString(
+					MF_DEVSOURCE_ATTRIBUTE_SOURCE_TYPE_AUDCAP_ENDPOINT_ID,
+					m_deviceId.c_str());
+			}
+
+			// Create the source
+			if (SUCCEEDED(hr))
+			{
+				hr = MFCreateDeviceSource(pAttributes, &m_imfSource);
+			}
+			// Create presentation descriptor to handle Resume action
+			if (SUCCEEDED(hr))
+			{
+				hr = m_imfSource->CreatePresentationDescriptor(&m_imfDescriptor);
+			}
+
+			SafeRelease(pAttributes);
+		}
+		if (SUCCEEDED(hr))
+		{
+			IMFAttributes *pAttributes = NULL;
+			IMFMediaType *pMediaType = NULL;
+
+			hr = MFCreateAttributes(&pAttributes, 1);
+			if (SUCCEEDED(hr))
+			{
+				hr = pAttributes->SetUnknown(MF_SOURCE_READER_ASYNC_CALLBACK, this);
+			}
+			if (SUCCEEDED(hr))
+			{
+				hr = MFCreateSourceReaderFromMediaSource(m_imfSource, pAttributes, &m_imfReader);
+			}
+			if (SUCCEEDED(hr))
+			{
+				hr = MFCreateMediaType(&pMediaType);
+			}
+			if (SUCCEEDED(hr))
+			{
+				hr = pMediaType->SetGUID(MF_MT_MAJOR_TYPE, MFMediaType_Audio);
+			}
+			if (SUCCEEDED(hr))
+			{
+				hr = pMediaType->SetGUID(MF_MT_SUBTYPE, MFAudioFormat_PCM);
+			}
+			if (SUCCEEDED(hr))
+			{
+				hr = pMediaType->SetUINT32(MF_MT_AUDIO_BITS_PER_SAMPLE, format.bitsPerSample);
+			}
+			if (SUCCEEDED(hr))
+			{
+				hr = pMediaType->SetUINT32(MF_MT_AVG_BITRATE, 128000);
+			}
+			if (SUCCEEDED(hr))
+			{
+				hr = pMediaType->SetUINT32(MF_MT_AUDIO_SAMPLES_PER_SECOND, format.sampleRate);
+			}
+			if (SUCCEEDED(hr))
+			{
+				hr = pMediaType->SetUINT32(MF_MT_AUDIO_NUM_CHANNELS, format.channels);
+			}
+			if (SUCCEEDED(hr))
+			{
+				DebugPrint("MF_MT_AUDIO_SAMPLES_PER_SECOND: %u, MF_MT_AUDIO_NUM_CHANNELS:%u\n", format.sampleRate, format.channels);
+				hr = m_imfReader->SetCurrentMediaType(0, NULL, pMediaType);
+			}
+
+			SafeRelease(pMediaType);
+			SafeRelease(pAttributes);
+		}
+
+		if (SUCCEEDED(hr))
+		{
+			hr = m_imfReader->ReadSample((DWORD)MF_SOURCE_READER_FIRST_AUDIO_STREAM,
+										 0,
+										 NULL, NULL, NULL, NULL);
+		}
+
+		if (!SUCCEEDED(hr))
+		{
+			Stop();
+		}
+
+		return hr;
+	}
+
+	HRESULT MfCaptureDevice::Pause()
+	{
+		if (m_imfSource)
+			return m_imfSource->Pause();
+		return S_OK;
+	}
+
+	HRESULT MfCaptureDevice::Resume()
+	{
+		HRESULT hr = S_OK;
+
+		if (m_imfSource)
+		{
+			PROPVARIANT var;
+			PropVariantInit(&var);
+			var.vt = VT_EMPTY;
+
+			hr = m_imfSource->Start(m_imfDescriptor, NULL, &var);
+		}
+
+		return hr;
+	}
+
+	HRESULT MfCaptureDevice::Stop()
+	{
+		HRESULT hr = S_OK;
+		SafeRelease(m_imfReader);
+
+		if (m_imfSource)
+		{
+			hr = m_imfSource->Stop();
+
+			if (SUCCEEDED(hr))
+			{
+				hr = m_imfSource->Shutdown();
+			}
+		}
+
+		if (m_imfStarted)
+		{
+			hr = MFShutdown();
+			if (SUCCEEDED(hr))
+			{
+				m_imfStarted = false;
+			}
+		}
+
+		SafeRelease(m_imfSource);
+		SafeRelease(m_imfDescriptor);
+		return hr;
+	}
+}
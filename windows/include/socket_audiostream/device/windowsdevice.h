@@ -0,0 +1,80 @@
+#pragma once
+
+#include <Audioclient.h> // IAudioClient, IAudioRenderClient
+#include <mfidl.h>		 // IMFMediaSource, IMFSourceReader
+#include <Mfreadwrite.h> // IMFSourceReaderCallback
+
+#include <atomic> // std::atomic
+#include <string> // std::wstring
+#include <thread> // std::thread
+
+#include "audiodevice.h"
+
+#define REFTIMES_PER_SEC 10000000 // hundred nanoseconds
+#define MF_AUDIO_RENDERER_ATTRIBUTE_FLAG_ENABLE_VOICE 0x1
+
+namespace device
+{
+	// Shared-mode WASAPI render endpoint: the default console device, or deviceId
+	class WasapiRenderDevice : public RenderDevice
+	{
+	public:
+		explicit WasapiRenderDevice(const wchar_t *deviceId);
+		~WasapiRenderDevice() override;
+
+		HRESULT Open(AudioFormat &format, float bufferSeconds) override;
+		uint32_t BufferFrames() override;
+		HRESULT Start(RenderCallback render) override;
+		HRESULT Stop() override;
+		HRESULT SetVolume(float volume) override;
+
+	private:
+		void RenderThread();
+
+		std::wstring m_deviceId; // empty for the default device
+		bool m_comInitialized = false;
+		IAudioClient *m_audioClient = nullptr;
+		IAudioRenderClient *m_renderClient = nullptr;
+		uint32_t m_blockAlign = 0;
+		UINT32 m_bufferFrameCount = 0;
+
+		RenderCallback m_render;
+		std::atomic<bool> m_running{false};
+		std::thread m_renderThread;
+	};
+
+	// Media Foundation capture endpoint read asynchronously: the default device, or deviceId.
+	// Asks for voice processing (AEC, NS, AGC) where the driver has it.
+	class MfCaptureDevice : public CaptureDevice, public IMFSourceReaderCallback
+	{
+	public:
+		explicit MfCaptureDevice(const wchar_t *deviceId);
+		virtual ~MfCaptureDevice();
+
+		HRESULT Start(const AudioFormat &format, CaptureCallback capture) override;
+		HRESULT Pause() override;
+		HRESULT Resume() override;
+		HRESULT Stop() override;
+
+		// IUnknown methods
+		STDMETHODIMP QueryInterface(REFIID iid, void **ppv);
+		STDMETHODIMP_(ULONG)
+		AddRef();
+		STDMETHODIMP_(ULONG)
+		Release();
+
+		// IMFSourceReaderCallback methods
+		STDMETHODIMP OnReadSample(HRESULT hrStatus, DWORD dwStreamIndex, DWORD dwStreamFlags, LONGLONG llTimestamp, IMFSample *imfSample);
+		STDMETHODIMP OnEvent(DWORD, IMFMediaEvent *);
+		STDMETHODIMP OnFlush(DWORD);
+
+	private:
+		std::wstring m_deviceId; // empty for the default device
+		long m_LockCount;
+		IMFSourceReader *m_imfReader;
+		IMFMediaSource *m_imfSource;
+		IMFPresentationDescriptor *m_imfDescriptor;
+		bool m_imfStarted = false;
+		CaptureCallback m_capture;
+	};
+}
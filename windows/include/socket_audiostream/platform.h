@@ -0,0 +1,51 @@
+#pragma once
+
+// What the playback and capture pipelines need from the platform, so that they also build
+// off Windows (headless, with the virtual devices) without the Windows SDK or Flutter
+
+#include <cstdarg> // va_list
+#include <cstdint> // int32_t
+#include <cstdio>  // vprintf
+
+#ifdef _WIN32
+#include <windows.h> // HRESULT
+
+#ifndef min
+#define min(a, b) (((a) < (b)) ? (a) : (b))
+#endif
+#ifndef max
+#define max(a, b) (((a) > (b)) ? (a) : (b))
+#endif
+#else
+#include <algorithm> // std::min, std::max
+
+using std::max; // in place of the Windows macros
+using std::min;
+
+// The HRESULT subset the pipelines use
+typedef int32_t HRESULT;
+#define S_OK ((HRESULT)0)
+#define S_FALSE ((HRESULT)1)
+#define E_NOTIMPL ((HRESULT)0x80004001L)
+#define E_POINTER ((HRESULT)0x80004003L)
+#define E_FAIL ((HRESULT)0x80004005L)
+#define E_OUTOFMEMORY ((HRESULT)0x8007000EL)
+#define E_INVALIDARG ((HRESULT)0x80070057L)
+#define SUCCEEDED(hr) (((HRESULT)(hr)) >= 0)
+#define FAILED(hr) (((HRESULT)(hr)) < 0)
+#endif
+
+// Debug flag
+constexpr bool DEBUG = false;
+
+// Central debug logger
+inline void DebugPrint(const char *fmt, ...)
+{
+	if (!DEBUG)
+		return;
+	va_list args;
+	va_start(args, fmt);
+	vprintf(fmt, args);
+	va_end(args);
+	fflush(stdout);
+}
@@ -0,0 +1,167 @@
+#include <cstring> // memcpy, memset
+
+#include "jitterbuffer.h"
+
+namespace playback
+{
+	PacketJitterBuffer::PacketJitterBuffer(size_t bytesPerSample, uint32_t frameSamples)
+		: m_bytesPerSample(bytesPerSample),
+		  m_frameSamples(frameSamples) {}
+
+	void PacketJitterBuffer::Reset()
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		Clear();
+		m_stats = {};
+	}
+
+	void PacketJitterBuffer::Clear()
+	{
+		m_packets.clear();
+		m_synced = false;
+		m_playing = false;
+		m_started = false;
+	}
+
+	bool PacketJitterBuffer::Add(uint16_t sequence, uint32_t timestamp, const uint8_t *data, size_t size)
+	{
+		if (size == 0 || size % m_bytesPerSample != 0)
+			return false;
+
+		std::lock_guard<std::mutex> lock(m_mutex);
+		if (m_synced)
+		{
+			int delta = static_cast<int16_t>(sequence - static_cast<uint16_t>(m_highestSequence));
+			if (delta >= RESYNC_WINDOW)
+			{
+				Clear(); // a new stream: its timeline has nothing to do with the old one
+			}
+			else if (delta <= -REORDER_WINDOW)
+			{
+				m_stats.late++;
+				return false;
+			}
+		}
+
+		int64_t unwrapped;
+		bool reordered = false;
+		if (!m_synced)
+		{
+			unwrapped = timestamp;
+			m_lastTimestamp = unwrapped;
+			m_highestSequence = sequence;
+			m_synced = true;
+		}
+		else
+		{
+			unwrapped = m_lastTimestamp + static_cast<int32_t>(timestamp - static_cast<uint32_t>(m_lastTimestamp));
+			int delta = static_cast<int16_t>(sequence - static_cast<uint16_t>(m_highestSequence));
+			if (delta > 0)
+				m_highestSequence += delta;
+			reordered = delta < 0;
+			if (unwrapped > m_lastTimestamp)
+				m_lastTimestamp = unwrapped;
+		}
+
+		const int64_t samples = static_cast<int64_t>(size / m_bytesPerSample);
+		if (m_started && unwrapped + samples <= m_playout)
+		{
+			m_stats.late++;
+			return false;
+		}
+		if (m_packets.count(unwrapped))
+		{
+			m_stats.duplicate++;
+			return false;
+		}
+		m_packets.emplace(unwrapped, std::vector<uint8_t>(data, data + size));
+		m_stats.received++;
+		if (reordered)
+			m_stats.reordered++;
+		return true;
+	}
+
+	PlayoutFrame PacketJitterBuffer::Pop(uint8_t *frame, uint32_t minSamples, uint32_t maxSamples)
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		if (m_packets.empty())
+		{
+			m_playing = false; // underrun: buffer up to minSamples again
+			return PlayoutFrame::EMPTY;
+		}
+
+		const auto &newest = *m_packets.rbegin();
+		const int64_t newestEnd = newest.first + static_cast<int64_t>(newest.second.size() / m_bytesPerSample);
+		if (!m_playing)
+		{
+			// After an underrun, never back before what was played, and stay on the frame grid
+			int64_t start = m_packets.begin()->first;
+			if (m_started && start <= m_playout)
+				start = m_playout;
+			else if (m_started)
+				start = m_playout + (start - m_playout + m_frameSamples - 1) / m_frameSamples * m_frameSamples;
+			if (newestEnd - start < minSamples)
+				return PlayoutFrame::EMPTY;
+			m_playout = start;
+			m_playing = true;
+			m_started = true;
+		}
+		if (newestEnd - m_playout > maxSamples)
+		{
+			// Whole frames, so the timeline stays on the frame grid
+			int64_t excess = newestEnd - m_playout - maxSamples;
+			m_playout += (excess + m_frameSamples - 1) / m_frameSamples * m_frameSamples;
+		}
+
+		// Copy what the packets hold of [m_playout, end); the holes stay zero
+		const int64_t end = m_playout + m_frameSamples;
+		int64_t covered = 0;
+		memset(frame, 0, m_frameSamples * m_bytesPerSample);
+		auto it = m_packets.upper_bound(m_playout);
+		if (it != m_packets.begin())
+			--it; // the packet the frame starts in, if any
+		for (; it != m_packets.end() && it->first < end; ++it)
+		{
+			const int64_t first = it->first > m_playout ? it->first : m_playout;
+			const int64_t packetEnd = it->first + static_cast<int64_t>(it->second.size() / m_bytesPerSample);
+			const int64_t last = packetEnd < end ? packetEnd : end;
+			if (last <= first)
+				continue;
+			memcpy(frame + (first - m_playout) * m_bytesPerSample,
+				   it->second.data() + (first - it->first) * m_bytesPerSample,
+				   static_cast<size_t>(last - first) * m_bytesPerSample);
+			covered += last - first;
+		}
+		m_playout = end;
+
+		// Everything that ends before the playout point has been played or was skipped
+		while (!m_packets.empty())
+		{
+			const auto &oldest = *m_packets.begin();
+			if (oldest.first + static_cast<int64_t>(oldest.second.size() / m_bytesPerSample) > m_playout)
+				break;
+			m_packets.erase(m_packets.begin());
+		}
+
+		if (covered == m_frameSamples)
+			return PlayoutFrame::AUDIO;
+		m_stats.lostFrames++;
+		return PlayoutFrame::LOST;
+	}
+
+	uint32_t PacketJitterBuffer::Buffered()
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		if (!m_playing || m_packets.empty())
+			return 0;
+		const auto &newest = *m_packets.rbegin();
+		const int64_t newestEnd = newest.first + static_cast<int64_t>(newest.second.size() / m_bytesPerSample);
+		return newestEnd > m_playout ? static_cast<uint32_t>(newestEnd - m_playout) : 0;
+	}
+
+	JitterStats PacketJitterBuffer::Stats()
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		return m_stats;
+	}
+}
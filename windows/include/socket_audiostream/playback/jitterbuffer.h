@@ -0,0 +1,74 @@
+#pragma once
+
+#include <cstdint> // uint8_t, uint16_t, uint32_t, int64_t
+#include <map>	   // std::map
+#include <mutex>   // std::mutex
+#include <vector>  // std::vector
+
+#define REORDER_WINDOW 64	 // packets behind the newest sequence number that are still accepted
+#define RESYNC_WINDOW 1000 // a sequence jump this far ahead means the sender restarted
+
+namespace playback
+{
+	// What PacketJitterBuffer::Pop wrote into the frame
+	enum class PlayoutFrame
+	{
+		EMPTY = 0, // nothing was due: still buffering, or an underrun started a rebuffer
+		AUDIO = 1, // every sample came from a packet
+		LOST = 2   // loss marker: some or all samples never arrived and are zero
+	};
+
+	struct JitterStats
+	{
+		uint64_t received;	 // packets stored
+		uint64_t reordered;	 // stored although an older sequence number than the newest
+		uint64_t late;		 // dropped: already played out, or behind the reorder window
+		uint64_t duplicate;	 // dropped: the timestamp was already buffered
+		uint64_t lostFrames; // frames played with a loss marker
+	};
+
+	/*
+	 * Packet jitter buffer for senders that number their packets (RTP style): a 16-bit sequence
+	 * number and a 32-bit media timestamp in samples of the stream, both wrapping. Packets are
+	 * kept by timestamp, so reordering is undone and a duplicate is recognised. Playout follows
+	 * the timestamps instead of the byte count: each Pop plays the next 10ms frame on the
+	 * timeline, and a hole in it comes out as a LOST frame in place instead of shifting
+	 * everything after it. Add and Pop take a short lock; they may run on different threads.
+	 */
+	class PacketJitterBuffer
+	{
+	public:
+		// bytesPerSample: one sample of every channel; frameSamples: samples per 10ms frame
+		PacketJitterBuffer(size_t bytesPerSample, uint32_t frameSamples);
+
+		void Reset();
+
+		// Returns false when the packet is dropped as late, duplicate or malformed
+		bool Add(uint16_t sequence, uint32_t timestamp, const uint8_t *data, size_t size);
+
+		// One frame of frameSamples samples. Playout starts once minSamples are buffered, and
+		// skips ahead whole frames when more than maxSamples are.
+		PlayoutFrame Pop(uint8_t *frame, uint32_t minSamples, uint32_t maxSamples);
+
+		// Samples from the playout point to the end of the newest packet; 0 while not playing
+		uint32_t Buffered();
+
+		JitterStats Stats();
+
+	private:
+		void Clear();
+
+		std::mutex m_mutex;
+		const size_t m_bytesPerSample;
+		const uint32_t m_frameSamples;
+
+		std::map<int64_t, std::vector<uint8_t>> m_packets; // by unwrapped timestamp
+		bool m_synced = false;	 // m_lastTimestamp and m_highestSequence are set
+		bool m_playing = false;	 // m_playout is on the timeline
+		bool m_started = false;	 // m_playout is set: what ends before it has been played, even across an underrun
+		int64_t m_playout = 0;	 // unwrapped timestamp of the next sample to play
+		int64_t m_lastTimestamp = 0;	 // newest unwrapped timestamp, the reference for unwrapping
+		int64_t m_highestSequence = 0; // newest unwrapped sequence number
+		JitterStats m_stats = {};
+	};
+}
@@ -11,11 +11,14 @@ constexpr uint32_t kHasPermission = HashMethodName("hasPermission");
 constexpr uint32_t kStart = HashMethodName("start");
 constexpr uint32_t kStop = HashMethodName("stop");
 constexpr uint32_t kAddChunk = HashMethodName("addChunk");
+constexpr uint32_t kAddPacket = HashMethodName("addPacket");
 constexpr uint32_t kVolume = HashMethodName("volume");
 constexpr uint32_t kIsCreated = HashMethodName("isCreated");
 constexpr uint32_t kIsReady = HashMethodName("isReady");
 constexpr uint32_t kIsStereo = HashMethodName("isStereo");
 constexpr uint32_t kSetDenoise  = HashMethodName("setDenoise");
+constexpr uint32_t kDenoiseStats = HashMethodName("denoiseStats");
+constexpr uint32_t kJitterStats = HashMethodName("jitterStats");
 constexpr uint32_t kDispose = HashMethodName("dispose");
 constexpr uint32_t kJitter = HashMethodName("jitter");
 constexpr uint32_t kListDevices = HashMethodName("listDevices");
@@ -167,6 +170,34 @@ namespace playback
 			break;
 		}
 
+		case kAddPacket:
+		{
+			auto bytes_it = arguments->find(flutter::EncodableValue("bytes"));
+			if (bytes_it == arguments->end() || !std::holds_alternative<std::vector<uint8_t>>(bytes_it->second))
+			{
+				ErrorMessage("Missing or invalid 'bytes' parameter", *result);
+				return;
+			}
+			auto seq_it = arguments->find(flutter::EncodableValue("sequence"));
+			if (seq_it == arguments->end() || !std::holds_alternative<int>(seq_it->second))
+			{
+				ErrorMessage("Missing or invalid 'sequence' parameter", *result);
+				return;
+			}
+			// Dart sends timestamps above 2^31 as 64-bit integers
+			auto ts_it = arguments->find(flutter::EncodableValue("timestamp"));
+			if (ts_it == arguments->end() || !(std::holds_alternative<int>(ts_it->second) || std::holds_alternative<int64_t>(ts_it->second)))
+			{
+				ErrorMessage("Missing or invalid 'timestamp' parameter", *result);
+				return;
+			}
+			uint16_t sequence = static_cast<uint16_t>(std::get<int>(seq_it->second));
+			uint32_t timestamp = static_cast<uint32_t>(ts_it->second.LongValue());
+			const auto &bytes = std::get<std::vector<uint8_t>>(bytes_it->second);
+			hr = player->AddPacket(sequence, timestamp, bytes);
+			break;
+		}
+
 		case kVolume:
 		{
 			auto val = arguments->find(flutter::EncodableValue("value"));
@@ -224,12 +255,63 @@ namespace playback
 				return;
 			}
 			int level = std::get<int>(val->second);
-			if (level < 0 || level > 2) {
-				ErrorMessage("Invalid denoise level (expected 0=NONE, 1=SOFT, 2=FULL)", *result);
+			if (level < 0 || level > 3) {
+				ErrorMessage("Invalid denoise level (expected 0=NONE, 1=SOFT, 2=FULL, 3=LIGHT)", *result);
 				return;
 			}
-			player->SetDenoise(static_cast<DenoiseLevel>(level));
-			result->Success();
+			std::string model; // optional model file, see export_model
+			auto modelVal = arguments->find(flutter::EncodableValue("model"));
+			if (modelVal != arguments->end() && std::holds_alternative<std::string>(modelVal->second))
+				model = std::get<std::string>(modelVal->second);
+			int modelError = 0;
+			hr = player->SetDenoise(static_cast<DenoiseLevel>(level), model, &modelError);
+			if (FAILED(hr) && modelError != 0)
+			{
+				ErrorMessage("Failed to load denoise model " + model + ": " + rnn_model_strerror(modelError), *result);
+				return;
+			}
+			break;
+		}
+
+		case kDenoiseStats:
+		{
+			bool reset = false;
+			auto val = arguments->find(flutter::EncodableValue("reset"));
+			if (val != arguments->end() && std::holds_alternative<bool>(val->second))
+				reset = std::get<bool>(val->second);
+
+			RNNProfileStats stats[RNN_STAGE_COUNT];
+			if (FAILED(player->GetDenoiseStats(stats, reset)))
+			{
+				result->Success(); // no denoiser running, or a release build without counters
+				return;
+			}
+			EncodableMap stages;
+			for (int stage = 0; stage < RNN_STAGE_COUNT; stage++)
+			{
+				stages[EncodableValue(rnn_profile_stage_name(stage))] = EncodableValue(EncodableMap{
+					{EncodableValue("count"), EncodableValue(static_cast<int64_t>(stats[stage].count))},
+					{EncodableValue("p50"), EncodableValue(static_cast<int64_t>(stats[stage].p50))},
+					{EncodableValue("p99"), EncodableValue(static_cast<int64_t>(stats[stage].p99))},
+					{EncodableValue("max"), EncodableValue(static_cast<int64_t>(stats[stage].max))},
+					{EncodableValue("mean"), EncodableValue(stats[stage].mean)},
+				});
+			}
+			result->Success(EncodableValue(stages));
+			return;
+		}
+
+		case kJitterStats:
+		{
+			JitterStats stats;
+			player->GetJitterStats(&stats);
+			result->Success(EncodableValue(EncodableMap{
+				{EncodableValue("received"), EncodableValue(static_cast<int64_t>(stats.received))},
+				{EncodableValue("reordered"), EncodableValue(static_cast<int64_t>(stats.reordered))},
+				{EncodableValue("late"), EncodableValue(static_cast<int64_t>(stats.late))},
+				{EncodableValue("duplicate"), EncodableValue(static_cast<int64_t>(stats.duplicate))},
+				{EncodableValue("lostFrames"), EncodableValue(static_cast<int64_t>(stats.lostFrames))},
+			}));
 			return;
 		}
 
@@ -1,6 +1,9 @@
+#include <cstring> // memcpy, memset
+
 #include "player.h"
-#include "mediaplayer.h"
-#include "../utils.h"
+#ifdef _WIN32
+#include "../device/windowsdevice.h" // device::WasapiRenderDevice
+#endif
 
 namespace playback
 {
@@ -14,101 +17,65 @@ namespace playback
 	}
 
 	Player::Player() : m_shutdown(true),
-					   m_audioClient(nullptr),
-					   m_renderClient(nullptr),
-					   m_rnnoiseState(nullptr),
-					   m_denoiseLevel(DenoiseLevel::NONE) {}
+					   m_format(),
+					   m_bufferFrameCount(0),
+					   m_denoiseLevel(DenoiseLevel::NONE),
+					   m_rnnoiseStates(),
+					   m_spectralState(nullptr) {}
 
 	Player::~Player()
 	{
 		Dispose();
 	}
 
-	HRESULT Player::Start(std::string playerId, LPCWSTR deviceId)
+#ifdef _WIN32
+	HRESULT Player::Start(std::string playerId, const wchar_t *deviceId)
 	{
-		HRESULT hr = EndPlayback();
-		if (FAILED(hr))
-			return hr;
+		return Start(std::make_unique<device::WasapiRenderDevice>(deviceId));
+	}
+#endif
 
-		hr = CoInitializeEx(NULL, COINIT_MULTITHREADED);
+	// Plays through device from now on: WASAPI, or a virtual device for a headless run
+	HRESULT Player::Start(std::unique_ptr<device::RenderDevice> device)
+	{
+		HRESULT hr = EndPlayback();
 		if (FAILED(hr))
 			return hr;
+		if (!device)
+			return E_POINTER;
 
-		IMMDeviceEnumerator *enumerator = nullptr;
-		hr = CoCreateInstance(__uuidof(MMDeviceEnumerator), NULL, CLSCTX_ALL,
-							  __uuidof(IMMDeviceEnumerator), (void **)&enumerator);
-
-		IMMDevice *device = nullptr;
-		if (SUCCEEDED(hr))
-		{
-			hr = deviceId ? enumerator->GetDevice(deviceId, &device) : enumerator->GetDefaultAudioEndpoint(eRender, eConsole, &device);
-		}
-
-		if (SUCCEEDED(hr))
-			hr = device->Activate(__uuidof(IAudioClient), CLSCTX_ALL, NULL, (void **)&m_audioClient);
-
-		WAVEFORMATEX *mixFormat = nullptr;
-		if (SUCCEEDED(hr))
-			hr = m_audioClient->GetMixFormat(&mixFormat);
-
-		m_desiredFormat = *mixFormat;
 #ifdef STEREO
-		m_desiredFormat.nChannels = 2;
-		m_desiredFormat.nSamplesPerSec = 48000;
+		m_format = {48000, 2, 16};
 #else
-		m_desiredFormat.nChannels = 1;
-		m_desiredFormat.nSamplesPerSec = 16000;
+		m_format = {16000, 1, 16};
 #endif
-		m_desiredFormat.wFormatTag = WAVE_FORMAT_PCM;
-		m_desiredFormat.wBitsPerSample = 16;
-
-		// Set format to 48kHz mono for RNNoise compatibility
-		if (m_denoiseLevel != DenoiseLevel::NONE)
+		// Set format to 48kHz mono for RNNoise compatibility; the spectral denoiser keeps the 16kHz of the stream
+		if (m_denoiseLevel == DenoiseLevel::LIGHT)
 		{
-			m_desiredFormat.nSamplesPerSec = 48000;
+			m_format.sampleRate = 16000;
 		}
-		m_desiredFormat.nBlockAlign = (m_desiredFormat.nChannels * m_desiredFormat.wBitsPerSample) / 8;
-		m_desiredFormat.nAvgBytesPerSec = m_desiredFormat.nSamplesPerSec * m_desiredFormat.nBlockAlign;
-		m_desiredFormat.cbSize = 0;
-
-		REFERENCE_TIME soundBufferDuration = (REFERENCE_TIME)(REFTIMES_PER_SEC * BUFFER_SIZE_IN_SECONDS);
-		hr = m_audioClient->Initialize(AUDCLNT_SHAREMODE_SHARED,
-									   AUDCLNT_STREAMFLAGS_AUTOCONVERTPCM | AUDCLNT_STREAMFLAGS_SRC_DEFAULT_QUALITY,
-									   soundBufferDuration, 0, &m_desiredFormat, NULL);
-		if (FAILED(hr))
+		else if (m_denoiseLevel != DenoiseLevel::NONE)
 		{
-			DebugPrint("Falling back to mixFormat\n");
-			m_desiredFormat = *mixFormat;
-			hr = m_audioClient->Initialize(AUDCLNT_SHAREMODE_SHARED,
-										   AUDCLNT_STREAMFLAGS_AUTOCONVERTPCM | AUDCLNT_STREAMFLAGS_SRC_DEFAULT_QUALITY,
-										   soundBufferDuration, 0, &m_desiredFormat, NULL);
+			m_format.sampleRate = 48000;
 		}
 
-		DebugPrint("Device wFormatTag: %d, Channels: %d, nSamplesPerSec: %d, nBlockAlign: %u, nAvgBytesPerSec: %u, wBitsPerSample: %u, cbSize: %d, denoiseLevel: %d\n",
-				   m_desiredFormat.wFormatTag, m_desiredFormat.nChannels, m_desiredFormat.nSamplesPerSec,
-				   m_desiredFormat.nBlockAlign, m_desiredFormat.nAvgBytesPerSec, m_desiredFormat.wBitsPerSample, m_desiredFormat.cbSize, m_denoiseLevel);
-
-		if (SUCCEEDED(hr))
-			hr = m_audioClient->GetService(__uuidof(IAudioRenderClient), (void **)&m_renderClient);
-
-		if (SUCCEEDED(hr))
-			hr = m_audioClient->GetBufferSize(&m_bufferFrameCount);
+		hr = device->Open(m_format, BUFFER_SIZE_IN_SECONDS); // may fall back to another format
+		DebugPrint("Playback sampleRate: %u, channels: %u, bitsPerSample: %u, denoiseLevel: %d\n",
+				   m_format.sampleRate, m_format.channels, m_format.bitsPerSample, m_denoiseLevel);
 
 		if (SUCCEEDED(hr))
 		{
+			m_bufferFrameCount = device->BufferFrames();
+			m_device = std::move(device);
+			// Room for two device buffers; the denoise stage keeps about one of them ready
+			m_outputRing.Resize(2 * m_bufferFrameCount * m_format.BlockAlign());
+			m_jitterRing.Resize((m_maxJitterMs + JITTER_HEADROOM_MS) * STREAM_FRAME_SIZE * sizeof(int16_t) / 10);
 			m_shutdown = false;
-			m_playbackThread = std::thread(&Player::PlaybackThread, this);
+			m_denoiseThread = std::thread(&Player::DenoiseThread, this);
+			hr = m_device->Start([this](uint8_t *buffer, size_t size)
+								 { return Render(buffer, size); });
 		}
 
-		if (SUCCEEDED(hr))
-		{
-			hr = m_audioClient->Start();
-		}
-
-		CoTaskMemFree(mixFormat);
-		SafeRelease(device);
-		SafeRelease(enumerator);
-
 		if (FAILED(hr))
 			EndPlayback();
 
@@ -117,30 +84,38 @@ namespace playback
 
 	HRESULT Player::Stop() { return EndPlayback(); }
 	HRESULT Player::Dispose()
+	{
+		HRESULT hr = EndPlayback(); // no frame in flight once the threads are joined
+		DestroyDenoise();
+		return hr;
+	}
+
+	void Player::DestroyDenoise()
 	{
 		// Clean up RNNoise
-		if (m_rnnoiseState)
+		for (DenoiseState *&state : m_rnnoiseStates)
+		{
+			if (state)
+			{
+				rnnoise_destroy(state);
+				state = nullptr;
+			}
+		}
+		if (m_spectralState)
 		{
-			rnnoise_destroy(m_rnnoiseState);
-			m_rnnoiseState = nullptr;
+			spectral_destroy(m_spectralState);
+			m_spectralState = nullptr;
 		}
-		return EndPlayback();
 	}
 
 	HRESULT Player::SetVolume(float volume)
 	{
-		if (!m_audioClient)
+		if (!m_device)
 			return E_FAIL;
-		ISimpleAudioVolume *audioVolume = nullptr;
-		HRESULT hr = m_audioClient->GetService(__uuidof(ISimpleAudioVolume), (void **)&audioVolume);
-		if (SUCCEEDED(hr))
-		{
-			hr = audioVolume->SetMasterVolume(volume, NULL);
-			SafeRelease(audioVolume);
-		}
-		return hr;
+		return m_device->SetVolume(volume);
 	}
 
+	// Applies from the next frame; the jitter ring is sized from maxMs at the next Start
 	HRESULT Player::SetJitterRange(uint32_t minMs, uint32_t maxMs)
 	{
 		m_minJitterMs = minMs;
@@ -148,41 +123,118 @@ namespace playback
 		return S_OK;
 	}
 
+	// The only producer of the jitter ring: never waits. A chunk that does not fit is dropped
+	// whole (S_FALSE), so the stream stays sample aligned; the denoise stage polls for new data.
 	HRESULT Player::AddChunk(const std::vector<uint8_t> &data)
 	{
 		if (m_shutdown)
 			return E_FAIL;
-		std::lock_guard<std::mutex> lock(m_queueMutex);
-		m_jitterBuffer.insert(m_jitterBuffer.end(), data.begin(), data.end());
+		if (data.size() > m_jitterRing.Space())
+			return S_FALSE;
+		m_jitterRing.Write(data.data(), data.size());
 		return S_OK;
 	}
 
-	HRESULT Player::SetDenoise(DenoiseLevel level)
+	// For senders that number their packets: played by timestamp from the packet jitter buffer,
+	// see PacketJitterBuffer. A packet dropped as late or duplicate gives S_FALSE. A session
+	// uses either AddChunk or AddPacket; the first packet switches the player over until Stop.
+	HRESULT Player::AddPacket(uint16_t sequence, uint32_t timestamp, const std::vector<uint8_t> &data)
 	{
-		std::lock_guard<std::mutex> lock(m_queueMutex);
-		m_shutdown = true; // Signal playback thread to exit (required calling Start again)
+		if (m_shutdown)
+			return E_FAIL;
+		m_packetMode = true;
+		return m_packetBuffer.Add(sequence, timestamp, data.data(), data.size()) ? S_OK : S_FALSE;
+	}
 
-		if (m_rnnoiseState)
+	// modelPath: UTF-8 path of a model file (export_model); empty for the built-in network, unused by LIGHT
+	HRESULT Player::SetDenoise(DenoiseLevel level, const std::string &modelPath, int *modelError)
+	{
+#ifdef STEREO
+		if (level == DenoiseLevel::LIGHT)
 		{
-			rnnoise_destroy(m_rnnoiseState);
-			m_rnnoiseState = nullptr;
+			DebugPrint("ERROR: Light denoise needs the 16kHz mono stream\n");
+			return E_NOTIMPL; // the current denoiser stays
 		}
-
-		if (level != DenoiseLevel::NONE)
+#endif
+		// The new states are built first: on a failure the current denoiser and level stay
+		DenoiseState *rnnoiseStates[DENOISE_CHANNELS] = {};
+		SpectralState *spectralState = nullptr;
+		if (level == DenoiseLevel::LIGHT)
 		{
-			m_rnnoiseState = rnnoise_create(level == DenoiseLevel::FULL ? 1 : 0);
-			if (!m_rnnoiseState)
+			spectralState = spectral_create();
+			if (!spectralState)
 			{
-				DebugPrint("ERROR: Failed to create RNNoise state for level %d\n", (int)level);
+				DebugPrint("ERROR: Failed to create spectral denoiser state\n");
 				return E_FAIL;
 			}
 		}
+		else if (level != DenoiseLevel::NONE)
+		{
+			int fullDenoise = level == DenoiseLevel::FULL ? 1 : 0;
+			for (DenoiseState *&state : rnnoiseStates)
+			{
+				int error = 0;
+				if (modelPath.empty())
+					state = rnnoise_create(fullDenoise);
+				else
+					state = rnnoise_create_from_file(modelPath.c_str(), fullDenoise, &error); // one shared mapping
+				if (!state)
+				{
+					if (error != 0)
+					{
+						DebugPrint("ERROR: Failed to load RNNoise model %s: %s\n", modelPath.c_str(), rnn_model_strerror(error));
+						if (modelError)
+							*modelError = error;
+					}
+					else
+						DebugPrint("ERROR: Failed to create RNNoise state for level %d\n", (int)level);
+					for (DenoiseState *created : rnnoiseStates)
+						if (created)
+							rnnoise_destroy(created);
+					return E_FAIL;
+				}
+			}
+		}
+
+		std::lock_guard<std::mutex> lock(m_denoiseMutex);
+		m_shutdown = true; // Signal playback thread to exit (required calling Start again)
+
+		DestroyDenoise();
+		for (int c = 0; c < DENOISE_CHANNELS; c++)
+			m_rnnoiseStates[c] = rnnoiseStates[c];
+		m_spectralState = spectralState;
 
 		m_denoiseLevel = level;
 		return S_OK;
 	}
 
-	bool Player::IsCreated() { return m_audioClient != nullptr; }
+	// Per-stage frame timings of the first channel's RNNoise state; E_NOTIMPL when profiling is compiled out
+	HRESULT Player::GetDenoiseStats(RNNProfileStats stats[RNN_STAGE_COUNT], bool reset)
+	{
+		std::lock_guard<std::mutex> lock(m_denoiseMutex); // frames are processed under this lock
+		if (!m_rnnoiseStates[0])
+			return E_FAIL;
+
+		for (int stage = 0; stage < RNN_STAGE_COUNT; stage++)
+		{
+			if (rnnoise_profile_stats(m_rnnoiseStates[0], stage, &stats[stage]) != 0)
+				return E_NOTIMPL;
+		}
+		if (reset)
+		{
+			for (DenoiseState *state : m_rnnoiseStates)
+				rnnoise_profile_reset(state);
+		}
+		return S_OK;
+	}
+
+	HRESULT Player::GetJitterStats(JitterStats *stats)
+	{
+		*stats = m_packetBuffer.Stats();
+		return S_OK;
+	}
+
+	bool Player::IsCreated() { return m_device != nullptr; }
 
 	bool Player::IsReady() { return !m_shutdown; }
 
@@ -196,144 +248,272 @@ namespace playback
 
 	HRESULT Player::EndPlayback()
 	{
-		std::lock_guard<std::mutex> lock(m_queueMutex);
 		m_shutdown = true;
-		if (m_playbackThread.joinable())
-			m_playbackThread.join();
-		if (m_audioClient)
+		if (m_denoiseThread.joinable())
+			m_denoiseThread.join();
+		if (m_device)
 		{
-			m_audioClient->Stop();
+			m_device->Stop(); // joins its render thread
+			m_device.reset();
 		}
-		m_jitterBuffer.clear();
-		SafeRelease(m_renderClient);
-		SafeRelease(m_audioClient);
-		CoUninitialize();
+		m_jitterRing.Reset();
+		m_packetBuffer.Reset();
+		m_packetMode = false;
+		m_outputRing.Reset();
 
 		return S_OK;
 	}
 
-	void Player::PlaybackThread()
+	void Player::DenoiseThread()
 	{
-		CoInitializeEx(NULL, COINIT_MULTITHREADED);
-
-		// Audio format constants
-		const int INPUT_FRAME_SIZE = 160; // 10ms at 16kHz
-
 		// Calculate frame sizes in bytes
-		const size_t inputFrameBytes = INPUT_FRAME_SIZE * sizeof(int16_t); // 10ms at 16kHz
-		const size_t processingFrameBytes = FRAME_SIZE * sizeof(int16_t);  // 10ms at 48kHz (480 bytes)
+		const int INPUT_FRAME_SIZE = STREAM_FRAME_SIZE;
+		const size_t inputFrameBytes = INPUT_FRAME_SIZE * sizeof(int16_t); // 10ms of the stream
+		const DenoiseLevel level = m_denoiseLevel;
+		const bool light = level == DenoiseLevel::LIGHT;
+#ifdef STEREO
+		const int outputFrameSize = INPUT_FRAME_SIZE;
+#else
+		const int outputFrameSize = level == DenoiseLevel::NONE || light ? INPUT_FRAME_SIZE : FRAME_SIZE; // 10ms at 16kHz or 48kHz
+#endif
+		const size_t processingFrameBytes = outputFrameSize * sizeof(int16_t); // 10ms on the device
 
-		// Buffers for audio processing
-		std::vector<float> inputFloatBuffer;
-		std::vector<float> processingBuffer(FRAME_SIZE);
+		// Stay about one device buffer ahead of the render thread
+		const size_t readyBytes = m_bufferFrameCount * m_format.BlockAlign();
 
-		while (!m_shutdown)
+#ifdef STEREO
+		// Deinterleaved channels, one frame each
+		std::vector<float> processingBuffer(FRAME_SIZE * DENOISE_CHANNELS);
+		float *channelBuffers[DENOISE_CHANNELS];
+		for (int c = 0; c < DENOISE_CHANNELS; c++)
+			channelBuffers[c] = processingBuffer.data() + c * FRAME_SIZE;
+#else
+		int16_t upsampled[FRAME_SIZE]; // one frame at 48kHz
+#endif
+		std::vector<uint8_t> straddling(inputFrameBytes);  // a frame split by the ring's wrap
+		std::vector<uint8_t> packetFrame(inputFrameBytes); // a frame popped from the packet buffer
+		std::vector<int16_t> played(STREAM_FRAME_SIZE);	   // a frame after loss concealment
+		std::vector<uint8_t> stretched;					   // frames after time-scale modification
+		std::vector<uint8_t> output;
+
+		// Latency control: instead of jumping over audio or inserting silence, the stream plays
+		// up to 10% faster or slower until the buffered audio is back at m_minJitterMs
+		const int hop = STREAM_FRAME_SIZE / DENOISE_CHANNELS; // samples per channel per frame
+		const float LEVEL_SMOOTHING = .05f;					   // per frame: about a 200ms time constant
+		WsolaState *stretcher = wsola_create(DENOISE_CHANNELS, hop);
+		// A lost packet, or a stream that stalls until the device is about to run dry, is
+		// concealed by repeating the last pitch period instead of playing silence
+		PlcState *concealer = plc_create(DENOISE_CHANNELS, hop);
+		if (!stretcher || !concealer)
 		{
-			UINT32 padding = 0;
-			if (FAILED(m_audioClient->GetCurrentPadding(&padding)))
-				continue;
-
-			UINT32 framesAvailable = m_bufferFrameCount - padding;
-			if (framesAvailable == 0)
-				continue;
-
-			BYTE *buffer = nullptr;
-			if (FAILED(m_renderClient->GetBuffer(framesAvailable, &buffer)))
-				continue;
-
-			UINT32 bytesToWrite = framesAvailable * m_desiredFormat.nBlockAlign;
-
-			size_t buffered;
-			{
-				std::lock_guard<std::mutex> lock(m_queueMutex);
-				buffered = m_jitterBuffer.size();
-			}
+			DebugPrint("ERROR: Failed to create WSOLA or PLC state\n");
+			wsola_destroy(stretcher);
+			plc_destroy(concealer);
+			return;
+		}
+		bool playing = false; // since the last dropout: buffered up to m_minJitterMs (ring mode), or played a frame
+		float levelMs = -1.f; // smoothed buffered audio; negative until playout (re)starts
 
-			const size_t bytesPerMs = m_desiredFormat.nAvgBytesPerSec / 1000;
+		while (!m_shutdown)
+		{
+			// Jitter range, in milliseconds of the stream
+			const size_t bytesPerMs = inputFrameBytes / 10;
 			const size_t minBytes = m_minJitterMs * bytesPerMs;
 			const size_t maxBytes = m_maxJitterMs * bytesPerMs;
+			const uint32_t bytesPerSample = DENOISE_CHANNELS * sizeof(int16_t);
 
-			if (buffered < minBytes)
+			size_t framesToProcess = 0;
+			size_t ready = m_outputRing.Size();
+			if (ready < readyBytes)
 			{
-				memset(buffer, 0, bytesToWrite);
-				m_renderClient->ReleaseBuffer(framesAvailable, 0);
-				continue;
+				size_t framesWanted = (readyBytes - ready + processingFrameBytes - 1) / processingFrameBytes;
+				size_t framesFitting = (m_outputRing.Capacity() - ready) / processingFrameBytes;
+				framesToProcess = min(framesWanted, framesFitting);
 			}
 
-			if (buffered > maxBytes)
+			const bool packets = m_packetMode;
+			size_t buffered; // bytes of the stream waiting for playout
+			if (packets)
 			{
-				size_t drop = buffered - maxBytes;
-				std::lock_guard<std::mutex> lock(m_queueMutex);
-				m_jitterBuffer.erase(m_jitterBuffer.begin(), m_jitterBuffer.begin() + drop);
-				buffered -= drop;
+				// Played by timestamp: a frame is due whether or not its packets arrived, and the
+				// buffer itself waits for minBytes and skips whole frames above maxBytes
+				buffered = m_packetBuffer.Buffered() * bytesPerSample;
 			}
-
+			else
 			{
-				std::lock_guard<std::mutex> lock(m_queueMutex);
-				size_t toCopy = min(bytesToWrite, m_jitterBuffer.size());
+				buffered = m_jitterRing.Size();
+				if (buffered > maxBytes)
+				{
+					// Only when the stretcher cannot keep up; whole frames, so the stream stays sample aligned
+					size_t drop = min(buffered, (buffered - maxBytes + inputFrameBytes - 1) / inputFrameBytes * inputFrameBytes);
+					m_jitterRing.Consume(drop);
+					buffered -= drop;
+				}
+				if (!playing)
+					playing = buffered >= minBytes && buffered >= inputFrameBytes;
+				if (!playing)
+					framesToProcess = 0;
+			}
 
-				if (m_denoiseLevel == DenoiseLevel::NONE)
+			// Feeds the stretcher one frame of the stream; false on an underrun
+			auto pullFrame = [&]() -> bool
+			{
+				const uint8_t *frame;
+				if (packets)
 				{
-					std::copy_n(m_jitterBuffer.begin(), toCopy, buffer);
-					m_jitterBuffer.erase(m_jitterBuffer.begin(), m_jitterBuffer.begin() + toCopy);
+					PlayoutFrame popped = m_packetBuffer.Pop(packetFrame.data(), (uint32_t)(minBytes / bytesPerSample),
+															 (uint32_t)(maxBytes / bytesPerSample));
+					if (popped == PlayoutFrame::EMPTY)
+						return false;
+					playing = true;
+					if (popped == PlayoutFrame::LOST)
+					{
+						plc_conceal(concealer, played.data()); // the whole frame, even if part of it arrived
+						wsola_push(stretcher, played.data(), hop);
+						return true;
+					}
+					frame = packetFrame.data();
 				}
 				else
 				{
-					size_t available = m_jitterBuffer.size();
-					size_t framesAvailableToProcess = available / inputFrameBytes;
-					size_t framesWritable = bytesToWrite / processingFrameBytes;
-					size_t framesToProcess = min(framesAvailableToProcess, framesWritable);
-
-					if (framesToProcess == 0 || !m_rnnoiseState)
+					// Read in place; only a frame split by the wrap is copied out
+					const uint8_t *span[2];
+					size_t spanSize[2];
+					if (m_jitterRing.Peek(span, spanSize) < inputFrameBytes)
+						return false;
+					frame = span[0];
+					if (spanSize[0] < inputFrameBytes)
 					{
-						memset(buffer, 0, bytesToWrite);
-						m_renderClient->ReleaseBuffer(framesAvailable, 0);
+						memcpy(straddling.data(), span[0], spanSize[0]);
+						memcpy(straddling.data() + spanSize[0], span[1], inputFrameBytes - spanSize[0]);
+						frame = straddling.data();
+					}
+				}
+				plc_good(concealer, played.data(), reinterpret_cast<const int16_t *>(frame));
+				wsola_push(stretcher, played.data(), hop);
+				if (!packets)
+					m_jitterRing.Consume(inputFrameBytes);
+				buffered -= min(buffered, inputFrameBytes);
+				return true;
+			};
+
+			stretched.resize(framesToProcess * inputFrameBytes);
+			size_t stretchedFrames = 0;
+			for (; stretchedFrames < framesToProcess; stretchedFrames++)
+			{
+				const float bufferedMs = (float)buffered / bytesPerMs;
+				levelMs = levelMs < 0 ? bufferedMs : levelMs + (bufferedMs - levelMs) * LEVEL_SMOOTHING;
+				const float offsetMs = levelMs - (float)m_minJitterMs;
+				float rate = 1.f; // near the target, so a steady stream passes through unchanged
+				if (fabsf(offsetMs) > JITTER_DEADBAND_MS)
+					rate += (WSOLA_MAX_RATE - 1.f) * offsetMs / JITTER_STRETCH_MS; // clamped by wsola_process
+
+				bool underrun = false, dropout = false;
+				while (!underrun && wsola_needed(stretcher, rate) > 0)
+				{
+					if (pullFrame())
 						continue;
+					// Playing slower refills the buffer while the device still has audio queued;
+					// once it is about to run dry, a concealed frame goes out instead, if there was a stream
+					if (ready + stretchedFrames * processingFrameBytes >= processingFrameBytes)
+						underrun = true;
+					else if (playing && plc_conceal(concealer, played.data()))
+						wsola_push(stretcher, played.data(), hop);
+					else
+						underrun = dropout = true;
+				}
+				if (underrun)
+				{
+					// The concealment has faded out: playout waits for m_minJitterMs again
+					if (dropout)
+					{
+						playing = false;
+						levelMs = -1.f;
 					}
+					break;
+				}
+				wsola_process(stretcher, reinterpret_cast<int16_t *>(&stretched[stretchedFrames * inputFrameBytes]), rate);
+			}
+			framesToProcess = stretchedFrames;
 
-					size_t processed = 0;
+			if (framesToProcess == 0)
+			{
+				std::this_thread::sleep_for(std::chrono::milliseconds(DENOISE_POLL_MS));
+				continue;
+			}
+
+			auto inputFrame = [&](size_t f) -> const uint8_t *
+			{
+				return stretched.data() + f * inputFrameBytes;
+			};
+
+			output.resize(framesToProcess * processingFrameBytes);
+			{
+				std::lock_guard<std::mutex> lock(m_denoiseMutex);
+				if (level == DenoiseLevel::NONE)
+				{
+					// Same format on both sides
+					for (size_t f = 0; f < framesToProcess; ++f)
+						memcpy(&output[f * processingFrameBytes], inputFrame(f), inputFrameBytes);
+				}
+				else if (light ? !m_spectralState : !m_rnnoiseStates[0])
+				{
+					std::fill(output.begin(), output.end(), 0);
+				}
+				else
+				{
 					for (size_t f = 0; f < framesToProcess; ++f)
 					{
-						const int16_t *input16k = reinterpret_cast<const int16_t *>(&m_jitterBuffer[processed]);
-						// RNNoise expects integer-range values (-32768 to 32767), not normalized floats
-						inputFloatBuffer.resize(INPUT_FRAME_SIZE);
-						for (int i = 0; i < INPUT_FRAME_SIZE; i++)
+#ifdef STEREO
+						// All channels through the network in one batched call, no resampling
+						const int16_t *input48k = reinterpret_cast<const int16_t *>(inputFrame(f));
+						int16_t *output48k = reinterpret_cast<int16_t *>(&output[f * processingFrameBytes]);
+						rnn_deinterleave_s16(channelBuffers, input48k, DENOISE_CHANNELS, FRAME_SIZE);
+						rnnoise_process_frames(m_rnnoiseStates, channelBuffers, channelBuffers, NULL, DENOISE_CHANNELS);
+						rnn_interleave_s16(output48k, channelBuffers, DENOISE_CHANNELS, FRAME_SIZE);
+#else
+						// Both denoisers take the stream's 16-bit samples and write the device's
+						const int16_t *input16k = reinterpret_cast<const int16_t *>(inputFrame(f));
+						int16_t *outputBuffer = reinterpret_cast<int16_t *>(&output[f * processingFrameBytes]);
+						if (light)
 						{
-							inputFloatBuffer[i] = static_cast<float>(input16k[i]); // No division
+							// Spectral suppressor at the stream rate, no resampling
+							spectral_process_frame_s16(m_spectralState, outputBuffer, input16k);
+							continue;
 						}
 
 						// Upsample from 16kHz to 48kHz (1:3) with linear interpolation
 						for (int i = 0; i < INPUT_FRAME_SIZE - 1; i++)
 						{
-							float s0 = inputFloatBuffer[i];
-							float s1 = inputFloatBuffer[i + 1];
-							processingBuffer[i * 3] = s0;
-							processingBuffer[i * 3 + 1] = (2.f * s0 + s1) / 3.f;
-							processingBuffer[i * 3 + 2] = (s0 + 2.f * s1) / 3.f;
+							float s0 = input16k[i];
+							float s1 = input16k[i + 1];
+							upsampled[i * 3] = input16k[i];
+							upsampled[i * 3 + 1] = static_cast<int16_t>(lrintf((2.f * s0 + s1) / 3.f));
+							upsampled[i * 3 + 2] = static_cast<int16_t>(lrintf((s0 + 2.f * s1) / 3.f));
 						}
-						processingBuffer[(INPUT_FRAME_SIZE - 1) * 3] = inputFloatBuffer[INPUT_FRAME_SIZE - 1];
-
-						// Process frame through RNNoise
-						rnnoise_process_frame(m_rnnoiseState, processingBuffer.data(), processingBuffer.data());
+						for (int i = (INPUT_FRAME_SIZE - 1) * 3; i < FRAME_SIZE; i++)
+							upsampled[i] = input16k[INPUT_FRAME_SIZE - 1]; // hold the last sample
 
-						// Convert processed audio to output format and copy to device buffer
-						int16_t *outputBuffer = reinterpret_cast<int16_t *>(buffer) + (f * FRAME_SIZE);
-						for (int i = 0; i < FRAME_SIZE; i++)
-						{
-							outputBuffer[i] = static_cast<int16_t>(
-								max(-32768.0f, min(32767.0f, processingBuffer[i])));
-						}
-
-						processed += inputFrameBytes;
+						rnnoise_process_frame_s16(m_rnnoiseStates[0], outputBuffer, upsampled);
+#endif
 					}
-
-					m_jitterBuffer.erase(m_jitterBuffer.begin(),
-										 m_jitterBuffer.begin() + framesToProcess * inputFrameBytes);
 				}
 			}
 
-			m_renderClient->ReleaseBuffer(framesAvailable, 0);
+			m_outputRing.Write(output.data(), output.size()); // fits: only framesFitting were taken
 		}
-		CoUninitialize();
+		wsola_destroy(stretcher);
+		plc_destroy(concealer);
+	}
+
+	// On the device's render thread: only PCM the denoise stage has ready, no lock, no
+	// denoising while the device buffer is held, and silence for whatever is missing
+	size_t Player::Render(uint8_t *buffer, size_t size)
+	{
+		size_t ready = min(m_outputRing.Size(), size);
+		ready -= ready % m_format.BlockAlign();
+		m_outputRing.Read(buffer, ready);
+		memset(buffer + ready, 0, size - ready);
+		return ready;
 	}
-};
\ No newline at end of file
+};
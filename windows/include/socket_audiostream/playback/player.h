@@ -1,14 +1,37 @@
 #pragma once
 
-#include <Audioclient.h> // m_audioClient
-#include <thread>		 // std::thread
-#include <mutex>		 // std::mutex
-#include <vector>		 // std::vector
+#include <atomic> // std::atomic
+#include <memory> // std::unique_ptr
+#include <thread> // std::thread
+#include <mutex>  // std::mutex
+#include <vector> // std::vector
+#include <string> // std::string
 
-#include "denoise.h" // Include RNNoise header
+#include "denoise.h"  // Include RNNoise header
+#include "spectral.h" // DenoiseLevel::LIGHT
+#include "pcm.h"	  // rnn_deinterleave_s16, rnn_interleave_s16
+#include "wsola.h"	  // WsolaState
+#include "plc.h"	  // PlcState
+
+#include "../platform.h"				// HRESULT
+#include "../ringbuffer.h"				// RingBuffer
+#include "../device/audiodevice.h"	// device::RenderDevice
+#include "jitterbuffer.h"				// PacketJitterBuffer
 
 #define BUFFER_SIZE_IN_SECONDS 0.1f
-#define REFTIMES_PER_SEC 10000000 // hundred nanoseconds
+#define DENOISE_POLL_MS 2		  // how long the denoise stage sleeps when it has nothing to do
+#define JITTER_HEADROOM_MS 200	  // jitter ring room above m_maxJitterMs for a burst of chunks
+#define JITTER_DEADBAND_MS 10	  // buffered audio this close to m_minJitterMs plays at rate 1
+#define JITTER_STRETCH_MS 100	  // distance from m_minJitterMs that plays at the WSOLA rate limit
+
+// Channels of the stream, each denoised by its own DenoiseState
+#ifdef STEREO
+#define DENOISE_CHANNELS 2 // 48kHz interleaved, denoised without resampling
+#define STREAM_FRAME_SIZE (FRAME_SIZE * DENOISE_CHANNELS) // 10ms of the stream, interleaved
+#else
+#define DENOISE_CHANNELS 1 // 16kHz, upsampled for RNNoise
+#define STREAM_FRAME_SIZE 160 // 10ms of the stream
+#endif
 
 namespace playback
 {
@@ -16,7 +39,8 @@ namespace playback
 	{
 		NONE = 0,
 		SOFT = 1,
-		FULL = 2
+		FULL = 2,
+		LIGHT = 3 // spectral suppressor at 16 kHz, no network
 	};
 
 	class Player
@@ -27,12 +51,19 @@ namespace playback
 		Player();
 		virtual ~Player();
 
-		HRESULT Start(std::string playerId, LPCWSTR deviceId);
+#ifdef _WIN32
+		HRESULT Start(std::string playerId, const wchar_t *deviceId);
+#endif
+		HRESULT Start(std::unique_ptr<device::RenderDevice> device);
 		HRESULT Stop();
 		HRESULT SetVolume(float volume);
 		HRESULT AddChunk(const std::vector<uint8_t> &data);
+		HRESULT AddPacket(uint16_t sequence, uint32_t timestamp, const std::vector<uint8_t> &data);
 		HRESULT SetJitterRange(uint32_t minMs, uint32_t maxMs);
-		HRESULT SetDenoise(DenoiseLevel level);
+		// modelError, if given, gets the RNN_MODEL_ERR_ code when modelPath could not be loaded
+		HRESULT SetDenoise(DenoiseLevel level, const std::string &modelPath = std::string(), int *modelError = nullptr);
+		HRESULT GetDenoiseStats(RNNProfileStats stats[RNN_STAGE_COUNT], bool reset);
+		HRESULT GetJitterStats(JitterStats *stats);
 		HRESULT Dispose();
 		bool IsCreated();
 		bool IsReady();
@@ -40,25 +71,33 @@ namespace playback
 
 	private:
 		HRESULT EndPlayback();
-		void PlaybackThread();
+		void DestroyDenoise();
+		void DenoiseThread();
+		size_t Render(uint8_t *buffer, size_t size);
 
-		IAudioClient *m_audioClient;
-		IAudioRenderClient *m_renderClient;
+		std::unique_ptr<device::RenderDevice> m_device; // WASAPI, or a virtual device
 		std::atomic<bool> m_shutdown;
 
-		WAVEFORMATEX m_desiredFormat;
-		UINT32 m_bufferFrameCount;
-		std::thread m_playbackThread;
-		std::mutex m_queueMutex;
+		device::AudioFormat m_format; // what the device plays
+		uint32_t m_bufferFrameCount;
 
-		// Unified jitter
-		std::vector<uint8_t> m_jitterBuffer;
-		uint32_t m_minJitterMs = 200;
-		uint32_t m_maxJitterMs = 800;
+		// Unified jitter: AddChunk writes the stream into the ring, the denoise stage reads it
+		RingBuffer m_jitterRing; // sized at Start from m_maxJitterMs
+		PacketJitterBuffer m_packetBuffer{DENOISE_CHANNELS * sizeof(int16_t), STREAM_FRAME_SIZE / DENOISE_CHANNELS};
+		std::atomic<bool> m_packetMode{false}; // AddPacket was called: play by timestamp from m_packetBuffer
+		std::atomic<uint32_t> m_minJitterMs{200};
+		std::atomic<uint32_t> m_maxJitterMs{800};
 		uint32_t m_lastLoggedJitterMs = 0;
 
+		// Denoise stage: its own thread takes 10ms frames from the jitter ring, denoises them
+		// and queues device PCM, so the device's render thread only copies ready samples out of the ring
+		std::thread m_denoiseThread;
+		RingBuffer m_outputRing;
+		std::mutex m_denoiseMutex; // guards the states against SetDenoise while a frame is processed
+
 		// RNNoise
 		DenoiseLevel m_denoiseLevel;
-		DenoiseState *m_rnnoiseState;
+		DenoiseState *m_rnnoiseStates[DENOISE_CHANNELS]; // processed as one batch, see rnnoise_process_frames
+		SpectralState *m_spectralState;
 	};
 }
@@ -15,6 +15,7 @@ constexpr uint32_t kIsPaused = HashMethodName("isPaused");
 constexpr uint32_t kIsReady = HashMethodName("isReady");
 constexpr uint32_t kDispose = HashMethodName("dispose");
 constexpr uint32_t kListDevices = HashMethodName("listDevices");
+constexpr uint32_t kSetDenoise = HashMethodName("setDenoise");
 
 namespace
 {
@@ -164,6 +165,23 @@ namespace recording
 			result->Success(EncodableValue(recorder->IsReady()));
 			return;
 
+		case kSetDenoise:
+		{
+			auto val = arguments->find(flutter::EncodableValue("level"));
+			if (val == arguments->end() || !std::holds_alternative<int>(val->second))
+			{
+				ErrorMessage("Missing or invalid 'level' parameter", *result);
+				return;
+			}
+			int level = std::get<int>(val->second);
+			if (level < 0 || level > 3) {
+				ErrorMessage("Invalid denoise level (expected 0=NONE, 1=SOFT, 2=FULL, 3=LIGHT)", *result);
+				return;
+			}
+			hr = recorder->SetDenoise(static_cast<playback::DenoiseLevel>(level));
+			break;
+		}
+
 		case kDispose:
 		{
 			auto it = m_recorders.find(recorderId);
@@ -213,8 +231,27 @@ namespace recording
 			&StandardMethodCodec::GetInstance());
 		recordEventChannel->SetStreamHandler(std::move(pRecordEventHandler));
 
+		// Speech probabilities of the denoised chunks, see Recorder::SetDenoise
+		auto vadEventHandler = new EventStreamHandler<>();
+		std::unique_ptr<StreamHandler<EncodableValue>> pVadEventHandler{static_cast<StreamHandler<EncodableValue> *>(vadEventHandler)};
+
+		auto vadEventChannel = std::make_unique<EventChannel<EncodableValue>>(
+			binary_messenger, "com.softigent.audiostream/recordVad/" + recorderId,
+			&StandardMethodCodec::GetInstance());
+		vadEventChannel->SetStreamHandler(std::move(pVadEventHandler));
+
+		// Chunks arrive on the capture or the denoise thread and are sent from the platform thread
+		auto record = [recordEventHandler, vadEventHandler](const std::vector<uint8_t> &bytes, const std::vector<float> &vad)
+		{
+			MediaRecorder::CallbackHandler([recordEventHandler, vadEventHandler, bytes, vad]() -> void
+										   {
+				recordEventHandler->Success(std::make_unique<flutter::EncodableValue>(bytes));
+				if (!vad.empty())
+					vadEventHandler->Success(std::make_unique<flutter::EncodableValue>(vad)); });
+		};
+
 		Recorder *raw_recorder = nullptr;
-		HRESULT hr = Recorder::CreateInstance(recordEventHandler, &raw_recorder);
+		HRESULT hr = Recorder::CreateInstance(record, &raw_recorder);
 		if (SUCCEEDED(hr))
 		{
 			m_recorders.insert(std::make_pair(recorderId, std::move(raw_recorder)));
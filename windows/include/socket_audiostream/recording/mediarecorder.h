@@ -3,6 +3,7 @@
 
 #include <flutter/plugin_registrar_windows.h> // flutter::Plugin, flutter::PluginRegistrarWindows
 
+#include "../utils.h" // EventStreamHandler
 #include "recorder.h"
 
 using namespace flutter;
@@ -1,117 +1,19 @@
+#include <cmath>	// lrintf
+#include <cstring> // memcpy
+
 #include "recorder.h"
-#include "mediarecorder.h"
+#ifdef _WIN32
+#include "../device/windowsdevice.h" // device::MfCaptureDevice
+#endif
+
+#define CAPTURE_FRAME_SIZE 160							// 10ms at 16kHz
+#define CAPTURE_BACKLOG_BYTES (16000 * sizeof(int16_t)) // the denoise thread may fall 1s behind
 
 namespace recording
 {
-	STDMETHODIMP Recorder::QueryInterface(REFIID iid, void **ppv)
-	{
-		if (!ppv)
-			return E_POINTER;
-		*ppv = nullptr;
-		if (iid == __uuidof(IUnknown))
-		{
-			*ppv = static_cast<IUnknown *>(static_cast<IMFSourceReaderCallback *>(this));
-		}
-		else if (iid == __uuidof(IMFSourceReaderCallback))
-		{
-			*ppv = static_cast<IMFSourceReaderCallback *>(this);
-		}
-		else
-		{
-			return E_NOINTERFACE;
-		}
-		AddRef();
-		return S_OK;
-	}
-
-	STDMETHODIMP_(ULONG)
-	Recorder::AddRef()
-	{
-		return InterlockedIncrement(&m_LockCount);
-	}
-
-	STDMETHODIMP_(ULONG)
-	Recorder::Release()
-	{
-		ULONG uCount = InterlockedDecrement(&m_LockCount);
-		if (uCount == 0)
-		{
-			delete this;
-		}
-		return uCount;
-	}
-
-	STDMETHODIMP Recorder::OnEvent(DWORD, IMFMediaEvent *)
-	{
-		return S_OK;
-	}
-
-	STDMETHODIMP Recorder::OnFlush(DWORD)
-	{
-		return S_OK;
-	}
-
-	HRESULT Recorder::OnReadSample(
-		HRESULT hrStatus,
-		DWORD dwStreamIndex,
-		DWORD dwStreamFlags,
-		LONGLONG llTimestamp,
-		IMFSample *imfSample)
-	{
-		HRESULT hr = S_OK;
-
-		if (SUCCEEDED(hrStatus))
-		{
-			if (imfSample)
-			{
-				hr = imfSample->SetSampleTime(llTimestamp);
-
-				if (SUCCEEDED(hr))
-				{
-					IMFMediaBuffer *pBuffer = NULL;
-					hr = imfSample->ConvertToContiguousBuffer(&pBuffer);
-
-					if (SUCCEEDED(hr))
-					{
-						BYTE *pChunk = NULL;
-						DWORD size = 0;
-						hr = pBuffer->Lock(&pChunk, NULL, &size);
-
-						if (SUCCEEDED(hr))
-						{
-							// Send data to stream
-							if (m_recordEventHandler)
-							{
-								std::vector<uint8_t> bytes(pChunk, pChunk + size);
-								MediaRecorder::CallbackHandler([this, bytes]() -> void
-															   { m_recordEventHandler->Success(std::make_unique<flutter::EncodableValue>(bytes)); });
-							}
-							pBuffer->Unlock();
-						}
-						SafeRelease(pBuffer);
-					}
-				}
-			}
-
-			if (SUCCEEDED(hr))
-			{
-				hr = m_imfReader->ReadSample((DWORD)MF_SOURCE_READER_FIRST_AUDIO_STREAM,
-											 0, NULL, NULL, NULL, NULL);
-			}
-		}
-		else
-		{
-			auto errorText = std::system_category().message(hrStatus);
-			printf("Record: Error when reading sample (0x%X)\n%s\n", hrStatus, errorText.c_str());
-			Stop();
-		}
-
-		return hr;
-	}
-
-	HRESULT Recorder::CreateInstance(EventStreamHandler<> *recordEventHandler, Recorder **ppRecorder)
+	HRESULT Recorder::CreateInstance(RecordCallback record, Recorder **ppRecorder)
 	{
-		auto pRecorder = new (std::nothrow) Recorder(recordEventHandler);
+		auto pRecorder = new (std::nothrow) Recorder(std::move(record));
 		if (pRecorder == NULL)
 		{
 			return E_OUTOFMEMORY;
@@ -121,12 +23,11 @@ namespace recording
 		return S_OK;
 	}
 
-	Recorder::Recorder(EventStreamHandler<> *recordEventHandler)
-		: m_LockCount(1),
-		  m_imfSource(NULL),
-		  m_imfReader(NULL),
-		  m_imfDescriptor(NULL),
-		  m_recordEventHandler(recordEventHandler)
+	Recorder::Recorder(RecordCallback record)
+		: m_record(std::move(record)),
+		  m_denoiseLevel(playback::DenoiseLevel::NONE),
+		  m_rnnoiseState(nullptr),
+		  m_spectralState(nullptr)
 	{
 	}
 
@@ -135,156 +36,79 @@ namespace recording
 		Dispose();
 	}
 
-	HRESULT Recorder::Start(std::string recorderId, LPCWSTR deviceId)
+#ifdef _WIN32
+	HRESULT Recorder::Start(std::string recorderId, const wchar_t *deviceId)
 	{
-		HRESULT hr = EndRecording();
+		return Start(std::make_unique<device::MfCaptureDevice>(deviceId));
+	}
+#endif
 
-		if (SUCCEEDED(hr))
-		{
-			if (!m_imfStarted)
-			{
-				hr = MFStartup(MF_VERSION, MFSTARTUP_NOSOCKET);
-			}
-			if (SUCCEEDED(hr))
-			{
-				m_imfStarted = true;
-			}
-		}
+	// Records from device from now on: Media Foundation, or a virtual device for a headless run
+	HRESULT Recorder::Start(std::unique_ptr<device::CaptureDevice> device)
+	{
+		HRESULT hr = EndRecording();
+		if (FAILED(hr))
+			return hr;
+		if (!device)
+			return E_POINTER;
 
-		if (SUCCEEDED(hr))
+		m_device = std::move(device);
 		{
-			IMFAttributes *pAttributes = NULL;
-			hr = MFCreateAttributes(&pAttributes, 2);
-			// Enable speech processing mode for AEC, NS, AGC
-			pAttributes->SetUINT32(MF_AUDIO_RENDERER_ATTRIBUTE_FLAGS, MF_AUDIO_RENDERER_ATTRIBUTE_FLAG_ENABLE_VOICE);
-
-			// Set the device type to audio.
-			if (SUCCEEDED(hr))
-			{
-				hr = pAttributes->SetGUID(
-					MF_DEVSOURCE_ATTRIBUTE_SOURCE_TYPE,
-					MF_DEVSOURCE_ATTRIBUTE_SOURCE_TYPE_AUDCAP_GUID);
-			}
-
-			// Set the endpoint ID.
-			if (SUCCEEDED(hr) && deviceId)
-			{
-				hr = pAttributes->SetString(
-					MF_DEVSOURCE_ATTRIBUTE_SOURCE_TYPE_AUDCAP_ENDPOINT_ID,
-					deviceId);
-			}
-
-			// Create the source
-			if (SUCCEEDED(hr))
-			{
-				hr = MFCreateDeviceSource(pAttributes, &m_imfSource);
-			}
-			// Create presentation descriptor to handle Resume action
-			if (SUCCEEDED(hr))
-			{
-				hr = m_imfSource->CreatePresentationDescriptor(&m_imfDescriptor);
-			}
-
-			SafeRelease(pAttributes);
+			std::lock_guard<std::mutex> lock(m_captureMutex);
+			m_captureBuffer.clear();
+			m_denoiseShutdown = false;
 		}
-		if (SUCCEEDED(hr))
-		{
-			hr = S_OK;
-			IMFAttributes *pAttributes = NULL;
-			IMFMediaType *pMediaTypeIn = NULL;
-
-			hr = MFCreateAttributes(&pAttributes, 1);
-			if (SUCCEEDED(hr))
-			{
-				hr = pAttributes->SetUnknown(MF_SOURCE_READER_ASYNC_CALLBACK, this);
-			}
-			if (SUCCEEDED(hr))
-			{
-				hr = MFCreateSourceReaderFromMediaSource(m_imfSource, pAttributes, &m_imfReader);
-			}
-			if (SUCCEEDED(hr))
-			{
-				IMFMediaType **ppMediaType = &pMediaTypeIn;
-				hr = hr = S_OK;
-
-				IMFMediaType *pMediaType = NULL;
-
-				hr = MFCreateMediaType(&pMediaType);
+		m_denoiseThread = std::thread(&Recorder::DenoiseThread, this);
 
-				if (SUCCEEDED(hr))
-				{
-					hr = pMediaType->SetGUID(MF_MT_MAJOR_TYPE, MFMediaType_Audio);
-				}
-				if (SUCCEEDED(hr))
-				{
-					hr = pMediaType->SetGUID(MF_MT_SUBTYPE, MFAudioFormat_PCM);
-				}
-				if (SUCCEEDED(hr))
-				{
-					hr = pMediaType->SetUINT32(MF_MT_AUDIO_BITS_PER_SAMPLE, 16);
-				}
-				if (SUCCEEDED(hr))
-				{
-					hr = pMediaType->SetUINT32(MF_MT_AVG_BITRATE, 128000);
-				}
-				if (SUCCEEDED(hr))
-				{
 #ifdef STEREO
-						hr = pMediaType->SetUINT32(MF_MT_AUDIO_SAMPLES_PER_SECOND, 48000);
+		const device::AudioFormat format = {48000, 2, 16};
 #else
-						hr = pMediaType->SetUINT32(MF_MT_AUDIO_SAMPLES_PER_SECOND, 16000);
+		const device::AudioFormat format = {16000, 1, 16};
 #endif
-				}
-				if (SUCCEEDED(hr))
-				{
-#ifdef STEREO
-					hr = pMediaType->SetUINT32(MF_MT_AUDIO_NUM_CHANNELS, 2);
-#else
-					hr = pMediaType->SetUINT32(MF_MT_AUDIO_NUM_CHANNELS, 1);
-#endif
-				}
-				UINT32 samples, channels;
-				pMediaType->GetUINT32(MF_MT_AUDIO_SAMPLES_PER_SECOND, &samples);
-				pMediaType->GetUINT32(MF_MT_AUDIO_NUM_CHANNELS, &channels);
-				DebugPrint("MF_MT_AUDIO_SAMPLES_PER_SECOND: %u, MF_MT_AUDIO_NUM_CHANNELS:%u\n", samples, channels);
-				if (SUCCEEDED(hr))
-				{
-					*ppMediaType = pMediaType;
-					(*ppMediaType)->AddRef();
-				}
-
-				SafeRelease(pMediaType);
-			}
-			if (SUCCEEDED(hr))
-			{
-				hr = m_imfReader->SetCurrentMediaType(0, NULL, pMediaTypeIn);
-			}
+		m_capturing = true;
+		m_paused = false;
+		hr = m_device->Start(format, [this](HRESULT status, const uint8_t *data, size_t size)
+							 { OnCapture(status, data, size); });
 
-			SafeRelease(pMediaTypeIn);
-			SafeRelease(pAttributes);
+		if (!SUCCEEDED(hr))
+		{
+			EndRecording();
 		}
 
-		if (SUCCEEDED(hr))
+		return hr;
+	}
+
+	// On the device's capture thread
+	void Recorder::OnCapture(HRESULT status, const uint8_t *data, size_t size)
+	{
+		if (FAILED(status))
 		{
-			hr = m_imfReader->ReadSample((DWORD)MF_SOURCE_READER_FIRST_AUDIO_STREAM,
-										 0,
-										 NULL, NULL, NULL, NULL);
+			Stop();
+			return;
 		}
 
-		if (!SUCCEEDED(hr))
+		if (!m_record)
+			return;
+
+		// Sent from the denoise thread, denoised or not, so a slow frame never delays the next
+		// chunk and chunks stay in order when the level changes
+		std::lock_guard<std::mutex> lock(m_captureMutex);
+		m_captureBuffer.insert(m_captureBuffer.end(), data, data + size);
+		if (m_captureBuffer.size() > CAPTURE_BACKLOG_BYTES)
 		{
-			EndRecording();
+			size_t drop = m_captureBuffer.size() - CAPTURE_BACKLOG_BYTES;
+			drop -= drop % sizeof(int16_t);
+			m_captureBuffer.erase(m_captureBuffer.begin(), m_captureBuffer.begin() + drop);
 		}
-
-		return hr;
+		m_captureReady.notify_one();
 	}
 
 	HRESULT Recorder::Pause()
 	{
 		HRESULT hr = S_OK;
-		if (m_imfSource)
+		if (m_device)
 		{
-			hr = m_imfSource->Pause();
+			hr = m_device->Pause();
 		}
 
 		if (SUCCEEDED(hr))
@@ -299,13 +123,9 @@ namespace recording
 	{
 		HRESULT hr = S_OK;
 
-		if (m_imfSource)
+		if (m_device)
 		{
-			PROPVARIANT var;
-			PropVariantInit(&var);
-			var.vt = VT_EMPTY;
-
-			hr = m_imfSource->Start(m_imfDescriptor, NULL, &var);
+			hr = m_device->Resume();
 		}
 
 		if (SUCCEEDED(hr))
@@ -328,42 +148,157 @@ namespace recording
 
 	bool Recorder::IsReady()
 	{
-		return m_imfStarted;
+		return m_capturing;
 	}
 
-	HRESULT Recorder::EndRecording()
+	// level: NONE, or a playback DenoiseLevel applied to the captured 16kHz mono PCM; may change while recording
+	HRESULT Recorder::SetDenoise(playback::DenoiseLevel requested)
 	{
-		HRESULT hr = S_OK;
-		SafeRelease(m_imfReader);
+		playback::DenoiseLevel level = requested;
+#ifdef STEREO
+		if (level != playback::DenoiseLevel::NONE)
+			return E_NOTIMPL; // 10ms frames of 16kHz mono only
+#endif
+		std::lock_guard<std::mutex> lock(m_denoiseMutex);
+		if (m_rnnoiseState)
+		{
+			rnnoise_destroy(m_rnnoiseState);
+			m_rnnoiseState = nullptr;
+		}
+		if (m_spectralState)
+		{
+			spectral_destroy(m_spectralState);
+			m_spectralState = nullptr;
+		}
 
-		if (m_imfSource)
+		if (level == playback::DenoiseLevel::LIGHT)
+			m_spectralState = spectral_create();
+		else if (level != playback::DenoiseLevel::NONE)
+			m_rnnoiseState = rnnoise_create(level == playback::DenoiseLevel::FULL ? 1 : 0);
+		if (level != playback::DenoiseLevel::NONE && !m_rnnoiseState && !m_spectralState)
 		{
-			hr = m_imfSource->Stop();
+			DebugPrint("ERROR: Failed to create capture denoise state for level %d\n", (int)level);
+			level = playback::DenoiseLevel::NONE;
+		}
+
+		// Queued PCM is dropped: a partial frame would otherwise be glued to later audio
+		std::lock_guard<std::mutex> captureLock(m_captureMutex);
+		m_captureBuffer.clear();
+		m_denoiseLevel = level;
+		return level == requested ? S_OK : E_OUTOFMEMORY;
+	}
+
+	void Recorder::DenoiseThread()
+	{
+		const size_t inputFrameBytes = CAPTURE_FRAME_SIZE * sizeof(int16_t);
+
+		std::vector<uint8_t> pending;
+		int16_t upsampled[FRAME_SIZE]; // one frame at 48kHz
+		int16_t lastSample = 0;
+		bool passThrough;
 
-			if (SUCCEEDED(hr))
+		while (true)
+		{
 			{
-				hr = m_imfSource->Shutdown();
+				std::unique_lock<std::mutex> lock(m_captureMutex);
+				m_captureReady.wait(lock, [this, inputFrameBytes]
+									{ return m_denoiseShutdown || m_captureBuffer.size() >= inputFrameBytes ||
+											 (!m_captureBuffer.empty() && m_denoiseLevel == playback::DenoiseLevel::NONE); });
+				if (m_denoiseShutdown)
+					break;
+				// The level only changes with the buffer emptied, under this lock
+				passThrough = m_denoiseLevel == playback::DenoiseLevel::NONE;
+				size_t bytes = m_captureBuffer.size();
+				if (!passThrough)
+					bytes -= bytes % inputFrameBytes;
+				pending.assign(m_captureBuffer.begin(), m_captureBuffer.begin() + bytes);
+				m_captureBuffer.erase(m_captureBuffer.begin(), m_captureBuffer.begin() + bytes);
 			}
-		}
 
-		if (m_imfStarted)
-		{
-			hr = MFShutdown();
-			if (SUCCEEDED(hr))
+			// Send data to stream as it was captured
+			if (passThrough)
 			{
-				m_imfStarted = false;
+				if (m_record)
+					m_record(pending, std::vector<float>());
+				continue;
 			}
+
+			size_t frames = pending.size() / inputFrameBytes;
+			std::vector<uint8_t> bytes(pending.size());
+			std::vector<float> vad(frames, 1.f);
+			{
+				std::lock_guard<std::mutex> lock(m_denoiseMutex);
+				for (size_t f = 0; f < frames; f++)
+				{
+					const int16_t *input16k = reinterpret_cast<const int16_t *>(&pending[f * inputFrameBytes]);
+					int16_t *output16k = reinterpret_cast<int16_t *>(&bytes[f * inputFrameBytes]);
+					if (m_spectralState)
+					{
+						vad[f] = spectral_process_frame_s16(m_spectralState, output16k, input16k);
+					}
+					else if (m_rnnoiseState)
+					{
+						// Upsample to 48kHz (1:3) with linear interpolation from the previous sample, one
+						// 16kHz sample late, so every third output is an input sample and decimation
+						// hands back exactly what went in where RNNoise leaves the signal alone
+						for (int i = 0; i < CAPTURE_FRAME_SIZE; i++)
+						{
+							float s0 = i > 0 ? input16k[i - 1] : lastSample;
+							float s1 = input16k[i];
+							upsampled[i * 3] = static_cast<int16_t>(lrintf((2.f * s0 + s1) / 3.f));
+							upsampled[i * 3 + 1] = static_cast<int16_t>(lrintf((s0 + 2.f * s1) / 3.f));
+							upsampled[i * 3 + 2] = input16k[i];
+						}
+						lastSample = input16k[CAPTURE_FRAME_SIZE - 1];
+
+						vad[f] = rnnoise_process_frame_s16(m_rnnoiseState, upsampled, upsampled);
+
+						for (int i = 0; i < CAPTURE_FRAME_SIZE; i++)
+							output16k[i] = upsampled[i * 3 + 2];
+					}
+					else
+					{
+						memcpy(output16k, input16k, inputFrameBytes);
+					}
+				}
+			}
+
+			// Cleaned PCM, with one speech probability per 10ms frame of it
+			if (m_record)
+				m_record(bytes, vad);
 		}
+	}
 
-		SafeRelease(m_imfSource);
-		SafeRelease(m_imfDescriptor);
+	void Recorder::StopDenoiseThread()
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_captureMutex);
+			m_denoiseShutdown = true;
+			m_captureBuffer.clear();
+		}
+		m_captureReady.notify_all();
+		if (m_denoiseThread.joinable())
+			m_denoiseThread.join();
+	}
+
+	HRESULT Recorder::EndRecording()
+	{
+		HRESULT hr = S_OK;
+		m_capturing = false;
+		if (m_device)
+		{
+			hr = m_device->Stop();
+		}
+		StopDenoiseThread();
 		return hr;
 	}
 
 	HRESULT Recorder::Dispose()
 	{
 		HRESULT hr = EndRecording();
-		m_recordEventHandler = nullptr;
+		m_device.reset();
+		SetDenoise(playback::DenoiseLevel::NONE);
+		m_record = nullptr;
 		return hr;
 	}
 };
\ No newline at end of file
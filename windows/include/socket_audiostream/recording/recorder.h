@@ -1,56 +1,68 @@
 #pragma once
 
-#include <mfidl.h>		 // IMFMediaSource, IMFSourceReader
-#include <Mfreadwrite.h> // IMFSourceReaderCallback
-
 #include <assert.h>
+#include <atomic>			  // std::atomic
+#include <condition_variable> // std::condition_variable
+#include <functional>		  // std::function
+#include <memory>			  // std::unique_ptr
+#include <thread>			  // std::thread
+#include <mutex>			  // std::mutex
+#include <vector>			  // std::vector
 
-#include "../utils.h"
-
-using namespace flutter;
-
-#define MF_AUDIO_RENDERER_ATTRIBUTE_FLAG_ENABLE_VOICE 0x1
+#include "../platform.h"				// HRESULT
+#include "../device/audiodevice.h"	// device::CaptureDevice
+#include "../playback/player.h"		// DenoiseLevel, denoise.h, spectral.h
 
 namespace recording
 {
-	class Recorder : public IMFSourceReaderCallback
+	// Recorded PCM, and one speech probability per 10ms frame of it when it was denoised (vad is
+	// empty otherwise). Called from the capture or the denoise thread.
+	using RecordCallback = std::function<void(const std::vector<uint8_t> &bytes, const std::vector<float> &vad)>;
+
+	class Recorder
 	{
 	public:
-		static HRESULT CreateInstance(EventStreamHandler<> *recordEventHandler, Recorder **recorder);
+		static HRESULT CreateInstance(RecordCallback record, Recorder **recorder);
 
-		Recorder(EventStreamHandler<> *recordEventHandler);
+		explicit Recorder(RecordCallback record);
 		virtual ~Recorder();
 
-		HRESULT Recorder::Start(std::string recorderId, LPCWSTR deviceId);
+#ifdef _WIN32
+		HRESULT Start(std::string recorderId, const wchar_t *deviceId);
+#endif
+		HRESULT Start(std::unique_ptr<device::CaptureDevice> device);
 		HRESULT Pause();
 		HRESULT Resume();
 		HRESULT Stop();
 		bool IsPaused();
 		bool IsReady();
+		HRESULT SetDenoise(playback::DenoiseLevel level);
 		HRESULT Dispose();
 
-		// IUnknown methods
-		STDMETHODIMP QueryInterface(REFIID iid, void **ppv);
-		STDMETHODIMP_(ULONG)
-		AddRef();
-		STDMETHODIMP_(ULONG)
-		Release();
-
-		// IMFSourceReaderCallback methods
-		STDMETHODIMP OnReadSample(HRESULT hrStatus, DWORD dwStreamIndex, DWORD dwStreamFlags, LONGLONG llTimestamp, IMFSample *imfSample);
-		STDMETHODIMP OnEvent(DWORD, IMFMediaEvent *);
-		STDMETHODIMP OnFlush(DWORD);
-
 	private:
 		HRESULT EndRecording();
+		void OnCapture(HRESULT status, const uint8_t *data, size_t size);
+		void DenoiseThread();
+		void StopDenoiseThread();
 
-		long m_LockCount;
-		IMFSourceReader *m_imfReader;
-		IMFMediaSource *m_imfSource;
-		IMFPresentationDescriptor *m_imfDescriptor;
-		bool m_imfStarted = false;
+		// Media Foundation, or a virtual device. Kept after a capture error until the next
+		// Start, as the error arrives on the device's own callback.
+		std::unique_ptr<device::CaptureDevice> m_device;
+		std::atomic<bool> m_capturing{false};
 		bool m_paused = false;
 
-		EventStreamHandler<> *m_recordEventHandler;
+		RecordCallback m_record;
+
+		// Capture denoise: OnCapture only queues the PCM, the denoise thread reframes it to
+		// 10ms, cleans it and sends it with one speech probability per frame
+		std::atomic<playback::DenoiseLevel> m_denoiseLevel;
+		std::thread m_denoiseThread;
+		std::mutex m_captureMutex;
+		std::condition_variable m_captureReady;
+		std::vector<uint8_t> m_captureBuffer;
+		bool m_denoiseShutdown = true;
+		std::mutex m_denoiseMutex; // guards the states against SetDenoise while a frame is processed
+		DenoiseState *m_rnnoiseState;
+		SpectralState *m_spectralState;
 	};
-};
\ No newline at end of file
+};
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <atomic>  // std::atomic
+#include <cstdint> // uint8_t
+#include <cstring> // memcpy
+#include <vector>  // std::vector
+
+// Lock-free single-producer single-consumer byte ring: one thread writes, one thread reads,
+// and neither ever waits for the other or allocates. The capacity is a power of two, so the
+// positions count up freely and wrap with a mask.
+class RingBuffer
+{
+public:
+	// Not thread-safe: only while neither side is running
+	void Resize(size_t capacity)
+	{
+		size_t size = 1;
+		while (size < capacity)
+			size <<= 1;
+		m_data.assign(size, 0);
+		m_mask = size - 1;
+		Reset();
+	}
+
+	// Not thread-safe: only while neither side is running
+	void Reset()
+	{
+		m_head.store(0, std::memory_order_relaxed);
+		m_tail.store(0, std::memory_order_relaxed);
+	}
+
+	size_t Capacity() const { return m_data.size(); }
+
+	// Bytes ready to read; exact on the consumer side, a lower bound on the producer side
+	size_t Size() const
+	{
+		return m_tail.load(std::memory_order_acquire) - m_head.load(std::memory_order_acquire);
+	}
+
+	// Free bytes; exact on the producer side, a lower bound on the consumer side
+	size_t Space() const { return Capacity() - Size(); }
+
+	// Producer: copies as much of data as fits and returns the number of bytes written
+	size_t Write(const uint8_t *data, size_t size)
+	{
+		const size_t tail = m_tail.load(std::memory_order_relaxed);
+		const size_t space = Capacity() - (tail - m_head.load(std::memory_order_acquire));
+		if (size > space)
+			size = space;
+		const size_t offset = tail & m_mask;
+		const size_t first = size < Capacity() - offset ? size : Capacity() - offset;
+		memcpy(m_data.data() + offset, data, first);
+		memcpy(m_data.data(), data + first, size - first);
+		m_tail.store(tail + size, std::memory_order_release);
+		return size;
+	}
+
+	// Consumer: the ready bytes in place, as up to two contiguous spans in stream order. They
+	// stay valid, and the producer stays out of them, until Consume() releases them.
+	size_t Peek(const uint8_t *span[2], size_t spanSize[2]) const
+	{
+		const size_t head = m_head.load(std::memory_order_relaxed);
+		const size_t ready = m_tail.load(std::memory_order_acquire) - head;
+		const size_t offset = head & m_mask;
+		spanSize[0] = ready < Capacity() - offset ? ready : Capacity() - offset;
+		spanSize[1] = ready - spanSize[0];
+		span[0] = m_data.data() + offset;
+		span[1] = m_data.data();
+		return ready;
+	}
+
+	// Consumer: releases the oldest size bytes (at most Size()) back to the producer
+	void Consume(size_t size)
+	{
+		m_head.store(m_head.load(std::memory_order_relaxed) + size, std::memory_order_release);
+	}
+
+	// Consumer: copies up to size bytes into data and returns the number of bytes read
+	size_t Read(uint8_t *data, size_t size)
+	{
+		const uint8_t *span[2];
+		size_t spanSize[2];
+		const size_t ready = Peek(span, spanSize);
+		if (size > ready)
+			size = ready;
+		const size_t first = size < spanSize[0] ? size : spanSize[0];
+		memcpy(data, span[0], first);
+		memcpy(data + first, span[1], size - first);
+		Consume(size);
+		return size;
+	}
+
+private:
+	std::vector<uint8_t> m_data;
+	size_t m_mask = 0;
+	alignas(64) std::atomic<size_t> m_head{0}; // consumer's position, next byte to read
+	alignas(64) std::atomic<size_t> m_tail{0}; // producer's position, next byte to write
+};
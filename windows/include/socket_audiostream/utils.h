@@ -11,25 +11,10 @@
 
 #define NOMINMAX
 
-#define min(a,b) (((a) < (b)) ? (a) : (b))
-#define max(a,b) (((a) > (b)) ? (a) : (b))
+#include "platform.h" // min, max, DebugPrint
 
 using Microsoft::WRL::ComPtr; // Enables ComPtr smart pointer usage
 
-// Debug flag
-constexpr bool DEBUG = false;
-
-// Central debug logger
-inline void DebugPrint(const char* fmt, ...)
-{
-	if (!DEBUG) return;
-	va_list args;
-	va_start(args, fmt);
-	vprintf(fmt, args);
-	va_end(args);
-	fflush(stdout);
-}
-
 template <class T>
 inline void SafeRelease(T *&pT)
 {